@@ -131,6 +131,8 @@ static const ElementInfoParam c_AddressHasher_params[] = {
 		{"numColsPerBank", "Number of cols in every bank", NULL},
 		{"numBytesPerTransaction", "Number of bytes retrieved for every transaction", NULL},
 		{"strAddressMapStr","String defining the address mapping scheme",NULL},
+		{"strAddressXorMap","Address bits XORed into field bits, as <field><bit>:<addrBit>,<addrBit>;... e.g. \"b0:13,17;b1:14,18\"",""},
+		{"strAddressPermuteFields","Fields (e.g. \"Bb\") whose bits are XORed with the low row bits for permutation-based interleaving",""},
 		{ NULL, NULL, NULL } };
 
 //static const ElementInfoPort c_AddressHasher_ports[] = {
@@ -192,6 +194,7 @@ static const ElementInfoParam c_TraceFileReader_params[] = {
 		{"numTxnPerCycle", "The number of transactions generated per cycle", NULL},
 		{"traceFile", "Location of trace file to read", NULL},
                 {"traceFileType", "Trace file type (DEFAULT or USIMM)",NULL},
+		{"decodeThreads", "Threads decoding a block compressed trace file ahead of the reader", "2"},
 		{ NULL, NULL, NULL } };
 
 static const char* c_TraceFileReader_port_events[] = { "c_TxnReqEvent", "c_TxnResEvent", NULL };
@@ -214,8 +217,19 @@ static const ElementInfoStatistic c_TraceFileReader_stats[] = {
 
 /*----SETUP c_TxnScheduler STRUCTURES----*/
 static const ElementInfoParam c_TxnScheduler_params[] = {
-		{"txnSchedulingPolicy", "Transaction scheduling policy", NULL},
+		{"txnSchedulingPolicy", "Transaction scheduling policy: FCFS, FRFCFS, FRFCFS_CAP, BLISS or ATLAS", NULL},
 		{"numTxnQEntries", "The number of transaction queue entries", NULL},
+		{"boolReadFirstTxnScheduling", "Keep reads and writes in separate queues and drain writes between watermarks", NULL},
+		{"maxPendingWriteThreshold", "Fraction of the write queue at which writes are drained", NULL},
+		{"minPendingWriteThreshold", "Fraction of the write queue at which write draining stops", NULL},
+		{"rowHitCap", "FRFCFS_CAP: row hits that may bypass an older transaction to the same bank in a row", "4"},
+		{"numTxnSources", "BLISS/ATLAS: number of request sources", "1"},
+		{"txnSourceAddrShift", "BLISS/ATLAS: a request's source is (address >> txnSourceAddrShift) % numTxnSources", "30"},
+		{"blacklistThreshold", "BLISS: consecutive requests served from one source before it is blacklisted", "4"},
+		{"blacklistClearInterval", "BLISS: cycles between clearing the blacklist", "10000"},
+		{"atlasQuantum", "ATLAS: cycles between recomputing source ranks", "10000"},
+		{"atlasHistoryWeight", "ATLAS: weight of past quanta in the attained service", "0.875"},
+		{"atlasStarvationThreshold", "ATLAS: cycles after which a request is served ahead of the ranking", "50000"},
 		{NULL, NULL, NULL } };
 
 static const ElementInfoStatistic c_TxnScheduler_stats[] = {
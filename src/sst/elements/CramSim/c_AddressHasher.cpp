@@ -32,6 +32,10 @@
 #include <assert.h>
 #include <cmath>
 #include <regex>
+#include <cstring>
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
 
 #include "c_AddressHasher.hpp"
 
@@ -39,6 +43,9 @@ using namespace std;
 using namespace SST;
 using namespace n_Bank;
 
+// field letters of the address map string, indexed by e_AddressField
+static const char k_fieldNames[] = "CcRBbrlh";
+
 
 c_AddressHasher::c_AddressHasher(Component * comp, Params &params) : SubComponent(comp) {
 
@@ -284,133 +291,174 @@ c_AddressHasher::c_AddressHasher(Component * comp, Params &params) : SubComponen
     }
   } // else found in map
 
-} // c_AddressHasher(SST::Params)
-
+  compileFieldMaps();
 
-void c_AddressHasher::fillHashedAddress(c_HashedAddress *x_hashAddr, const ulong x_address) {
-  ulong l_cur=0;
-  ulong l_cnt=0;
-  
-  //channel
-  auto l_bitPos = m_bitPositions.find("C");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setChannel(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
-
-      l_cur |= l_tmp;
-    }
-    x_hashAddr->setChannel(l_cur);
+  // optional XOR hashing of the bank/channel fields
+  string l_xorMapStr = (string)params.find<string>("strAddressXorMap", "", l_found);
+  string l_permuteStr = (string)params.find<string>("strAddressPermuteFields", "", l_found);
+  if(!l_xorMapStr.empty()) {
+    parseXorMap(l_xorMapStr);
+  }
+  if(!l_permuteStr.empty()) {
+    addPermutation(l_permuteStr);
   }
 
-  //pseudo channel
-   l_bitPos = m_bitPositions.find("c");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setPChannel(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
-
-      l_cur |= l_tmp;
+  // an XOR source must not itself be hashed, or the mapping stops being one-to-one
+  ulong l_hashedBits = 0;
+  for(unsigned l_field = 0; l_field < k_numAddressFields; l_field++) {
+    if(!m_fieldMaps[l_field].m_xorBits.empty()) {
+      l_hashedBits |= m_fieldMaps[l_field].m_addrMask;
     }
-    x_hashAddr->setPChannel(l_cur);
   }
-
-  //rank
-  l_bitPos = m_bitPositions.find("R");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setRank(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
-
-      l_cur |= l_tmp;
+  for(unsigned l_field = 0; l_field < k_numAddressFields; l_field++) {
+    for(auto &l_xor : m_fieldMaps[l_field].m_xorBits) {
+      if(l_xor.second & l_hashedBits) {
+	cerr << "Error!: XOR hash for field " << k_fieldNames[l_field] << " bit " << l_xor.first
+	     << " reads address bits of a field that is itself hashed. Aborting!" << endl;
+	exit(-1);
+      }
     }
-    x_hashAddr->setRank(l_cur);
   }
 
-  //bankGroup
-  l_bitPos = m_bitPositions.find("B");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setBankGroup(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
+} // c_AddressHasher(SST::Params)
 
-      l_cur |= l_tmp;
+// Turn m_bitPositions into masks and shift/mask runs so decoding a field
+// costs a few operations per run of adjacent bits instead of a map lookup
+// and a loop over every bit
+void c_AddressHasher::compileFieldMaps() {
+  for(unsigned l_field = 0; l_field < k_numAddressFields; l_field++) {
+    c_FieldMap &l_map = m_fieldMaps[l_field];
+    l_map.m_addrMask = 0;
+    l_map.m_runs.clear();
+    l_map.m_xorBits.clear();
+
+    auto l_bitPos = m_bitPositions.find(string(1, k_fieldNames[l_field]));
+    if(l_bitPos == m_bitPositions.end()) {
+      continue;
+    }
+
+    const vector<uint> &l_positions = l_bitPos->second;
+    for(unsigned l_cnt = 0; l_cnt < l_positions.size(); l_cnt++) {
+      // positions are assigned in increasing order, which is what lets a
+      // field be read with a single PEXT over its mask
+      assert(l_cnt == 0 || l_positions[l_cnt] > l_positions[l_cnt - 1]);
+      l_map.m_addrMask |= (ulong)1 << l_positions[l_cnt];
+
+      if(l_cnt > 0 && l_positions[l_cnt] == l_positions[l_cnt - 1] + 1) {
+	c_BitRun &l_run = l_map.m_runs.back();
+	l_run.m_mask = (l_run.m_mask << 1) | 1;
+      } else {
+	c_BitRun l_run;
+	l_run.m_srcShift = l_positions[l_cnt];
+	l_run.m_dstShift = l_cnt;
+	l_run.m_mask = 1;
+	l_map.m_runs.push_back(l_run);
+      }
     }
-    x_hashAddr->setBankGroup(l_cur);
   }
+} // compileFieldMaps()
+
+// strAddressXorMap lists which address bits are XORed into a field bit, as
+// <field><fieldBit>:<addrBit>[,<addrBit>...] entries separated by ';'
+// e.g. "b0:13,17;b1:14,18" folds address bits 13 and 17 into bank bit 0
+void c_AddressHasher::parseXorMap(const string &x_xorMapStr) {
+  string l_mapCopy = x_xorMapStr;
+  l_mapCopy.erase(remove_if(l_mapCopy.begin(), l_mapCopy.end(), ::isspace), l_mapCopy.end());
+
+  stringstream l_entries(l_mapCopy);
+  string l_entry;
+  while(getline(l_entries, l_entry, ';')) {
+    if(l_entry.empty()) {
+      continue;
+    }
+
+    size_t l_colon = l_entry.find(':');
+    const char *l_fieldPos = strchr(k_fieldNames, l_entry[0]);
+    if(l_colon == string::npos || l_colon < 2 || l_fieldPos == nullptr || *l_fieldPos == '\0') {
+      cerr << "Parsing error at " << l_entry << " in address XOR map string " << x_xorMapStr << endl;
+      exit(-1);
+    }
+    unsigned l_field = l_fieldPos - k_fieldNames;
+    unsigned l_fieldBit = stoi(l_entry.substr(1, l_colon - 1));
 
-  //bank
-  l_bitPos = m_bitPositions.find("b");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setBank(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
+    if(l_fieldBit >= m_structureSizes[string(1, k_fieldNames[l_field])]) {
+      cerr << "Error!: Address XOR map entry " << l_entry << " names a bit the field does not have. Aborting!" << endl;
+      exit(-1);
+    }
 
-      l_cur |= l_tmp;
+    ulong l_srcMask = 0;
+    stringstream l_srcs(l_entry.substr(l_colon + 1));
+    string l_src;
+    while(getline(l_srcs, l_src, ',')) {
+      if(l_src.empty() || !all_of(l_src.begin(), l_src.end(), ::isdigit) || stoi(l_src) >= 64) {
+	cerr << "Parsing error at " << l_entry << " in address XOR map string " << x_xorMapStr << endl;
+	exit(-1);
+      }
+      l_srcMask ^= (ulong)1 << stoi(l_src);
     }
-    x_hashAddr->setBank(l_cur);
-  }
 
-  //row
-  l_bitPos = m_bitPositions.find("r");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setRow(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
+    m_fieldMaps[l_field].m_xorBits.push_back(make_pair(l_fieldBit, l_srcMask));
+  }
+} // parseXorMap(string)
+
+// strAddressPermuteFields is the usual permutation-based interleaving: each
+// bit of the listed fields, in the order given, is XORed with the next row
+// bit starting from the least significant one, e.g. "Bb" spreads rows that
+// would conflict in one bank over the bank groups and banks
+void c_AddressHasher::addPermutation(const string &x_fields) {
+  const vector<uint> &l_rowBits = m_bitPositions["r"];
+  unsigned l_nextRowBit = 0;
+
+  for(char l_name : x_fields) {
+    if(l_name == '_') {
+      continue;
+    }
+    const char *l_fieldPos = strchr(k_fieldNames, l_name);
+    if(l_fieldPos == nullptr || l_name == 'r' || l_name == '\0') {
+      cerr << "Parsing error at " << l_name << " in address permute string " << x_fields << endl;
+      exit(-1);
+    }
 
-      l_cur |= l_tmp;
+    unsigned l_field = l_fieldPos - k_fieldNames;
+    unsigned l_fieldBits = m_structureSizes[string(1, l_name)];
+    for(unsigned l_bit = 0; l_bit < l_fieldBits; l_bit++) {
+      if(l_nextRowBit >= l_rowBits.size()) {
+	cerr << "Error!: Not enough row bits to permute fields " << x_fields << ". Aborting!" << endl;
+	exit(-1);
+      }
+      m_fieldMaps[l_field].m_xorBits.push_back(make_pair(l_bit, (ulong)1 << l_rowBits[l_nextRowBit]));
+      l_nextRowBit++;
     }
-    x_hashAddr->setRow(l_cur);
   }
+} // addPermutation(string)
+
+inline ulong c_AddressHasher::extractField(const c_FieldMap &x_map, const ulong x_address) const {
+#ifdef __BMI2__
+  ulong l_cur = _pext_u64(x_address, x_map.m_addrMask);
+#else
+  ulong l_cur = 0;
+  for(const c_BitRun &l_run : x_map.m_runs) {
+    l_cur |= ((x_address >> l_run.m_srcShift) & l_run.m_mask) << l_run.m_dstShift;
+  }
+#endif
 
-  //col
-  l_bitPos = m_bitPositions.find("l");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setCol(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
-
-      l_cur |= l_tmp;
-    }
-    x_hashAddr->setCol(l_cur);
+  for(auto &l_xor : x_map.m_xorBits) {
+    l_cur ^= (ulong)__builtin_parityl(x_address & l_xor.second) << l_xor.first;
   }
+  return l_cur;
+} // extractField(c_FieldMap, x_address)
 
-  //cacheline
-  l_bitPos = m_bitPositions.find("h");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setCacheline(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
 
-      l_cur |= l_tmp;
-    }
-    x_hashAddr->setCacheline(l_cur);
-  }
-  
+void c_AddressHasher::fillHashedAddress(c_HashedAddress *x_hashAddr, const ulong x_address) {
+  x_hashAddr->setChannel(extractField(m_fieldMaps[k_channel], x_address));
+  x_hashAddr->setPChannel(extractField(m_fieldMaps[k_pchannel], x_address));
+  x_hashAddr->setRank(extractField(m_fieldMaps[k_rank], x_address));
+  x_hashAddr->setBankGroup(extractField(m_fieldMaps[k_bankGroup], x_address));
+  x_hashAddr->setBank(extractField(m_fieldMaps[k_bank], x_address));
+  x_hashAddr->setRow(extractField(m_fieldMaps[k_row], x_address));
+  x_hashAddr->setCol(extractField(m_fieldMaps[k_col], x_address));
+  x_hashAddr->setCacheline(extractField(m_fieldMaps[k_cacheline], x_address));
+
   unsigned l_bankId =
     x_hashAddr->getBank()
     + x_hashAddr->getBankGroup() * k_pNumBanks
@@ -76,6 +76,29 @@ namespace SST {
             c_AddressHasher(Params &x_params);
             ulong getAddressForBankId(const unsigned x_bankId);
 
+            // address fields in the order fillHashedAddress fills them
+            enum e_AddressField { k_channel, k_pchannel, k_rank, k_bankGroup, k_bank,
+                                  k_row, k_col, k_cacheline, k_numAddressFields };
+
+            // a run of adjacent address bits that land in adjacent field bits
+            struct c_BitRun {
+                unsigned m_srcShift;
+                unsigned m_dstShift;
+                ulong m_mask;
+            };
+
+            // m_bitPositions compiled for one field, plus the XOR hash applied to it
+            struct c_FieldMap {
+                ulong m_addrMask;                                   // every address bit in the field
+                std::vector<c_BitRun> m_runs;
+                std::vector<std::pair<unsigned, ulong> > m_xorBits; // field bit, address bits folded into it
+            };
+
+            void compileFieldMaps();
+            void parseXorMap(const std::string &x_xorMapStr);
+            void addPermutation(const std::string &x_fields);
+            inline ulong extractField(const c_FieldMap &x_map, const ulong x_address) const;
+
             c_Controller* m_owner;
             unsigned k_pNumChannels;
             unsigned k_pNumRanks;
@@ -89,6 +112,7 @@ namespace SST {
             std::string k_addressMapStr = "rlbRBh";
             std::map<std::string, std::vector<uint> > m_bitPositions;
             std::map<std::string, uint> m_structureSizes;  // Used for checking that params agree
+            c_FieldMap m_fieldMaps[k_numAddressFields];
 
             // regex replacement stuff
             void parsePattern(std::string *x_inStr, std::pair<std::string, uint> *x_outPair);
@@ -73,7 +73,11 @@ public:
 	}
 
 	virtual void handleCommand(c_BankCommand* x_bankCommandPtr);
-	virtual c_BankCommand* clockTic(); // called every cycle
+	virtual c_BankCommand* clockTic(); // called every cycle the bank holds a command
+
+	bool hasCommand() const {
+		return (m_cmd != nullptr);
+	}
 
 
 	inline unsigned nRC() const {
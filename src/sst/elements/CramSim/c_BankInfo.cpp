@@ -27,6 +27,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include <memory>
+#include <algorithm>
 #include <assert.h>
 
 #include "sst_config.h"
@@ -152,6 +153,12 @@ void c_BankInfo::clockTic(SimTime_t x_cycle) {
 
 }
 
+void c_BankInfo::skipTics(SimTime_t x_tics) {
+	m_autoPrechargeTimer -= std::min(x_tics, m_autoPrechargeTimer);
+
+	m_bankState->skipTics(x_tics);
+}
+
 std::list<e_BankCommandType> c_BankInfo::getAllowedCommands() {
 	return m_bankState->getAllowedCommands();
 }
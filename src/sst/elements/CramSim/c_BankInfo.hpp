@@ -57,6 +57,13 @@ public:
 
 	void clockTic(SimTime_t x_cycle);
 
+	// see c_BankState::getQuietTics()
+	SimTime_t getQuietTics() {
+		return (m_bankState->getQuietTics());
+	}
+
+	void skipTics(SimTime_t x_tics);
+
 	std::list<e_BankCommandType> getAllowedCommands();
 
 	bool isCommandAllowed(c_BankCommand* x_cmdPtr, SimTime_t x_simCycle);
@@ -33,6 +33,7 @@
 #include <memory>
 #include <list>
 #include <map>
+#include <limits>
 
 #include <sst/core/simulation.h>
 
@@ -64,6 +65,18 @@ public:
 
 	virtual void clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) = 0;
 
+	// Number of upcoming clockTic() calls that would do nothing but count timers down.
+	// The bank does not need to be ticked for those; skipTics() applies them at once.
+	// k_quietForever if nothing happens until the next command arrives.
+	virtual SimTime_t getQuietTics() {
+		return 0;
+	}
+
+	virtual void skipTics(SimTime_t x_tics) {
+	}
+
+	static const SimTime_t k_quietForever = std::numeric_limits<SimTime_t>::max();
+
 	virtual void enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 			c_BankCommand* x_cmdPtr, SimTime_t x_cycle) = 0;
 
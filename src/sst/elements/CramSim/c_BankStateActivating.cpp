@@ -30,6 +30,7 @@
 #include "sst_config.h"
 
 #include <memory>
+#include <algorithm>
 #include <assert.h>
 
 #include "c_BankState.hpp"
@@ -76,6 +77,14 @@ void c_BankStateActivating::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 	}
 }
 
+SimTime_t c_BankStateActivating::getQuietTics() {
+	return m_timer;
+}
+
+void c_BankStateActivating::skipTics(SimTime_t x_tics) {
+	m_timer -= std::min(x_tics, m_timer);
+}
+
 void c_BankStateActivating::enter(c_BankInfo* x_bank,
 		c_BankState* x_prevState, c_BankCommand* x_cmdPtr, SimTime_t x_cycle) {
 	//std::cout << "Entered " << __PRETTY_FUNCTION__ << std::endl;
@@ -121,6 +121,17 @@ void c_BankStateActive::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 	}
 }
 
+SimTime_t c_BankStateActive::getQuietTics() {
+	if (0 < m_timer)
+		return m_timer;
+	// without a received command the state holds until one arrives
+	return m_receivedCommandPtr ? 0 : k_quietForever;
+}
+
+void c_BankStateActive::skipTics(SimTime_t x_tics) {
+	m_timer -= std::min(x_tics, m_timer);
+}
+
 void c_BankStateActive::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 		c_BankCommand* x_cmdPtr, SimTime_t x_cycle) {
 
@@ -30,6 +30,7 @@
 #include "sst_config.h"
 
 #include <memory>
+#include <algorithm>
 #include <iostream>
 #include <assert.h>
 
@@ -125,6 +126,21 @@ void c_BankStateIdle::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 	}
 }
 
+SimTime_t c_BankStateIdle::getQuietTics() {
+	if (m_receivedCommandPtr)
+		return 0;
+	// the previous command's response is made ready when the timer ticks from 2 to 1,
+	// after that the timer only counts down until the next command resets it
+	if (2 < m_timer)
+		return m_timer - 2;
+	return (2 == m_timer) ? 0 : k_quietForever;
+}
+
+void c_BankStateIdle::skipTics(SimTime_t x_tics) {
+	if (2 < m_timer)
+		m_timer -= std::min(x_tics, m_timer - 2);
+}
+
 // call this function after receiving a command
 void c_BankStateIdle::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 		c_BankCommand* x_cmdPtr, SimTime_t x_cycle) {
@@ -54,6 +54,11 @@ public:
 	virtual void handleCommand(c_BankInfo* x_bank, c_BankCommand* x_bankCommandPtr, SimTime_t x_cycle);
 
 	virtual void clockTic(c_BankInfo* x_bank, SimTime_t x_cycle);
+
+	virtual SimTime_t getQuietTics();
+
+	virtual void skipTics(SimTime_t x_tics);
+
 	virtual void enter(c_BankInfo* x_bank, c_BankState* x_prevState, c_BankCommand* x_cmdPtr, SimTime_t x_cycle);
 	virtual std::list<e_BankCommandType> getAllowedCommands();
 
@@ -30,6 +30,7 @@
 #include "sst_config.h"
 
 #include <memory>
+#include <algorithm>
 #include <assert.h>
 
 #include <sst/core/simulation.h>
@@ -102,6 +103,14 @@ void c_BankStateReadA::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 
 }
 
+SimTime_t c_BankStateReadA::getQuietTics() {
+	return m_timerEnter;
+}
+
+void c_BankStateReadA::skipTics(SimTime_t x_tics) {
+	m_timerEnter -= std::min(x_tics, m_timerEnter);
+}
+
 void c_BankStateReadA::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 		c_BankCommand* x_cmdPtr, SimTime_t x_cycle) {
 
@@ -30,6 +30,7 @@
 #include "sst_config.h"
 
 #include <memory>
+#include <algorithm>
 #include <iostream>
 #include <assert.h>
 
@@ -88,6 +89,14 @@ void c_BankStateRefresh::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 	}
 }
 
+SimTime_t c_BankStateRefresh::getQuietTics() {
+	return m_timer;
+}
+
+void c_BankStateRefresh::skipTics(SimTime_t x_tics) {
+	m_timer -= std::min(x_tics, m_timer);
+}
+
 // call this function after receiving a command
 void c_BankStateRefresh::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 		c_BankCommand* x_cmdPtr, SimTime_t x_cycle) {
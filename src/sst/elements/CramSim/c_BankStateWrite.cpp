@@ -30,6 +30,7 @@
 #include "sst_config.h"
 
 #include <memory>
+#include <algorithm>
 #include <assert.h>
 
 #include "c_BankState.hpp"
@@ -183,6 +184,17 @@ void c_BankStateWrite::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 	}
 }
 
+SimTime_t c_BankStateWrite::getQuietTics() {
+	if (0 < m_timer)
+		return m_timer;
+	// without a received command the state holds until one arrives
+	return m_receivedCommandPtr ? 0 : k_quietForever;
+}
+
+void c_BankStateWrite::skipTics(SimTime_t x_tics) {
+	m_timer -= std::min(x_tics, m_timer);
+}
+
 void c_BankStateWrite::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 		c_BankCommand* x_cmdPtr, SimTime_t x_cycle) {
 
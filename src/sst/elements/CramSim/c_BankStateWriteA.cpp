@@ -30,6 +30,7 @@
 #include "sst_config.h"
 
 #include <memory>
+#include <algorithm>
 
 #include "c_Bank.hpp"
 #include "c_BankState.hpp"
@@ -94,6 +95,14 @@ void c_BankStateWriteA::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 	}
 }
 
+SimTime_t c_BankStateWriteA::getQuietTics() {
+	return m_timerEnter;
+}
+
+void c_BankStateWriteA::skipTics(SimTime_t x_tics) {
+	m_timerEnter -= std::min(x_tics, m_timerEnter);
+}
+
 void c_BankStateWriteA::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 		c_BankCommand* x_cmdPtr, SimTime_t x_cycle) {
 //	 std::cout << "Entered " << __PRETTY_FUNCTION__ << std::endl;
@@ -330,6 +330,14 @@ c_DeviceDriver::c_DeviceDriver(Component *owner, Params& params) : SubComponent(
 		m_banks.push_back(l_entry);
 	}
 
+	//every bank is checked in the first cycle, after that only when its state needs it
+	m_bankTicWheel.resize(k_bankTicWheelSize);
+	SimTime_t l_noTic = c_BankState::k_quietForever;
+	m_bankNextTic.resize(m_numBanks, l_noTic);
+	m_bankLastTic.resize(m_numBanks, m_Owner->getSimCycle());
+	for (int l_i = 0; l_i != m_numBanks; ++l_i)
+		scheduleBankTic(l_i, m_Owner->getSimCycle() + 1);
+
 
 	// connect the hierarchy
 	unsigned l_rankNum = 0;
@@ -487,16 +495,30 @@ void c_DeviceDriver::run() {
  *
  */
 void c_DeviceDriver::update() {
-	for (int l_i = 0; l_i != m_banks.size(); ++l_i) {
-
-		m_banks.at(l_i)->clockTic(m_Owner->getSimCycle());
-		// m_banks.at(l_i)->printState();
-	}
-	//update ACTFAWTracker info
-	for (int l_rankNum = 0; l_rankNum < m_numRanks; l_rankNum++) {
-		m_cmdACTFAWtrackers[l_rankNum].push_back(
-				m_isACTIssued[l_rankNum] ? static_cast<unsigned>(1) : static_cast<unsigned>(0));
-		m_cmdACTFAWtrackers[l_rankNum].pop_front();
+	SimTime_t l_cycle = m_Owner->getSimCycle();
+
+	m_dueBanks.clear();
+	m_dueBanks.swap(m_bankTicWheel[l_cycle % k_bankTicWheelSize]);
+	for (unsigned l_bankId : m_dueBanks) {
+		// skip entries superseded by an earlier wake-up
+		if (m_bankNextTic[l_bankId] != l_cycle)
+			continue;
+		m_bankNextTic[l_bankId] = c_BankState::k_quietForever;
+
+		c_BankInfo *l_bank = m_banks[l_bankId];
+		catchUpBank(l_bankId, l_cycle - 1);
+
+		SimTime_t l_quiet = l_bank->getQuietTics();
+		if (l_quiet == 0) {
+			l_bank->clockTic(l_cycle);
+			m_bankLastTic[l_bankId] = l_cycle;
+			l_quiet = l_bank->getQuietTics();
+			if (l_quiet != c_BankState::k_quietForever)
+				scheduleBankTic(l_bankId, l_cycle + 1 + l_quiet);
+		} else if (l_quiet != c_BankState::k_quietForever) {
+			// the wheel is shorter than the bank's timer, check again later
+			scheduleBankTic(l_bankId, l_cycle + l_quiet);
+		}
 	}
 
 	// do the member var setup up before calling any req sending policy function
@@ -684,6 +706,7 @@ void c_DeviceDriver::sendRequest() {
 					{
 						assert(m_isACTIssued[l_rankNum]==false);
 						m_isACTIssued[l_rankNum] = true;
+						recordACT(l_rankNum, m_Owner->getSimCycle());
 					}
 
 					if (occupyCommandBus(l_cmdPtr))
@@ -894,7 +917,10 @@ bool c_DeviceDriver::sendCommand(c_BankCommand* x_bankCommandPtr,
 				     x_bankCommandPtr->getSeqNum());
 		#endif
 
+		// bring a sleeping bank up to date before it sees the command, and tick it from the next cycle
+		catchUpBank(x_bank->getBankId(), l_time);
 		x_bank->handleCommand(x_bankCommandPtr, l_time);
+		scheduleBankTic(x_bank->getBankId(), l_time + 1);
 
 		// push the command to output queue
 		m_outputQ.push_back(x_bankCommandPtr);
@@ -910,14 +936,14 @@ bool c_DeviceDriver::sendCommand(c_BankCommand* x_bankCommandPtr,
  */
 void c_DeviceDriver::initACTFAWTracker()
 {
+	c_ACTFAWTracker l_tracker;
+	l_tracker.m_next = 0;
+	l_tracker.m_count = 0;
+	for (unsigned l_i = 0; l_i < k_maxACTsInFAW; l_i++)
+		l_tracker.m_actCycles[l_i] = 0;
+
 	m_cmdACTFAWtrackers.clear();
-	for(int i=0; i<m_numRanks;i++)
-	{
-		std::list<unsigned> l_cmdACTFAWTracker;
-		l_cmdACTFAWTracker.clear();
-		l_cmdACTFAWTracker.resize(m_bankParams.at("nFAW")-1, 0);
-		m_cmdACTFAWtrackers.push_back(l_cmdACTFAWTracker);
-	}
+	m_cmdACTFAWtrackers.resize(m_numRanks, l_tracker);
 }
 
 /*!
@@ -947,14 +973,64 @@ unsigned c_DeviceDriver::getNumIssuedACTinFAW(unsigned x_rankid) {
 
 	assert(x_rankid<m_numRanks);
 
-	// get count of ACT cmds issued in the FAW
+	// get count of ACT cmds issued in the FAW, i.e. in the previous nFAW-1 cycles
+	SimTime_t l_now = m_Owner->getSimCycle();
+	SimTime_t l_window = m_bankParams.at("nFAW");
+	const c_ACTFAWTracker& l_tracker = m_cmdACTFAWtrackers[x_rankid];
+
 	unsigned l_cmdACTIssuedInFAW = 0;
-	assert(m_cmdACTFAWtrackers[x_rankid].size() == m_bankParams.at("nFAW")-1);
-	for(auto& l_issued : m_cmdACTFAWtrackers[x_rankid])
-		l_cmdACTIssuedInFAW += l_issued;
+	for (unsigned l_i = 0; l_i < l_tracker.m_count; l_i++) {
+		SimTime_t l_actCycle = l_tracker.m_actCycles[l_i];
+		if (l_actCycle < l_now && l_actCycle + l_window > l_now)
+			l_cmdACTIssuedInFAW++;
+	}
 	return l_cmdACTIssuedInFAW;
 }
 
+/*!
+ * Remember the issue cycle of an ACT, replacing the oldest one kept for the rank
+ * @param x_rankid
+ * @param x_cycle
+ */
+void c_DeviceDriver::recordACT(unsigned x_rankid, SimTime_t x_cycle) {
+	c_ACTFAWTracker& l_tracker = m_cmdACTFAWtrackers[x_rankid];
+
+	l_tracker.m_actCycles[l_tracker.m_next] = x_cycle;
+	l_tracker.m_next = (l_tracker.m_next + 1) % k_maxACTsInFAW;
+	if (l_tracker.m_count < k_maxACTsInFAW)
+		l_tracker.m_count++;
+}
+
+/*!
+ * Queue a check of the bank in cycle x_cycle, unless one is already due by then
+ * @param x_bankId
+ * @param x_cycle
+ */
+void c_DeviceDriver::scheduleBankTic(unsigned x_bankId, SimTime_t x_cycle) {
+	if (m_bankNextTic[x_bankId] <= x_cycle)
+		return;
+
+	if (x_cycle - m_Owner->getSimCycle() >= k_bankTicWheelSize)
+		x_cycle = m_Owner->getSimCycle() + k_bankTicWheelSize - 1;
+
+	m_bankNextTic[x_bankId] = x_cycle;
+	m_bankTicWheel[x_cycle % k_bankTicWheelSize].push_back(x_bankId);
+}
+
+/*!
+ * Apply the tics a sleeping bank skipped up to and including x_cycle. Banks
+ * sleep only through quiet tics, so these only count its timers down.
+ * @param x_bankId
+ * @param x_cycle
+ */
+void c_DeviceDriver::catchUpBank(unsigned x_bankId, SimTime_t x_cycle) {
+	if (x_cycle <= m_bankLastTic[x_bankId])
+		return;
+
+	m_banks[x_bankId]->skipTics(x_cycle - m_bankLastTic[x_bankId]);
+	m_bankLastTic[x_bankId] = x_cycle;
+}
+
 /*!
  *
  * @param x_cmd
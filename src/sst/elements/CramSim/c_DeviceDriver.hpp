@@ -96,6 +96,11 @@ private:
 	void initACTFAWTracker();
 	void initRefresh();
 	unsigned getNumIssuedACTinFAW(unsigned x_rankid);
+	void recordACT(unsigned x_rankid, SimTime_t x_cycle);
+
+	//banks are ticked only when a state timer expires or a command arrives
+	void scheduleBankTic(unsigned x_bankId, SimTime_t x_cycle);
+	void catchUpBank(unsigned x_bankId, SimTime_t x_cycle);
 	void createRefreshCmds(unsigned x_rank);
     bool isRefreshing(const c_HashedAddress *x_addr);
 
@@ -116,7 +121,15 @@ private:
 	e_BankCommandType m_lastDataCmdType;
 	unsigned m_lastChannel;
 	unsigned m_lastPseudoChannel;
-	std::vector<std::list<unsigned>> m_cmdACTFAWtrackers; // FIXME: change this to a circular buffer for speed. Could also implement as shift register.
+	//per-rank ring buffer of the issue cycles of the most recent ACTs. At most
+	//k_maxACTsInFAW ACTs may be issued in a tFAW window, so no more need to be kept.
+	static const unsigned k_maxACTsInFAW = 4;
+	struct c_ACTFAWTracker {
+		SimTime_t m_actCycles[k_maxACTsInFAW];
+		unsigned m_next;
+		unsigned m_count;
+	};
+	std::vector<c_ACTFAWTracker> m_cmdACTFAWtrackers;
 	std::vector<bool> m_isACTIssued;
 	bool m_issuedACT;
 
@@ -136,6 +149,13 @@ private:
 	bool k_useSBRefresh;
 
 	std::vector<c_BankInfo*> m_banks;
+
+	//timing wheel of bank tics, slot (cycle % k_bankTicWheelSize) lists the banks to check in that cycle
+	static const unsigned k_bankTicWheelSize = 1024;
+	std::vector<std::vector<unsigned> > m_bankTicWheel;
+	std::vector<unsigned> m_dueBanks;
+	std::vector<SimTime_t> m_bankNextTic;  // cycle of the bank's pending wheel entry
+	std::vector<SimTime_t> m_bankLastTic;  // last cycle the bank's state is up to date with
 	std::vector<c_BankGroup*> m_bankGroups;
 	std::vector<c_Rank*> m_ranks;
 	std::vector<c_Channel*> m_channel;
@@ -296,12 +296,18 @@ void c_Dimm::printQueues() {
 
 bool c_Dimm::clockTic(SST::Cycle_t) {
 	m_simCycle++;
-	for (int l_i = 0; l_i != m_banks.size(); ++l_i) {
+	for (auto l_it = m_busyBanks.begin(); l_it != m_busyBanks.end();) {
 
-		c_BankCommand* l_resPtr = m_banks.at(l_i)->clockTic();
+		c_Bank* l_bank = m_banks.at(*l_it);
+		c_BankCommand* l_resPtr = l_bank->clockTic();
 		if (nullptr != l_resPtr) {
 			m_cmdResQ.push_back(l_resPtr);
 		}
+
+		if (l_bank->hasCommand())
+			++l_it;
+		else
+			l_it = m_busyBanks.erase(l_it);
 	}
 
 	sendResponse();
@@ -422,11 +428,13 @@ void c_Dimm::sendToBank(c_BankCommand* x_bankCommandPtr) {
 													 x_bankCommandPtr->getAddress(), l_bankid);
 			l_cmd->setResponseReady();
 			m_banks.at(l_bankid)->handleCommand(l_cmd);
+			m_busyBanks.insert(l_bankid);
 		}
 		delete x_bankCommandPtr;
 	} else {
 		l_bankNum = x_bankCommandPtr->getBankId();
 		m_banks.at(l_bankNum)->handleCommand(x_bankCommandPtr);
+		m_busyBanks.insert(l_bankNum);
 	}
 }
 
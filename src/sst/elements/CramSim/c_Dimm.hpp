@@ -31,6 +31,7 @@
 
 #include <vector>
 #include <queue>
+#include <set>
 #include <stdlib.h>
 
 // SST includes
@@ -114,6 +115,7 @@ private:
 
     SimTime_t m_simCycle;
 	std::vector<c_Bank*> m_banks;
+	std::set<unsigned> m_busyBanks; // banks holding a command, the others have nothing to do on a tick
 
 	std::vector<c_BankCommand*> m_cmdResQ;
 
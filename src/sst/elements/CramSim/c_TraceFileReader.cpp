@@ -28,6 +28,10 @@
 //#include "c_TxnResEvent.hpp"
 #include "c_TraceFileReader.hpp"
 
+#ifdef HAVE_LIBZ
+#include <sst/elements/prospero/prosblockformat.h>
+#endif
+
 //using namespace std;
 using namespace SST;
 using namespace n_Bank;
@@ -49,12 +53,32 @@ c_TraceFileReader::c_TraceFileReader(SST::ComponentId_t x_id, SST::Params& x_par
     {
         std::cout<< "TraceFileReader: tracefile name is" <<m_traceFileName<<std::endl;
     }
-    m_traceFileStream = new std::ifstream(m_traceFileName, std::ifstream::in);
-    if(!(*m_traceFileStream))
+    m_traceFileStream = NULL;
+    m_blockTraceReader = NULL;
+
+#ifdef HAVE_LIBZ
+    // traces written into the block compressed container are decoded ahead on worker threads
+    if(SST::Prospero::ProsperoBlockReader::isBlockTrace(m_traceFileName.c_str()))
     {
-        std::cerr << "Unable to open trace file " << m_traceFileName << " Aborting!" <<
-        std::endl;
-        exit(-1);
+        unsigned l_decodeThreads = x_params.find<unsigned>("decodeThreads", 2);
+        m_blockTraceReader = new SST::Prospero::ProsperoBlockReader();
+        if(!m_blockTraceReader->open(m_traceFileName.c_str(), l_decodeThreads))
+        {
+            std::cerr << "Unable to open block compressed trace file " << m_traceFileName << " Aborting!" <<
+            std::endl;
+            exit(-1);
+        }
+    }
+    else
+#endif
+    {
+        m_traceFileStream = new std::ifstream(m_traceFileName, std::ifstream::in);
+        if(!(*m_traceFileStream))
+        {
+            std::cerr << "Unable to open trace file " << m_traceFileName << " Aborting!" <<
+            std::endl;
+            exit(-1);
+        }
     }
 
     // get trace file type
@@ -84,6 +108,35 @@ c_TraceFileReader::c_TraceFileReader(SST::ComponentId_t x_id, SST::Params& x_par
 
 }
 
+c_TraceFileReader::~c_TraceFileReader()
+{
+    delete m_traceFileStream;
+#ifdef HAVE_LIBZ
+    delete m_blockTraceReader;
+#endif
+}
+
+
+bool c_TraceFileReader::readLine(std::string& x_line)
+{
+#ifdef HAVE_LIBZ
+    if(m_blockTraceReader)
+    {
+        if(m_blockTraceReader->readLine(x_line))
+            return true;
+
+        if(m_blockTraceReader->failed())
+        {
+            std::cerr << "TraceFileReader: block compressed trace " << m_traceFileName << " is corrupt... exiting" <<
+            std::endl;
+            exit(-1);
+        }
+        return false;
+    }
+#endif
+    return (bool) std::getline(*m_traceFileStream, x_line);
+}
+
 
 void c_TraceFileReader::createTxn()
 {
@@ -91,7 +144,7 @@ void c_TraceFileReader::createTxn()
     while(m_txnReqQ.size()<k_numTxnPerCycle)
     {
         std::string l_line;
-        if (std::getline(*m_traceFileStream, l_line)) {
+        if (readLine(l_line)) {
             char_delimiter sep(" ");
             Tokenizer<> l_tok(l_line, sep);
             unsigned l_numTokens = std::distance(l_tok.begin(), l_tok.end());
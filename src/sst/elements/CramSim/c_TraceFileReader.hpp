@@ -33,21 +33,27 @@
 
 
 namespace SST {
+    namespace Prospero {
+        class ProsperoBlockReader;
+    }
+
     namespace n_Bank {
         class c_TraceFileReader: public c_TxnGenBase {
         public:
             c_TraceFileReader(SST::ComponentId_t x_id, SST::Params& x_params);
-            ~c_TraceFileReader(){}
+            ~c_TraceFileReader();
         private:
             enum e_TracefileType{
                 DEFAULT,   //DRAMsim2 type
                 USIMM
             };
             virtual void createTxn();
+            bool readLine(std::string& x_line);
 
             //params for internal microarcitecture
             std::string m_traceFileName;
             std::ifstream *m_traceFileStream;
+            SST::Prospero::ProsperoBlockReader *m_blockTraceReader; // set instead of the stream for block compressed traces
 
             e_TracefileType m_traceType;
         };
@@ -33,6 +33,7 @@
 // std includes
 #include <iostream>
 #include <assert.h>
+#include <algorithm>
 
 // local includes
 #include "c_TxnScheduler.hpp"
@@ -51,6 +52,9 @@ c_TxnScheduler::c_TxnScheduler(SST::Component *owner, SST::Params& x_params) : S
     //initialize member variables
     m_numChannels = m_controller->getDeviceDriver()->getNumChannel();
     assert(m_numChannels>0);
+    m_numBanksPerChannel = m_controller->getDeviceDriver()->getTotalNumBank() / m_numChannels;
+    assert(m_numBanksPerChannel>0);
+    m_arrivalCount = 0;
 
     bool l_found=false;
 
@@ -66,6 +70,18 @@ c_TxnScheduler::c_TxnScheduler(SST::Component *owner, SST::Params& x_params) : S
     else if(l_txnSchedulingPolicy=="FRFCFS")
     {
         k_txnSchedulingPolicy=e_txnSchedulingPolicy::FRFCFS;
+    }
+    else if(l_txnSchedulingPolicy=="FRFCFS_CAP")
+    {
+        k_txnSchedulingPolicy=e_txnSchedulingPolicy::FRFCFS_CAP;
+    }
+    else if(l_txnSchedulingPolicy=="BLISS")
+    {
+        k_txnSchedulingPolicy=e_txnSchedulingPolicy::BLISS;
+    }
+    else if(l_txnSchedulingPolicy=="ATLAS")
+    {
+        k_txnSchedulingPolicy=e_txnSchedulingPolicy::ATLAS;
     } else
     {
         std::cout << "unsupported txnSchedulingPolicy ("<<l_txnSchedulingPolicy<<"),, exit"<< std::endl;
@@ -83,13 +99,73 @@ c_TxnScheduler::c_TxnScheduler(SST::Component *owner, SST::Params& x_params) : S
         std::cout << "boolReadFirstTxnScheduling value is missing... disabled" << std::endl;
     }
 
+    //multi-source policies: requests are attributed to a source by their address
+    k_numSources = (unsigned) x_params.find<unsigned>("numTxnSources", 1);
+    if (k_numSources == 0)
+        k_numSources = 1;
+    k_sourceAddrShift = (unsigned) x_params.find<unsigned>("txnSourceAddrShift", 30);
+    if (k_sourceAddrShift >= 64) {
+        std::cout << "txnSourceAddrShift value should be less than 64" << std::endl;
+        exit(1);
+    }
+
+    k_rowHitCap = (unsigned) x_params.find<unsigned>("rowHitCap", 4, l_found);
+    if (!l_found && k_txnSchedulingPolicy == e_txnSchedulingPolicy::FRFCFS_CAP) {
+        std::cout << "rowHitCap value is missing... it will be 4 (default)" << std::endl;
+    }
+
+    k_blacklistThreshold = (unsigned) x_params.find<unsigned>("blacklistThreshold", 4, l_found);
+    if (!l_found && k_txnSchedulingPolicy == e_txnSchedulingPolicy::BLISS) {
+        std::cout << "blacklistThreshold value is missing... it will be 4 (default)" << std::endl;
+    }
+    k_blacklistClearInterval = (SimTime_t) x_params.find<SimTime_t>("blacklistClearInterval", 10000, l_found);
+    if (!l_found && k_txnSchedulingPolicy == e_txnSchedulingPolicy::BLISS) {
+        std::cout << "blacklistClearInterval value is missing... it will be 10000 cycles (default)" << std::endl;
+    }
+
+    k_atlasQuantum = (SimTime_t) x_params.find<SimTime_t>("atlasQuantum", 10000, l_found);
+    if (!l_found && k_txnSchedulingPolicy == e_txnSchedulingPolicy::ATLAS) {
+        std::cout << "atlasQuantum value is missing... it will be 10000 cycles (default)" << std::endl;
+    }
+    k_atlasHistoryWeight = (double) x_params.find<double>("atlasHistoryWeight", 0.875);
+    if (k_atlasHistoryWeight < 0 || k_atlasHistoryWeight >= 1) {
+        std::cout << "atlasHistoryWeight value should be greater than or equal to 0 and less than one" << std::endl;
+        exit(1);
+    }
+    k_atlasStarvationThreshold = (SimTime_t) x_params.find<SimTime_t>("atlasStarvationThreshold", 50000);
+
+    if (k_blacklistClearInterval == 0 || k_atlasQuantum == 0) {
+        std::cout << "blacklistClearInterval and atlasQuantum values should be greater than 0" << std::endl;
+        exit(1);
+    }
+
+    m_blacklisted.resize(k_numSources, false);
+    m_lastSource = 0;
+    m_lastSourceStreak = 0;
+    m_nextBlacklistClear = k_blacklistClearInterval;
+    m_quantumService.resize(k_numSources, 0);
+    m_attainedService.resize(k_numSources, 0);
+    m_nextQuantum = k_atlasQuantum;
 
     //initialize per-channel transaction queues
+    c_TxnQueue l_emptyQueue;
+    l_emptyQueue.m_size = 0;
+    l_emptyQueue.m_banks.resize(m_numBanksPerChannel);
+    for (auto &l_bank : l_emptyQueue.m_banks) {
+        l_bank.m_rowHitStreak = 0;
+        if (k_txnSchedulingPolicy == e_txnSchedulingPolicy::BLISS || k_txnSchedulingPolicy == e_txnSchedulingPolicy::ATLAS)
+            l_bank.m_sources.resize(k_numSources);
+    }
+
+    m_pendingReads.resize(m_numChannels);
+    m_pendingWrites.resize(m_numChannels);
+    m_flushWriteQueue.resize(m_numChannels, false);
+
     if(!k_isReadFirstScheduling)
-        m_txnQ.resize(m_numChannels);
+        m_txnQ.resize(m_numChannels, l_emptyQueue);
     else {
-        m_txnReadQ.resize(m_numChannels);
-        m_txnWriteQ.resize(m_numChannels);
+        m_txnReadQ.resize(m_numChannels, l_emptyQueue);
+        m_txnWriteQ.resize(m_numChannels, l_emptyQueue);
 
         k_maxPendingWriteThreshold = (float) x_params.find<float>("maxPendingWriteThreshold", 1, l_found);
         if (!l_found) {
@@ -115,7 +191,6 @@ c_TxnScheduler::c_TxnScheduler(SST::Component *owner, SST::Params& x_params) : S
 
         m_maxNumPendingWrite = (unsigned) ((float) k_numTxnQEntries * k_maxPendingWriteThreshold);
         m_minNumPendingWrite = (unsigned) ((float) k_numTxnQEntries * k_minPendingWriteThreshold);
-        m_flushWriteQueue = false;
     }
 }
 
@@ -126,21 +201,23 @@ c_TxnScheduler::~c_TxnScheduler() {
 
 void c_TxnScheduler::run(){
 
+    updateQuantum(m_controller->getSimCycle());
 
     for(int l_channelID=0; l_channelID<m_numChannels; l_channelID++) {
 
         //0. select queue
-        TxnQueue* l_queue= nullptr;
+        c_TxnQueue* l_queue= nullptr;
         if(!k_isReadFirstScheduling) {
             l_queue = &(m_txnQ[l_channelID]);
         } else {
-            if (m_txnWriteQ[l_channelID].size() >= m_maxNumPendingWrite || m_txnReadQ[l_channelID].size()==0)
-                m_flushWriteQueue = true;
-            else if (m_txnWriteQ[l_channelID].size() < m_minNumPendingWrite && m_txnReadQ[l_channelID].size()!=0)
-                m_flushWriteQueue = false;
+            //drain writes once they pass the high watermark (or there is nothing to read) until they fall below the low watermark
+            if (m_txnWriteQ[l_channelID].m_size >= m_maxNumPendingWrite || m_txnReadQ[l_channelID].m_size==0)
+                m_flushWriteQueue[l_channelID] = true;
+            else if (m_txnWriteQ[l_channelID].m_size < m_minNumPendingWrite && m_txnReadQ[l_channelID].m_size!=0)
+                m_flushWriteQueue[l_channelID] = false;
 
 
-            if(m_flushWriteQueue) {
+            if(m_flushWriteQueue[l_channelID]) {
                     l_queue = &(m_txnWriteQ[l_channelID]);
             }
             else
@@ -150,22 +227,24 @@ void c_TxnScheduler::run(){
         assert(l_queue!=nullptr);
 
         //1. select a transaction from the transaction queue
-        c_Transaction* l_nextTxn=nullptr;
-        if(l_queue->size())
-            l_nextTxn=getNextTxn(*l_queue, l_channelID);
+        c_Candidate l_next;
+        bool l_hasNext=false;
+        if(l_queue->m_size)
+            l_hasNext=getNextTxn(*l_queue, l_channelID, l_next);
           //1.1. With read-first scheduling, we change the queue if there are no issuable transactions in the selected queue
-        if(k_isReadFirstScheduling && l_nextTxn== nullptr)
+        if(k_isReadFirstScheduling && !l_hasNext)
         {
-            if(m_flushWriteQueue ==true)
+            if(m_flushWriteQueue[l_channelID] ==true)
                 l_queue = &m_txnReadQ[l_channelID];
             else
                 l_queue = &m_txnWriteQ[l_channelID];
-            if(l_queue->size())
-                l_nextTxn=getNextTxn(*l_queue, l_channelID);
+            if(l_queue->m_size)
+                l_hasNext=getNextTxn(*l_queue, l_channelID, l_next);
         }
 
         //2. send the selected transaction to transaction converter
-        if(l_nextTxn!=nullptr) {
+        if(l_hasNext) {
+            c_Transaction* l_nextTxn = l_next.m_entry->m_txn;
             if(m_cmdScheduler->getToken(l_nextTxn->getHashedAddress())>=3) {
 
                 // send the selected transaction
@@ -175,8 +254,10 @@ void c_TxnScheduler::run(){
                 l_nextTxn->print(output, "[c_TxnScheduler]",m_controller->getSimCycle());
                 #endif
 
+                updateSourceState(l_next.m_entry->m_source);
+
                 // pop it from inputQ
-                popTxn(*l_queue, l_nextTxn);
+                popTxn(*l_queue, l_next);
 
             }
         }
@@ -184,144 +265,289 @@ void c_TxnScheduler::run(){
 }
 
 
-c_Transaction* c_TxnScheduler::getNextTxn(TxnQueue& x_queue, int x_ch)
+// Each bank offers its oldest transaction without a dependency and the oldest such
+// transaction to its open row. Every other issuable transaction in the bank is younger
+// than one of these with the same row-hit status, so FCFS and FR-FCFS would not pick it.
+// BLISS and ATLAS also rank by source, so there each source of the bank offers its own
+// oldest transaction and its own oldest transaction to the open row.
+bool c_TxnScheduler::getNextTxn(c_TxnQueue& x_queue, int x_ch, c_Candidate& x_next)
 {
 
-    assert(x_queue.size()!=0);
+    assert(x_queue.m_size!=0);
 
-        //get the next transaction
-        c_Transaction* l_nxtTxn = nullptr;
+        SimTime_t l_cycle = m_controller->getSimCycle();
+        bool l_found = false;
 
         //FCFS
         if(k_txnSchedulingPolicy == e_txnSchedulingPolicy::FCFS) {
-            if(m_cmdScheduler->getToken(x_queue.front()->getHashedAddress())>=3) {
-                if(hasDependancy(x_queue.front(), x_ch)==false)
-                    l_nxtTxn = x_queue.front();
+            c_BankTxnQueue* l_oldest = nullptr;
+            for (auto &l_bank: x_queue.m_banks) {
+                if (!l_bank.m_fifo.empty()
+                    && (l_oldest == nullptr || l_bank.m_fifo.front().m_arrival < l_oldest->m_fifo.front().m_arrival))
+                    l_oldest = &l_bank;
             }
-        }//FRFCFS
-        else if(k_txnSchedulingPolicy == e_txnSchedulingPolicy::FRFCFS) {
-            for (auto &l_txn: x_queue) {
-                if (m_cmdScheduler->getToken(l_txn->getHashedAddress()) >= 3) {
-                    if(hasDependancy(l_txn, x_ch)==false)
-                        l_nxtTxn = l_txn;
-                    else
-                        continue;
-
-                    c_BankInfo *l_bankInfo = m_txnConverter->getBankInfo(l_txn->getHashedAddress().getBankId());
-
-                    if (l_bankInfo->isRowOpen()
-                        && l_bankInfo->getOpenRowNum() == l_txn->getHashedAddress().getRow()) {
+            assert(l_oldest != nullptr);
+
+            const c_TxnEntry& l_entry = l_oldest->m_fifo.front();
+            if(m_cmdScheduler->getToken(l_entry.m_txn->getHashedAddress())>=3) {
+                if(hasDependancy(l_entry, x_ch)==false) {
+                    x_next.m_bank = l_oldest;
+                    x_next.m_entry = l_oldest->m_fifo.begin();
+                    x_next.m_isRowHit = false;
+                    l_found = true;
+                }
+            }
+        }//FRFCFS and multi-source policies
+        else {
+            for (auto &l_bank: x_queue.m_banks) {
+                if (l_bank.m_fifo.empty())
+                    continue;
+
+                const c_HashedAddress& l_addr = l_bank.m_fifo.front().m_txn->getHashedAddress();
+                if (m_cmdScheduler->getToken(l_addr) < 3)
+                    continue;
+
+                c_BankInfo *l_bankInfo = m_txnConverter->getBankInfo(l_addr.getBankId());
+                bool l_isRowOpen = l_bankInfo->isRowOpen();
+                unsigned l_openRow = l_bankInfo->getOpenRowNum();
+
+                c_Candidate l_cand;
+                l_cand.m_bank = &l_bank;
+
+                // oldest transactions, one per source with the multi-source policies
+                if (l_bank.m_sources.empty()) {
+                    for (auto l_itr = l_bank.m_fifo.begin(); l_itr != l_bank.m_fifo.end(); l_itr++) {
+                        if (hasDependancy(*l_itr, x_ch))
+                            continue;
+                        l_cand.m_entry = l_itr;
+                        l_cand.m_isRowHit = l_isRowOpen && l_openRow == l_itr->m_txn->getHashedAddress().getRow();
+                        offerCandidate(l_cand, x_next, l_found, l_cycle);
                         break;
                     }
+                } else {
+                    for (auto &l_source: l_bank.m_sources) {
+                        for (auto &l_itr: l_source) {
+                            if (hasDependancy(*l_itr, x_ch))
+                                continue;
+                            l_cand.m_entry = l_itr;
+                            l_cand.m_isRowHit = l_isRowOpen && l_openRow == l_itr->m_txn->getHashedAddress().getRow();
+                            offerCandidate(l_cand, x_next, l_found, l_cycle);
+                            break;
+                        }
+                    }
+                }
+
+                // a younger row hit may bypass them, with capped FR-FCFS only a limited number of times in a row
+                if (!l_isRowOpen
+                    || (k_txnSchedulingPolicy == e_txnSchedulingPolicy::FRFCFS_CAP && l_bank.m_rowHitStreak >= k_rowHitCap))
+                    continue;
+
+                auto l_rowItr = l_bank.m_rows.find(l_openRow);
+                if (l_rowItr == l_bank.m_rows.end())
+                    continue;
+
+                l_cand.m_isRowHit = true;
+                if (l_bank.m_sources.empty()) {
+                    for (auto &l_itr: l_rowItr->second) {
+                        if (hasDependancy(*l_itr, x_ch))
+                            continue;
+                        l_cand.m_entry = l_itr;
+                        offerCandidate(l_cand, x_next, l_found, l_cycle);
+                        break;
+                    }
+                } else {
+                    m_sourceOffered.assign(k_numSources, false);
+                    unsigned l_left = k_numSources;
+                    for (auto &l_itr: l_rowItr->second) {
+                        if (m_sourceOffered[l_itr->m_source] || hasDependancy(*l_itr, x_ch))
+                            continue;
+                        m_sourceOffered[l_itr->m_source] = true;
+                        l_cand.m_entry = l_itr;
+                        offerCandidate(l_cand, x_next, l_found, l_cycle);
+                        if (--l_left == 0)
+                            break;
+                    }
                 }
             }
         }
-        else
-        {
-            printf("unsupported transaction scheduling policy.. exit(1)");
-            exit(1);
-        }
 
-        return l_nxtTxn;
+        return l_found;
 }
 
 
-void c_TxnScheduler::popTxn(TxnQueue &x_txnQ, c_Transaction* x_Txn)
+void c_TxnScheduler::offerCandidate(const c_Candidate& x_cand, c_Candidate& x_next, bool& x_found, SimTime_t x_cycle) const
 {
-    x_txnQ.remove(x_Txn);
+    if (!x_found || isBetter(x_cand, x_next, x_cycle)) {
+        x_next = x_cand;
+        x_found = true;
+    }
 }
 
-bool c_TxnScheduler::push(c_Transaction* newTxn)
+
+bool c_TxnScheduler::isBetter(const c_Candidate& x_a, const c_Candidate& x_b, SimTime_t x_cycle) const
 {
-    int l_channelId=newTxn->getHashedAddress().getChannel();
-    bool l_success=false;
-    if(!k_isReadFirstScheduling)
-    {
-        if (m_txnQ.at(l_channelId).size() < k_numTxnQEntries) {
-            m_txnQ.at(l_channelId).push_back(newTxn);
-            l_success=true;
-        } else
-            l_success=false;
-    }else
-    {
-        if(newTxn->isRead())
-        {
-            if(m_txnReadQ[l_channelId].size()< k_numTxnQEntries) {
-                m_txnReadQ[l_channelId].push_back(newTxn);
-                l_success = true;
-            }
-            else
-                l_success=false;
-        } else
-        {
-            if(m_txnWriteQ[l_channelId].size()< k_numTxnQEntries) {
-                l_success=true;
-                m_txnWriteQ[l_channelId].push_back(newTxn);
-            }else
-                l_success=false;
-        }
+    const c_TxnEntry& l_a = *x_a.m_entry;
+    const c_TxnEntry& l_b = *x_b.m_entry;
+
+    if (k_txnSchedulingPolicy == e_txnSchedulingPolicy::BLISS) {
+        // sources that were recently served many times in a row are deprioritized
+        bool l_aListed = m_blacklisted[l_a.m_source];
+        bool l_bListed = m_blacklisted[l_b.m_source];
+        if (l_aListed != l_bListed)
+            return !l_aListed;
+    } else if (k_txnSchedulingPolicy == e_txnSchedulingPolicy::ATLAS) {
+        // starving requests first (oldest first), then the source that has attained the least service
+        bool l_aStarving = x_cycle - l_a.m_arrivalCycle > k_atlasStarvationThreshold;
+        bool l_bStarving = x_cycle - l_b.m_arrivalCycle > k_atlasStarvationThreshold;
+        if (l_aStarving != l_bStarving)
+            return l_aStarving;
+        if (l_aStarving)
+            return l_a.m_arrival < l_b.m_arrival;
+        if (m_attainedService[l_a.m_source] != m_attainedService[l_b.m_source])
+            return m_attainedService[l_a.m_source] < m_attainedService[l_b.m_source];
     }
-    return l_success;
+
+    if (x_a.m_isRowHit != x_b.m_isRowHit)
+        return x_a.m_isRowHit;
+    return l_a.m_arrival < l_b.m_arrival;
 }
 
 
-//Check if read transactions get data from the transaction queue
-bool c_TxnScheduler::isHit(c_Transaction* x_txn)
+unsigned c_TxnScheduler::getSource(c_Transaction* x_txn) const
 {
-    int l_channelId=x_txn->getHashedAddress().getChannel();
-    TxnQueue* l_queue=nullptr;
-    bool l_isRead = x_txn->isRead();
-    bool l_isHit = false;
+    return (unsigned) ((x_txn->getAddress() >> k_sourceAddrShift) % k_numSources);
+}
 
-    if(l_isRead)
-    {
-        if(!k_isReadFirstScheduling) {
-            l_queue = &m_txnQ.at(l_channelId);
 
-        } else{
-            l_queue = &m_txnWriteQ.at(l_channelId);
+void c_TxnScheduler::updateSourceState(unsigned x_source)
+{
+    if (k_txnSchedulingPolicy == e_txnSchedulingPolicy::BLISS) {
+        if (x_source == m_lastSource) {
+            m_lastSourceStreak++;
+        } else {
+            m_lastSource = x_source;
+            m_lastSourceStreak = 1;
         }
+        if (m_lastSourceStreak >= k_blacklistThreshold)
+            m_blacklisted[x_source] = true;
+    } else if (k_txnSchedulingPolicy == e_txnSchedulingPolicy::ATLAS) {
+        m_quantumService[x_source]++;
+    }
+}
 
-        //traverse the transaction queue in reverse order
-        for (TxnQueue::reverse_iterator l_txnItr = l_queue->rbegin(); l_txnItr != l_queue->rend(); ++l_txnItr) {
-            c_Transaction *l_txn = *l_txnItr;
 
-            if (l_txn->isWrite() && (l_txn->getAddress() == x_txn->getAddress())) {
-                l_isHit = true;
-                break;
-            }
+void c_TxnScheduler::updateQuantum(SimTime_t x_cycle)
+{
+    if (k_txnSchedulingPolicy == e_txnSchedulingPolicy::BLISS && x_cycle >= m_nextBlacklistClear) {
+        std::fill(m_blacklisted.begin(), m_blacklisted.end(), false);
+        m_nextBlacklistClear = x_cycle + k_blacklistClearInterval;
+    } else if (k_txnSchedulingPolicy == e_txnSchedulingPolicy::ATLAS && x_cycle >= m_nextQuantum) {
+        for (unsigned l_src = 0; l_src < k_numSources; l_src++) {
+            m_attainedService[l_src] = k_atlasHistoryWeight * m_attainedService[l_src]
+                                       + (1 - k_atlasHistoryWeight) * (double) m_quantumService[l_src];
+            m_quantumService[l_src] = 0;
         }
+        m_nextQuantum = x_cycle + k_atlasQuantum;
     }
+}
+
+
+void c_TxnScheduler::popTxn(c_TxnQueue &x_txnQ, const c_Candidate& x_cand)
+{
+    c_BankTxnQueue& l_bank = *x_cand.m_bank;
+    c_Transaction* l_txn = x_cand.m_entry->m_txn;
+    unsigned l_ch = l_txn->getHashedAddress().getChannel();
+
+    // a candidate is usually the oldest transaction to its row, but may have passed older ones with a dependency
+    auto l_rowItr = l_bank.m_rows.find(l_txn->getHashedAddress().getRow());
+    assert(l_rowItr != l_bank.m_rows.end());
+    eraseEntry(l_rowItr->second, x_cand.m_entry);
+    if (l_rowItr->second.empty())
+        l_bank.m_rows.erase(l_rowItr);
+
+    if (!l_bank.m_sources.empty())
+        eraseEntry(l_bank.m_sources[x_cand.m_entry->m_source], x_cand.m_entry);
+
+    // older transactions of the same type to its address would have the same dependency, so it is always the oldest to it
+    auto& l_pending = l_txn->isRead() ? m_pendingReads[l_ch] : m_pendingWrites[l_ch];
+    auto l_addrItr = l_pending.find(l_txn->getAddress());
+    assert(l_addrItr != l_pending.end() && l_addrItr->second.front() == x_cand.m_entry->m_arrival);
+    l_addrItr->second.pop_front();
+    if (l_addrItr->second.empty())
+        l_pending.erase(l_addrItr);
+
+    // only a row hit that bypasses an older transaction counts towards the cap
+    if (x_cand.m_isRowHit && x_cand.m_entry != l_bank.m_fifo.begin())
+        l_bank.m_rowHitStreak++;
+    else
+        l_bank.m_rowHitStreak = 0;
 
-    return l_isHit;
+    l_bank.m_fifo.erase(x_cand.m_entry);
+    x_txnQ.m_size--;
 }
 
-bool c_TxnScheduler::hasDependancy(c_Transaction *x_txn, int x_ch)
+
+void c_TxnScheduler::eraseEntry(std::deque<TxnList::iterator>& x_index, TxnList::iterator x_entry)
 {
-    TxnQueue* l_queue= nullptr;
-    bool l_hasDependancy = false;
+    auto l_pos = std::find(x_index.begin(), x_index.end(), x_entry);
+    assert(l_pos != x_index.end());
+    x_index.erase(l_pos);
+}
+
+bool c_TxnScheduler::push(c_Transaction* newTxn)
+{
+    int l_channelId=newTxn->getHashedAddress().getChannel();
+    c_TxnQueue* l_queue=nullptr;
 
     if(!k_isReadFirstScheduling)
-        l_queue=&m_txnQ[x_ch];
+        l_queue = &m_txnQ.at(l_channelId);
+    else if(newTxn->isRead())
+        l_queue = &m_txnReadQ.at(l_channelId);
     else
-    {
-        if(x_txn->isRead())
-            l_queue = &m_txnWriteQ[x_ch];
-        else
-            l_queue= &m_txnReadQ[x_ch];
-    }
+        l_queue = &m_txnWriteQ.at(l_channelId);
+
+    if(l_queue->m_size >= k_numTxnQEntries)
+        return false;
+
+    c_TxnEntry l_entry;
+    l_entry.m_txn = newTxn;
+    l_entry.m_arrival = m_arrivalCount++;
+    l_entry.m_arrivalCycle = m_controller->getSimCycle();
+    l_entry.m_source = getSource(newTxn);
+
+    c_BankTxnQueue& l_bank = l_queue->m_banks[newTxn->getHashedAddress().getBankId() % m_numBanksPerChannel];
+    TxnList::iterator l_itr = l_bank.m_fifo.insert(l_bank.m_fifo.end(), l_entry);
+    l_bank.m_rows[newTxn->getHashedAddress().getRow()].push_back(l_itr);
+    if (!l_bank.m_sources.empty())
+        l_bank.m_sources[l_entry.m_source].push_back(l_itr);
+    l_queue->m_size++;
+
+    if(newTxn->isRead())
+        m_pendingReads[l_channelId][newTxn->getAddress()].push_back(l_entry.m_arrival);
+    else
+        m_pendingWrites[l_channelId][newTxn->getAddress()].push_back(l_entry.m_arrival);
 
-    for(auto &l_txn: *l_queue)
-    {
-        if(l_txn->getAddress()==x_txn->getAddress()
-           && l_txn->getSeqNum()<x_txn->getSeqNum())
-            l_hasDependancy = true;
+    return true;
+}
 
-        if(l_txn->getSeqNum()>=x_txn->getSeqNum())
-            break;
-    }
 
-    return l_hasDependancy;
+//Check if read transactions get data from the transaction queue
+bool c_TxnScheduler::isHit(c_Transaction* x_txn)
+{
+    int l_channelId=x_txn->getHashedAddress().getChannel();
+
+    if(x_txn->isRead())
+        return m_pendingWrites.at(l_channelId).count(x_txn->getAddress()) != 0;
+
+    return false;
 }
 
+// A transaction depends on an older queued transaction of the other type to the same address.
+// Older transactions of the same type to the same address are ahead of it in its row queue.
+bool c_TxnScheduler::hasDependancy(const c_TxnEntry& x_entry, int x_ch)
+{
+    auto& l_other = x_entry.m_txn->isRead() ? m_pendingWrites[x_ch] : m_pendingReads[x_ch];
+    auto l_itr = l_other.find(x_entry.m_txn->getAddress());
 
+    return l_itr != l_other.end() && l_itr->second.front() < x_entry.m_arrival;
+}
@@ -31,6 +31,11 @@
 #ifndef C_TXNSCHEDULER_HPP
 #define C_TXNSCHEDULER_HPP
 
+#include <list>
+#include <deque>
+#include <vector>
+#include <unordered_map>
+
 #include "c_Transaction.hpp"
 #include "c_TxnConverter.hpp"
 #include "c_Controller.hpp"
@@ -42,8 +47,30 @@ namespace SST {
         class c_TxnConverter;
         class c_Controller;
 
-        enum class e_txnSchedulingPolicy {FCFS, FRFCFS};
-        typedef std::list<c_Transaction*> TxnQueue;
+        enum class e_txnSchedulingPolicy {FCFS, FRFCFS, FRFCFS_CAP, BLISS, ATLAS};
+
+        //**queued transaction with the scheduling state it is ranked by
+        struct c_TxnEntry {
+            c_Transaction* m_txn;
+            uint64_t m_arrival;         // arrival order
+            SimTime_t m_arrivalCycle;
+            unsigned m_source;
+        };
+        typedef std::list<c_TxnEntry> TxnList;
+
+        //**per-bank transaction queue, indexed by row so that a row hit is found without a scan
+        struct c_BankTxnQueue {
+            TxnList m_fifo;                                                     // arrival order
+            std::unordered_map<unsigned, std::deque<TxnList::iterator> > m_rows; // arrival order per row
+            std::vector<std::deque<TxnList::iterator> > m_sources;              // arrival order per source, BLISS and ATLAS only
+            unsigned m_rowHitStreak;                                            // consecutive row hits issued
+        };
+
+        //**per-channel transaction queue
+        struct c_TxnQueue {
+            std::vector<c_BankTxnQueue> m_banks;
+            unsigned m_size;
+        };
 
         class c_TxnScheduler: public SubComponent{
         public:
@@ -57,9 +84,22 @@ namespace SST {
 
 
         private:
-            virtual c_Transaction* getNextTxn(TxnQueue& x_queue, int x_ch);
-            virtual bool hasDependancy(c_Transaction* x_txn, int x_ch);
-            virtual void popTxn(TxnQueue& x_queue, c_Transaction* x_txn);
+            struct c_Candidate {
+                c_BankTxnQueue* m_bank;
+                TxnList::iterator m_entry;
+                bool m_isRowHit;
+            };
+
+            virtual bool getNextTxn(c_TxnQueue& x_queue, int x_ch, c_Candidate& x_next);
+            virtual bool hasDependancy(const c_TxnEntry& x_entry, int x_ch);
+            virtual void popTxn(c_TxnQueue& x_queue, const c_Candidate& x_cand);
+
+            bool isBetter(const c_Candidate& x_a, const c_Candidate& x_b, SimTime_t x_cycle) const;
+            void offerCandidate(const c_Candidate& x_cand, c_Candidate& x_next, bool& x_found, SimTime_t x_cycle) const;
+            void eraseEntry(std::deque<TxnList::iterator>& x_index, TxnList::iterator x_entry);
+            unsigned getSource(c_Transaction* x_txn) const;
+            void updateSourceState(unsigned x_source);
+            void updateQuantum(SimTime_t x_cycle);
 
             //**Controller
             c_Controller * m_controller;
@@ -69,16 +109,34 @@ namespace SST {
             c_CmdScheduler* m_cmdScheduler;
 
             //**per-channel transaction queue
-            std::vector<TxnQueue> m_txnQ;      // unified queue
+            std::vector<c_TxnQueue> m_txnQ;      // unified queue
             //**per-channel tranaction queues for read-first scheduling
-            std::vector<TxnQueue> m_txnReadQ;  // read queue for read-first scheduling
-            std::vector<TxnQueue> m_txnWriteQ; // write queue for read-first scheduling
+            std::vector<c_TxnQueue> m_txnReadQ;  // read queue for read-first scheduling
+            std::vector<c_TxnQueue> m_txnWriteQ; // write queue for read-first scheduling
             unsigned m_maxNumPendingWrite;
             unsigned m_minNumPendingWrite;
 
+            //**per-channel arrival order of queued reads and writes to each address, for dependency checks and quick response
+            std::vector<std::unordered_map<ulong, std::deque<uint64_t> > > m_pendingReads;
+            std::vector<std::unordered_map<ulong, std::deque<uint64_t> > > m_pendingWrites;
+
             Output *output;
             unsigned m_numChannels;
-            bool m_flushWriteQueue;
+            unsigned m_numBanksPerChannel;
+            std::vector<bool> m_flushWriteQueue;
+            uint64_t m_arrivalCount;
+
+            //**BLISS state
+            std::vector<bool> m_blacklisted;
+            std::vector<bool> m_sourceOffered;   // sources that already offered an open-row candidate
+            unsigned m_lastSource;
+            unsigned m_lastSourceStreak;
+            SimTime_t m_nextBlacklistClear;
+
+            //**ATLAS state
+            std::vector<uint64_t> m_quantumService;
+            std::vector<double> m_attainedService;
+            SimTime_t m_nextQuantum;
 
             //parameters
             e_txnSchedulingPolicy k_txnSchedulingPolicy;
@@ -86,6 +144,14 @@ namespace SST {
             float k_maxPendingWriteThreshold;
             float k_minPendingWriteThreshold;
             bool k_isReadFirstScheduling;
+            unsigned k_rowHitCap;
+            unsigned k_numSources;
+            unsigned k_sourceAddrShift;
+            unsigned k_blacklistThreshold;
+            SimTime_t k_blacklistClearInterval;
+            SimTime_t k_atlasQuantum;
+            double k_atlasHistoryWeight;
+            SimTime_t k_atlasStarvationThreshold;
 
         };
     }
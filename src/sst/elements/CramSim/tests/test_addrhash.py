@@ -0,0 +1,82 @@
+import subprocess
+import sys
+
+# Runs a trace with XOR hashing of the bank group and bank address bits.
+#
+# strAddressPermuteFields=Bb and an strAddressXorMap that names the same row
+# bits explicitly describe the same mapping, so their output has to match.
+# The hashed runs also have to differ from the run without hashing, or the
+# hash did not reach the banks.
+#
+# Run from within CramSim/:
+#   python ./tests/test_addrhash.py [TRACE_FILE TRACE_FILE_TYPE]
+
+# GLOBAL PARAMS
+config_file = "ddr4_verimem.cfg"
+trace_file = "traces/usimm.trc"
+trace_file_type = "USIMM"
+if len(sys.argv) > 2:
+    trace_file = sys.argv[1]
+    trace_file_type = sys.argv[2]
+
+# ddr4_verimem.cfg maps _r_l_R_B_b_h_ with 15 row, 11 column, 1 rank,
+# 2 bank group, 2 bank and 5 byte bits, so the row starts at address bit 21.
+# Permuting "Bb" XORs the bank group bits with row bits 0-1 and the bank bits
+# with row bits 2-3.
+permute_fields = "Bb"
+xor_map = "B0:21;B1:22;b0:23;b1:24"
+
+def run_trace(overrides):
+    # set the command
+    sstCmd = "sst --lib-path=.libs/ tests/test_txntrace.py --model-options=\""
+    sstParams = "--configfile=" + config_file + " traceFile=" + trace_file + " traceFileType=" + trace_file_type + overrides + "\""
+
+    osCmd = sstCmd + sstParams
+    print osCmd
+
+    # run SST
+    p = subprocess.Popen(osCmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE, shell=True)
+    output, err = p.communicate()
+
+    if p.returncode != 0:
+        print "SST failed: ", err
+        sys.exit(1)
+
+    # the runs only differ in the overrides
+    outputLines = list()
+    for line in output.split("\n"):
+        if line.find("Override") == -1:
+            outputLines.append(line)
+
+    return outputLines
+
+plainOutput = run_trace("")
+permuteOutput = run_trace(" strAddressPermuteFields=" + permute_fields)
+xorOutput = run_trace(" strAddressXorMap=" + xor_map)
+
+results = ""
+failed = False
+
+if permuteOutput == xorOutput:
+    results += "[v] strAddressPermuteFields=" + permute_fields + " matches strAddressXorMap=" + xor_map + "\n"
+else:
+    results += "[x] strAddressPermuteFields=" + permute_fields + " matches strAddressXorMap=" + xor_map + "\n"
+    failed = True
+    for permuteLine, xorLine in zip(permuteOutput, xorOutput):
+        if permuteLine != xorLine:
+            results += "    permute: " + permuteLine + "\n"
+            results += "    xor:     " + xorLine + "\n"
+            break
+
+if permuteOutput != plainOutput:
+    results += "[v] Hashed mapping differs from the plain mapping\n"
+else:
+    results += "[x] Hashed mapping differs from the plain mapping\n"
+    failed = True
+
+print "-----RUNNING ADDRESS HASH-----"
+print(results)
+print("done.\n")
+
+if failed:
+    sys.exit(1)
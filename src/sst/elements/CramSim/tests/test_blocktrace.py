@@ -0,0 +1,77 @@
+import subprocess
+import sys
+
+# Replays a trace from the block compressed container and checks that the
+# output matches the run on the plain text trace, with the blocks decoded on
+# the simulation thread and on worker threads.
+#
+# Run from within CramSim/ with sst-prospero-convert on the PATH:
+#   python ./tests/test_blocktrace.py [TRACE_FILE TRACE_FILE_TYPE]
+
+# GLOBAL PARAMS
+config_file = "ddr4_verimem.cfg"
+trace_file = "traces/usimm.trc"
+trace_file_type = "USIMM"
+if len(sys.argv) > 2:
+    trace_file = sys.argv[1]
+    trace_file_type = sys.argv[2]
+block_file = trace_file + ".blk"
+
+# small blocks so even a short trace spans several of them
+block_size = "4096"
+
+def run_trace(trace, overrides):
+    # set the command
+    sstCmd = "sst --lib-path=.libs/ tests/test_txntrace.py --model-options=\""
+    sstParams = "--configfile=" + config_file + " traceFile=" + trace + " traceFileType=" + trace_file_type + overrides + "\""
+
+    osCmd = sstCmd + sstParams
+    print osCmd
+
+    # run SST
+    p = subprocess.Popen(osCmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE, shell=True)
+    output, err = p.communicate()
+
+    if p.returncode != 0:
+        print "SST failed: ", err
+        sys.exit(1)
+
+    # the runs only differ in the name of the trace and the decoder overrides
+    outputLines = list()
+    for line in output.replace(block_file, trace_file).split("\n"):
+        if line.find("decodeThreads") == -1:
+            outputLines.append(line)
+
+    return outputLines
+
+# copy the trace into the container, -c checks it decodes back to the trace
+convertCmd = ["sst-prospero-convert", "-i", trace_file, "-f", "raw", "-o", block_file, "-t", "block", "-b", block_size, "-c"]
+print " ".join(convertCmd)
+if subprocess.call(convertCmd) != 0:
+    print "Unable to convert", trace_file, "to a block trace"
+    sys.exit(1)
+
+textOutput = run_trace(trace_file, "")
+
+results = ""
+failed = False
+for decodeThreads in ["0", "2"]:
+    blockOutput = run_trace(block_file, " decodeThreads=" + decodeThreads)
+
+    if blockOutput == textOutput:
+        results += "[v] Block trace, decodeThreads=" + decodeThreads + "\n"
+    else:
+        results += "[x] Block trace, decodeThreads=" + decodeThreads + "\n"
+        failed = True
+        for textLine, blockLine in zip(textOutput, blockOutput):
+            if textLine != blockLine:
+                results += "    text:  " + textLine + "\n"
+                results += "    block: " + blockLine + "\n"
+                break
+
+print "-----RUNNING BLOCK TRACE-----"
+print(results)
+print("done.\n")
+
+if failed:
+    sys.exit(1)
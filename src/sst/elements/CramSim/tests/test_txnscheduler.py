@@ -0,0 +1,99 @@
+import subprocess
+import sys
+
+# Runs a trace with the FRFCFS_CAP, BLISS and ATLAS transaction schedulers.
+#
+# Each policy is first run with settings under which it must make the same
+# choices as FRFCFS (a cap that is never reached, a single request source and
+# no starvation), and the output has to match the FRFCFS run. It is then run
+# with its own settings and four request sources and has to finish having
+# answered transactions.
+#
+# Run from within CramSim/:
+#   python ./tests/test_txnscheduler.py [TRACE_FILE TRACE_FILE_TYPE]
+
+# GLOBAL PARAMS
+config_file = "ddr4_verimem.cfg"
+trace_file = "traces/usimm.trc"
+trace_file_type = "USIMM"
+if len(sys.argv) > 2:
+    trace_file = sys.argv[1]
+    trace_file_type = sys.argv[2]
+
+def run_policy(policy, overrides):
+    # set the command
+    sstCmd = "sst --lib-path=.libs/ tests/test_txntrace.py --model-options=\""
+    sstParams = "--configfile=" + config_file + " traceFile=" + trace_file + " traceFileType=" + trace_file_type + " txnSchedulingPolicy=" + policy + overrides + "\""
+
+    osCmd = sstCmd + sstParams
+    print osCmd
+
+    # run SST
+    p = subprocess.Popen(osCmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE, shell=True)
+    output, err = p.communicate()
+
+    if p.returncode != 0:
+        print "SST failed: ", err
+        sys.exit(1)
+
+    # the runs only differ in the overrides and the defaults reported for parameters they leave out
+    outputLines = list()
+    for line in output.split("\n"):
+        if line.find("Override") == -1 and line.find("is missing") == -1:
+            outputLines.append(line)
+
+    return outputLines
+
+def get_count(outputLines, key):
+    for line in outputLines:
+        if line.find(key) != -1:
+            return int(line[line.find(key)+len(key):])
+    return -1
+
+frfcfsOutput = run_policy("FRFCFS", "")
+
+results = ""
+failed = False
+
+# settings that reduce each policy to FRFCFS
+degenerate = [
+    ("FRFCFS_CAP", " rowHitCap=1000000000"),
+    ("BLISS", " numTxnSources=1"),
+    ("ATLAS", " numTxnSources=1 atlasStarvationThreshold=1000000000000")]
+
+for policy, overrides in degenerate:
+    policyOutput = run_policy(policy, overrides)
+
+    if policyOutput == frfcfsOutput:
+        results += "[v] " + policy + " matches FRFCFS (" + overrides.strip() + ")\n"
+    else:
+        results += "[x] " + policy + " matches FRFCFS (" + overrides.strip() + ")\n"
+        failed = True
+        for frfcfsLine, policyLine in zip(frfcfsOutput, policyOutput):
+            if frfcfsLine != policyLine:
+                results += "    FRFCFS:  " + frfcfsLine + "\n"
+                results += "    " + policy + ": " + policyLine + "\n"
+                break
+
+# the policies' own settings, with the sources interleaved every 4KiB
+own = [
+    ("FRFCFS_CAP", " rowHitCap=2"),
+    ("BLISS", " numTxnSources=4 txnSourceAddrShift=12 blacklistThreshold=4 blacklistClearInterval=1000"),
+    ("ATLAS", " numTxnSources=4 txnSourceAddrShift=12 atlasQuantum=1000 atlasStarvationThreshold=5000")]
+
+for policy, overrides in own:
+    policyOutput = run_policy(policy, overrides)
+
+    received = get_count(policyOutput, "Total Txns Received: ")
+    if received > 0:
+        results += "[v] " + policy + " answered " + str(received) + " transactions (" + overrides.strip() + ")\n"
+    else:
+        results += "[x] " + policy + " answered no transactions (" + overrides.strip() + ")\n"
+        failed = True
+
+print "-----RUNNING TXN SCHEDULER-----"
+print(results)
+print("done.\n")
+
+if failed:
+    sys.exit(1)
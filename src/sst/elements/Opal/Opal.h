@@ -112,6 +112,10 @@ namespace SST
 					SST_ELI_DOCUMENT_STATISTICS(
 							{ "local_mem_usage", "Number of local memory frames used", "requests", 1},
 							{ "shared_mem_usage", "Number of local memory frames used", "requests", 1},
+							{ "local_mem_free_extents", "Number of runs of free frames in a local memory pool at the end of simulation", "extents", 1},
+							{ "shared_mem_free_extents", "Number of runs of free frames in a shared memory pool at the end of simulation", "extents", 1},
+							{ "local_mem_largest_free_extent", "Largest run of free frames in a local memory pool at the end of simulation", "frames", 1},
+							{ "shared_mem_largest_free_extent", "Largest run of free frames in a shared memory pool at the end of simulation", "frames", 1},
 							)
 
 					SST_ELI_DOCUMENT_PORTS(
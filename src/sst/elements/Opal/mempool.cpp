@@ -20,6 +20,8 @@
 
 #include "mempool.h"
 
+#include <algorithm>
+
 
 //Constructor for pool
 Pool::Pool(SST::Component* own, Params params, SST::OpalComponent::MemType mem_type, int id)
@@ -42,10 +44,14 @@ Pool::Pool(SST::Component* own, Params params, SST::OpalComponent::MemType mem_t
 	if(memType == SST::OpalComponent::MemType::LOCAL) {
 		localMemID = id;
 		memUsage = own->registerStatistic<uint64_t>( "local_mem_usage", subID );
+		freeExtents = own->registerStatistic<uint64_t>( "local_mem_free_extents", subID );
+		largestFreeExtent = own->registerStatistic<uint64_t>( "local_mem_largest_free_extent", subID );
 	}
 	else {
 		sharedMemID = id;
 		memUsage = own->registerStatistic<uint64_t>( "shared_mem_usage", subID );
+		freeExtents = own->registerStatistic<uint64_t>( "shared_mem_free_extents", subID );
+		largestFreeExtent = own->registerStatistic<uint64_t>( "shared_mem_largest_free_extent", subID );
 	}
 
 	free(subID);
@@ -73,69 +79,214 @@ Pool::Pool(SST::Component* own, Params params, SST::OpalComponent::MemType mem_t
 //Create free frames of size framesize, note that the size is in KB
 void Pool::build_mem()
 {
-	int i=0;
-	Frame *frame;
 	num_frames = ceil(size/frsize);
 	real_size = num_frames * frsize;
 
-	for(i=0; i< num_frames; i++) {
-		frame = new Frame(((long long int) i*frsize*1024) + start, 0);
-		freelist.push_back(frame);
-	}
+	// Only the bitmaps are built here, one bit per frame, so start-up cost and footprint stay small for large pools
+	uint64_t words = ((uint64_t) num_frames + 63) >> 6;
+	uint64_t groups = (words + 63) >> 6;
+
+	freeBits.assign(words, ~0ULL);
+	freeWords.assign(groups, ~0ULL);
+	freeGroups.assign((groups + 63) >> 6, ~0ULL);
+
+	// Clear the bits past the last frame (or word, or group) so they never look free
+	if(num_frames & 63)
+		freeBits[words - 1] = (1ULL << (num_frames & 63)) - 1;
+	if(words & 63)
+		freeWords[groups - 1] = (1ULL << (words & 63)) - 1;
+	if(groups & 63)
+		freeGroups[freeGroups.size() - 1] = (1ULL << (groups & 63)) - 1;
 
 	available_frames = num_frames;
+	num_free_extents = num_frames ? 1 : 0;
+	lowest_free = 0;
 
 	return;
 
 }
 
-MemPoolResponse Pool::allocate_frames(int _size)
+void Pool::finish()
 {
+	freeExtents->addData(num_free_extents);
+	largestFreeExtent->addData(largest_free_extent());
+}
 
-	MemPoolResponse mpr;
-	int frames = ceil(_size/(frsize*1024));
-	std::list<Frame*> frames_allocated;
+int64_t Pool::find_free(uint64_t from)
+{
+	if(from >= (uint64_t) num_frames)
+		return -1;
 
-	if(available_frames < frames) {
-		mpr.pAddress = -1;
-		return mpr;
+	// Rest of the word holding 'from'
+	uint64_t word = from >> 6;
+	uint64_t bits = freeBits[word] & (~0ULL << (from & 63));
+	if(bits)
+		return (word << 6) + __builtin_ctzll(bits);
+
+	// Next word with a free frame, within the same group
+	uint64_t next = word + 1;
+	uint64_t group = next >> 6;
+	if(group < freeWords.size()) {
+		bits = freeWords[group] & (~0ULL << (next & 63));
+		if(bits) {
+			word = (group << 6) + __builtin_ctzll(bits);
+			return (word << 6) + __builtin_ctzll(freeBits[word]);
+		}
 	}
 
-	// Fixme: Shuffle memory to make continuous memory available
-	while(frames) {
-		// Make sure pool has free frames in the requested memory pool type. If not deallocate allocated frames (if number of frames to be allocated are > 1)
-		if(freelist.empty()) {
-			while(!frames_allocated.empty()) {
-				Frame *frame = frames_allocated.front();
-				freelist.push_back(frame);
-				alloclist.erase(frame->starting_address);
-				frames_allocated.pop_front();
-				available_frames++;
-			}
-			mpr.pAddress = -1;
-			break;
+	// Next group with a free frame
+	next = group + 1;
+	for(uint64_t top = next >> 6; top < freeGroups.size(); top++, next = top << 6) {
+		bits = freeGroups[top] & (~0ULL << (next & 63));
+		if(bits) {
+			group = (top << 6) + __builtin_ctzll(bits);
+			word = (group << 6) + __builtin_ctzll(freeWords[group]);
+			return (word << 6) + __builtin_ctzll(freeBits[word]);
+		}
+	}
+
+	return -1;
+}
+
+int64_t Pool::first_free()
+{
+	int64_t frame = find_free(lowest_free);
+
+	// Every frame before the one found is allocated, so later searches can start there
+	lowest_free = (frame < 0) ? (uint64_t) num_frames : (uint64_t) frame;
+
+	return frame;
+}
+
+int64_t Pool::find_allocated(uint64_t from, uint64_t to)
+{
+	while(from < to) {
+		uint64_t word = from >> 6;
+		uint64_t bits = ~freeBits[word] & (~0ULL << (from & 63));
+		if(bits) {
+			uint64_t frame = (word << 6) + __builtin_ctzll(bits);
+			return (frame < to) ? (int64_t) frame : -1;
 		}
-		else
-		{
-			Frame *frame = freelist.front();
-			freelist.pop_front();
-			alloclist[frame->starting_address] = frame;
-			frames_allocated.push_back(frame);
-			available_frames--;
+		from = (word + 1) << 6;
+	}
+
+	return -1;
+}
+
+int64_t Pool::find_run(uint64_t N, uint64_t align)
+{
+	int64_t frame = first_free();
+
+	while(frame >= 0) {
+		uint64_t first = ((frame + align - 1) / align) * align;
+		if(first + N > (uint64_t) num_frames)
+			return -1;
+
+		// A busy frame inside the candidate run means no run can start before it
+		int64_t busy = find_allocated(first, first + N);
+		if(busy < 0)
+			return first;
+
+		frame = find_free(busy + 1);
+	}
+
+	return -1;
+}
+
+void Pool::mark_allocated(uint64_t first, uint64_t N)
+{
+	// The free run holding [first, first+N) loses this piece, leaving up to two runs on either side
+	bool left = first > 0 && is_free(first - 1);
+	bool right = first + N < (uint64_t) num_frames && is_free(first + N);
+	num_free_extents += (left ? 1 : 0) + (right ? 1 : 0) - 1;
+
+	uint64_t last = first + N;
+	for(uint64_t frame = first; frame < last; ) {
+		uint64_t word = frame >> 6;
+		uint64_t count = std::min<uint64_t>(64 - (frame & 63), last - frame);
+		uint64_t mask = (count == 64) ? ~0ULL : (((1ULL << count) - 1) << (frame & 63));
+
+		freeBits[word] &= ~mask;
+		if(!freeBits[word]) {
+			freeWords[word >> 6] &= ~(1ULL << (word & 63));
+			if(!freeWords[word >> 6])
+				freeGroups[word >> 12] &= ~(1ULL << ((word >> 6) & 63));
 		}
-		frames--;
+		frame += count;
+	}
+
+	if(first <= lowest_free && lowest_free < last)
+		lowest_free = last;
 
+	available_frames -= N;
+}
+
+void Pool::mark_free(uint64_t first, uint64_t N)
+{
+	// A new run, merged with the free runs on either side if there are any
+	bool left = first > 0 && is_free(first - 1);
+	bool right = first + N < (uint64_t) num_frames && is_free(first + N);
+	num_free_extents += 1 - (left ? 1 : 0) - (right ? 1 : 0);
+
+	uint64_t last = first + N;
+	for(uint64_t frame = first; frame < last; ) {
+		uint64_t word = frame >> 6;
+		uint64_t count = std::min<uint64_t>(64 - (frame & 63), last - frame);
+		uint64_t mask = (count == 64) ? ~0ULL : (((1ULL << count) - 1) << (frame & 63));
+
+		freeBits[word] |= mask;
+		freeWords[word >> 6] |= 1ULL << (word & 63);
+		freeGroups[word >> 12] |= 1ULL << ((word >> 6) & 63);
+		frame += count;
 	}
 
-	if(!frames_allocated.empty()) {
-		mpr.pAddress = ((Frame *)frames_allocated.front())->starting_address;
-		mpr.num_frames = ceil(_size/(frsize*1024));
-		mpr.frame_size = frsize;
-		memUsage->addData(mpr.num_frames);
+	if(first < lowest_free)
+		lowest_free = first;
 
+	available_frames += N;
+}
+
+uint64_t Pool::largest_free_extent()
+{
+	uint64_t largest = 0;
+	int64_t frame = first_free();
+
+	while(frame >= 0) {
+		int64_t busy = find_allocated(frame, num_frames);
+		uint64_t end = (busy < 0) ? (uint64_t) num_frames : (uint64_t) busy;
+		largest = std::max<uint64_t>(largest, end - frame);
+		if(busy < 0)
+			break;
+		frame = find_free(busy + 1);
 	}
-	else
+
+	return largest;
+}
+
+MemPoolResponse Pool::allocate_frames(int _size)
+{
+
+	MemPoolResponse mpr;
+	int frames = ceil(_size/(frsize*1024));
+
+	if(frames <= 0 || available_frames < frames) {
 		mpr.pAddress = -1;
+		return mpr;
+	}
+
+	// Lowest-addressed run of free frames that fits, so addresses match handing out frames in order while nothing is freed
+	int64_t first = find_run(frames, 1);
+	if(first < 0) {
+		mpr.pAddress = -1;
+		return mpr;
+	}
+
+	mark_allocated(first, frames);
+
+	mpr.pAddress = frame_address(first);
+	mpr.num_frames = frames;
+	mpr.frame_size = frsize;
+	memUsage->addData(mpr.num_frames);
 
 	return mpr;
 
@@ -146,72 +297,68 @@ MemPoolResponse Pool::allocate_frame(int N)
 {
 
 	MemPoolResponse mpr;
-	// Make sure we have free frames first
-	if(freelist.empty()) {
+	// Make sure we have enough free frames first
+	if(N <= 0 || available_frames < N) {
 		mpr.pAddress = -1;
 		return mpr;
 	}
-	// For now, we will assume you can only allocate 1 frame, TODO: We will implemenet a buddy-allocator style that enables allocating contigous physical spaces
-	if(N>1) {
+
+	int64_t first;
+	if(N == 1)
+		first = first_free();
+	else
+		first = find_run(N, (N & (N - 1)) ? 1 : N);
+
+	if(first < 0) {
 		mpr.pAddress = -1;
 		return mpr;
 	}
-	else
-	{
-		// Simply, pop the first free frame and assign it
-		Frame * temp = freelist.front();
-		freelist.pop_front();
-		alloclist[temp->starting_address] = temp;
-		memUsage->addData(1);
-		mpr.pAddress = temp->starting_address;
-		mpr.frame_size = frsize;
-		mpr.num_frames = 1;
-		return mpr;
 
-	}
+	mark_allocated(first, N);
+	memUsage->addData(N);
+	mpr.pAddress = frame_address(first);
+	mpr.frame_size = frsize;
+	mpr.num_frames = N;
+	return mpr;
 
 }
 
 /* Deallocate 'size' contigiuous memory of type 'memType' starting from physical address 'starting_pAddress',
  * returns a structure which indicates whether the memory is successfully deallocated or not
+ * The size is in bytes, as for allocate_frames, and nothing is freed unless every frame in the range is allocated
  */
 MemPoolResponse Pool::deallocate_frames(int _size, long long int starting_pAddress)
 {
 
 	MemPoolResponse mpr;
-	int frames = ceil(_size/frsize);
-	long long int pAddress = starting_pAddress;
-	uint64_t frame_number;
+	int frames = ceil(_size/(frsize*1024));
+	long long int frame_bytes = (long long int) frsize*1024;
 
 	mpr.frame_size = frsize;
+	mpr.num_frames = frames;
 
-	while(frames) {
-
-		// If we can find the frame to be free in the allocated list
-		std::map<long long int, Frame*>::iterator it;
-		it = alloclist.find(pAddress);
-		if (it != alloclist.end())
-		{
-			//Remove from allocation map and add to free list
-			Frame *temp = it->second;
-			freelist.push_back(temp);
-			alloclist.erase(pAddress);
+	if(starting_pAddress < start || (starting_pAddress - start) % frame_bytes) {
+		mpr.pAddress = starting_pAddress;
+		return mpr;
+	}
 
-		}
-		else
-		{
-			mpr.pAddress = pAddress; //physical address of the frame which failed to deallocate.
-			mpr.num_frames = frames; //This indicates number of frames that are not deallocated.
-			return mpr;
-		}
+	uint64_t first = (starting_pAddress - start) / frame_bytes;
+	if(first + frames > (uint64_t) num_frames) {
+		mpr.pAddress = starting_pAddress;
+		return mpr;
+	}
 
-		frame_number = (pAddress - start) / frsize * 1024;
-		pAddress += ((long long int) (frame_number+1)*frsize*1024) + start; //to get the next frame physical address
-		frames--;
+	// Look for the first frame in the range that is not allocated
+	int64_t unallocated = find_free(first);
+	if(unallocated >= 0 && (uint64_t) unallocated < first + frames) {
+		mpr.pAddress = frame_address(unallocated); //physical address of the frame which failed to deallocate.
+		return mpr;
 	}
 
+	mark_free(first, frames);
+
 	mpr.pAddress = -1; //successfully deallocated
-	mpr.num_frames = frames;
+	mpr.num_frames = 0;
 	return mpr;
 }
 
@@ -219,28 +366,21 @@ MemPoolResponse Pool::deallocate_frames(int _size, long long int starting_pAddre
 int Pool::deallocate_frame(long long int X, int N)
 {
 
+	long long int frame_bytes = (long long int) frsize*1024;
 
-	// For now, we will assume you can free only 1 frame, TODO: We will implemenet a buddy-allocator style that enables allocating and freeing contigous physical spaces
-	if(N>=1)
+	if(N <= 0 || X < start || (X - start) % frame_bytes)
 		return -1;
-	else
-	{
-		// If we can find the frame to be free in the allocated list
-		if(alloclist.find(X)!=alloclist.end())
-		{
-			// Remove from allocation map and add to free list
-			Frame * temp = alloclist[X];
-			freelist.push_back(temp);
-			alloclist.erase(X);
 
-		}
-		else // Means we couldn't find an allocated frame that is being unmapped
-			return -1;
+	uint64_t first = (X - start) / frame_bytes;
+	if(first + N > (uint64_t) num_frames)
+		return -1;
 
-	}
+	// Means we couldn't find an allocated frame that is being unmapped
+	int64_t unallocated = find_free(first);
+	if(unallocated >= 0 && (uint64_t) unallocated < first + N)
+		return -1;
+
+	mark_free(first, N);
 
 	return 0;
 }
-
-
-
@@ -18,9 +18,9 @@
  * E-mail: vamseereddy@knights.ucf.edu
  */
 
-#include<list>
-#include<map>
+#include<vector>
 #include<cmath>
+#include<stdint.h>
 
 #include "Opal_Event.h"
 
@@ -30,24 +30,6 @@ typedef struct mpr{
 	int frame_size;
 }MemPoolResponse;
 
-// This defines a physical frame of size 4KB by default
-class Frame{
-
-	public:
-		// Constructor
-		Frame() { starting_address = 0; metadata = 0;}
-
-		// Constructor with paramteres
-		Frame(long long int st, long long int md) { starting_address = st; metadata = 0;}
-
-		// The starting address of the frame
-		long long int starting_address;
-
-		// This will be used to store information about current allocation
-		int metadata;
-
-};
-
 
 // This class defines a memory pool 
 
@@ -58,7 +40,7 @@ class Pool{
 		//Constructor for pool
 		Pool(SST::Component* own, Params parmas, SST::OpalComponent::MemType mem_type, int id);
 
-		void finish() {}
+		void finish();
 
 		// The size of the memory pool in KBs
 		long long int size; 
@@ -67,6 +49,7 @@ class Pool{
 		long long int start;
 
 		// Allocate N contigiuous frames, returns the starting address if successfull, or -1 if it fails!
+		// If N is a power of two the frames are aligned to N frames, as a huge page would be
 		MemPoolResponse allocate_frame(int N);
 
 		// Allocate 'size' contigiuous memory, returns a structure with starting address and number of frames allocated
@@ -79,7 +62,13 @@ class Pool{
 		MemPoolResponse deallocate_frames(int size, long long int starting_pAddress);
 
 		// Current number of free frames
-		int freeframes() { return freelist.size(); }
+		int freeframes() { return available_frames; }
+
+		// Number of maximal runs of free frames, 1 when free memory is unfragmented
+		uint64_t free_extents() { return num_free_extents; }
+
+		// Largest number of contiguous free frames
+		uint64_t largest_free_extent();
 
 		// Frame size in KBs
 		int frsize;
@@ -129,13 +118,43 @@ class Pool{
 		//Memory technology
 		SST::OpalComponent::MemTech memTech;
 
-		// The list of free frames
-		std::list<Frame*> freelist;
+		/* Free frames are tracked in a bitmap, one bit per frame, set if the frame is free.
+		 * Two summary levels sit on top: a bit in freeWords is set if the matching word of
+		 * freeBits has a free frame, and a bit in freeGroups if the matching word of freeWords
+		 * does. Finding the lowest free frame is then a few find-first-set operations, and no
+		 * per-frame objects are ever created.
+		 */
+		std::vector<uint64_t> freeBits;
+		std::vector<uint64_t> freeWords;
+		std::vector<uint64_t> freeGroups;
+
+		// Number of maximal runs of free frames, kept up to date on every allocation and free
+		uint64_t num_free_extents;
+
+		long long int frame_address(uint64_t frame) { return ((long long int) frame*frsize*1024) + start; }
+		bool is_free(uint64_t frame) { return (freeBits[frame >> 6] >> (frame & 63)) & 1; }
+
+		// No frame below this one is free: allocations starting at it move it past them, frees below it lower it
+		uint64_t lowest_free;
+
+		// Lowest free frame at or after 'from', or -1
+		int64_t find_free(uint64_t from);
+
+		// Lowest free frame in the pool, or -1, searching from lowest_free
+		int64_t first_free();
+
+		// Lowest allocated frame in [from, to), or -1
+		int64_t find_allocated(uint64_t from, uint64_t to);
+
+		// Lowest run of N free frames starting at a multiple of 'align', or -1
+		int64_t find_run(uint64_t N, uint64_t align);
 
-		// The list of allocated frames --- the key is the starting physical address
-		std::map<long long int, Frame*> alloclist;
+		void mark_allocated(uint64_t first, uint64_t N);
+		void mark_free(uint64_t first, uint64_t N);
 
 		Statistic<uint64_t>* memUsage;
+		Statistic<uint64_t>* freeExtents;
+		Statistic<uint64_t>* largestFreeExtent;
 
 };
 
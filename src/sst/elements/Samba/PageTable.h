@@ -0,0 +1,151 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+//
+
+
+#ifndef _H_SST_PAGE_TABLE
+#define _H_SST_PAGE_TABLE
+
+#include <stdint.h>
+#include <cstddef>
+
+namespace SST { namespace SambaComponent{
+
+	/*
+	 * A four-level radix page table, as on x86-64. A 48-bit virtual address is split into
+	 * 9-bit slices indexing the PGD, PUD, PMD and PTE levels above the 4KB page offset.
+	 * An entry holds the physical address of the table one level down, or of the page
+	 * itself for a leaf, so a lookup is one array index per level and never allocates.
+	 */
+	class PageTable
+	{
+
+		public:
+
+		enum Level { PTE = 0, PMD = 1, PUD = 2, PGD = 3 };
+
+		static const int ENTRIES = 512; // Entries per table
+
+		static const int ENTRY_SIZE = 8; // Bytes per entry, used to place walker accesses inside a table
+
+		PageTable() { root = new Node(PGD); }
+
+		~PageTable() { destroy(root); }
+
+		// The index of the entry for 'vaddr' in its table at 'level'
+		static int index(long long int vaddr, int level) { return (int) ((vaddr >> (12 + 9*level)) & (ENTRIES - 1)); }
+
+		// The physical address held by the entry for 'vaddr' at 'level', or -1 if the entry (or a table above it) is not present
+		long long int find(long long int vaddr, int level) const
+		{
+			const Node * node = walk(vaddr, level);
+			return node ? node->entry[index(vaddr, level)] : -1;
+		}
+
+		bool present(long long int vaddr, int level) const { return find(vaddr, level) != -1; }
+
+		// Sets the entry for 'vaddr' at 'level', building the tables above it if needed
+		void set(long long int vaddr, int level, long long int paddr) { build(vaddr, level)->entry[index(vaddr, level)] = paddr; }
+
+		// Marks the page holding 'vaddr' as mapped by a leaf at 'level': PTE for 4KB, PMD for 2MB and PUD for 1GB pages
+		void setMapped(long long int vaddr, int level)
+		{
+			int i = index(vaddr, level);
+			build(vaddr, level)->leaf[i >> 6] |= 1ULL << (i & 63);
+		}
+
+		// Checks if the page holding 'vaddr' is mapped, with any page size
+		bool isMapped(long long int vaddr) const
+		{
+			const Node * node = root->child[index(vaddr, PGD)];
+			for(int level = PUD; node != NULL; level--)
+			{
+				int i = index(vaddr, level);
+				if((node->leaf[i >> 6] >> (i & 63)) & 1)
+					return true;
+				if(level == PTE)
+					break;
+				node = node->child[i];
+			}
+
+			return false;
+		}
+
+		private:
+
+		struct Node
+		{
+			Node(int level)
+			{
+				for(int i=0; i < ENTRIES; i++)
+					entry[i] = -1;
+				for(int i=0; i < ENTRIES/64; i++)
+					leaf[i] = 0;
+
+				// Only tables above the PTE level point to other tables
+				child = NULL;
+				if(level != PTE)
+				{
+					child = new Node*[ENTRIES];
+					for(int i=0; i < ENTRIES; i++)
+						child[i] = NULL;
+				}
+			}
+
+			long long int entry[ENTRIES];
+			uint64_t leaf[ENTRIES/64];
+			Node ** child;
+		};
+
+		Node * root;
+
+		// The table at 'level' covering 'vaddr', or NULL if it has not been built
+		const Node * walk(long long int vaddr, int level) const
+		{
+			const Node * node = root;
+			for(int l = PGD; l > level && node != NULL; l--)
+				node = node->child[index(vaddr, l)];
+			return node;
+		}
+
+		Node * build(long long int vaddr, int level)
+		{
+			Node * node = root;
+			for(int l = PGD; l > level; l--)
+			{
+				Node *& next = node->child[index(vaddr, l)];
+				if(next == NULL)
+					next = new Node(l - 1);
+				node = next;
+			}
+			return node;
+		}
+
+		void destroy(Node * node)
+		{
+			if(node->child != NULL)
+			{
+				for(int i=0; i < ENTRIES; i++)
+					if(node->child[i] != NULL)
+						destroy(node->child[i]);
+				delete [] node->child;
+			}
+			delete node;
+		}
+
+		PageTable(const PageTable&); // do not implement
+		void operator=(const PageTable&); // do not implement
+
+	};
+
+}}
+
+#endif
@@ -20,6 +20,8 @@
 #include <sst/elements/Opal/Opal_Event.h>
 #include "Samba_Event.h"
 #include<iostream>
+#include<algorithm>
+#include<cinttypes>
 
 using namespace SST::SambaComponent;
 using namespace SST::OpalComponent;
@@ -28,10 +30,6 @@ using namespace SST;
 
 
 
-// This is and ID used to merely identify page walking requests
-long long int mmu_id=0;
-
-
 int max(int a, int b)
 {
 
@@ -64,6 +62,8 @@ PageTableWalker::PageTableWalker(int Page_size, int Assoc, PageTableWalker * Nex
 PageTableWalker::PageTableWalker(int tlb_id, PageTableWalker * Next_level, int level, SST::Component * owner, SST::Params& params)
 {
 
+	output = new SST::Output("PageTableWalker[@f:@l:@p] ", 16, 0, SST::Output::STDOUT);
+
 	fault_level = 0;
 
 	std::string LEVEL = std::to_string(level);
@@ -109,8 +109,7 @@ PageTableWalker::PageTableWalker(int tlb_id, PageTableWalker * Next_level, int l
 	assoc = new int[sizes];
 	page_size = new long long int[sizes];
 	sets = new int[sizes];
-	tags = new long long int**[sizes];
-	lru = new int **[sizes];
+	base = new int[sizes];
 
 
 	// page table offsets
@@ -126,35 +125,48 @@ PageTableWalker::PageTableWalker(int tlb_id, PageTableWalker * Next_level, int l
 
 		assoc[i] =  ((uint32_t) params.find<uint32_t>("assoc"+std::to_string(i+1) +  "_PTWC", 1));
 
-		// We define the number of sets for that structure of page size number i
+		// We define the number of sets for that structure of page size number i, a size of 0 leaves that structure out
+		if(assoc[i] <= 0)
+			assoc[i] = 1;
 		sets[i] = size[i]/assoc[i];
 
 	}
 
 	hits=misses=0;
 
+	pending_misses=0;
 
-
+	// The initial ages make the last way of a set its first victim, then the one before it, and so on
+	use_clock = 0;
 	for(int id=0; id< sizes; id++)
 	{
-
-		tags[id] = new long long int*[sets[id]];
-
-		lru[id] = new int*[sets[id]];
+		base[id] = tags.size();
+		use_clock = std::max(use_clock, (uint32_t) assoc[id]);
 
 		for(int i=0; i < sets[id]; i++)
-		{
-			tags[id][i]=new long long int[assoc[id]];
-			lru[id][i]=new int[assoc[id]];
 			for(int j=0; j<assoc[id];j++)
 			{
-				tags[id][i][j]=-1;
-				lru[id][i][j]=j;
+				tags.push_back(-1);
+				age.push_back(assoc[id]-1-j);
 			}
-		}
-
 	}
 
+	// Only as many walks as outstanding misses can be in flight
+	walks.resize(max(max_outstanding, 1));
+	for(size_t i=0; i < walks.size(); i++)
+		walks[i].active = false;
+
+	// Note that this is a hack to reduce the number of walks needed for large pages, however, in case of full-system, the content of the page table
+	// will tell us that no next level, but since we don't have a full-system status, we will just stop at the priori-known leaf level
+	if(os_page_size == 2048)
+		leaf_level = PageTable::PMD;
+	else if(os_page_size == 1024*1024)
+		leaf_level = PageTable::PUD;
+	else
+		leaf_level = PageTable::PTE;
+
+	page_table = NULL;
+	CR3 = NULL;
 
 
 }
@@ -190,13 +202,13 @@ void PageTableWalker::handleEvent( SST::Event* e )
 
 		if((*CR3) == -1)
 			fault_level = 0;
-		else if((*PGD).find(temp_ptr->getAddress()/page_size[3]) == (*PGD).end())
+		else if(!page_table->present(temp_ptr->getAddress(), PageTable::PGD))
 			fault_level = 1;
-		else if((*PUD).find(temp_ptr->getAddress()/page_size[2]) == (*PUD).end())
+		else if(!page_table->present(temp_ptr->getAddress(), PageTable::PUD))
 			fault_level = 2;
-		else if((*PMD).find(temp_ptr->getAddress()/page_size[1]) == (*PMD).end())
+		else if(!page_table->present(temp_ptr->getAddress(), PageTable::PMD))
 			fault_level = 3;
-		else if((*PTE).find(temp_ptr->getAddress()/page_size[0]) == (*PTE).end())
+		else if(!page_table->present(temp_ptr->getAddress(), PageTable::PTE))
 			fault_level = 4;
 
 
@@ -227,7 +239,7 @@ void PageTableWalker::handleEvent( SST::Event* e )
 		}
 		else if(fault_level == 1)
 		{
-			(*PGD)[temp_ptr->getAddress()/page_size[3]] = temp_ptr->getPaddress();
+			page_table->set(temp_ptr->getAddress(), PageTable::PGD, temp_ptr->getPaddress());
 			fault_level++;
 			OpalEvent * tse = new OpalEvent(OpalComponent::EventType::REQUEST);
 			tse->setResp(temp_ptr->getAddress(),0,4096);
@@ -236,7 +248,7 @@ void PageTableWalker::handleEvent( SST::Event* e )
 		}
 		else if(fault_level == 2)
 		{
-			(*PUD)[temp_ptr->getAddress()/page_size[2]] = temp_ptr->getPaddress();
+			page_table->set(temp_ptr->getAddress(), PageTable::PUD, temp_ptr->getPaddress());
 			fault_level++;
 			OpalEvent * tse = new OpalEvent(OpalComponent::EventType::REQUEST);
 			//(*MAPPED_PAGE_SIZE1GB)[temp_ptr->getAddress()/page_size[2]] = 0;
@@ -247,7 +259,7 @@ void PageTableWalker::handleEvent( SST::Event* e )
 
 		else if(fault_level == 3)
 		{
-			(*PMD)[temp_ptr->getAddress()/page_size[1]] = temp_ptr->getPaddress();
+			page_table->set(temp_ptr->getAddress(), PageTable::PMD, temp_ptr->getPaddress());
 			//(*MAPPED_PAGE_SIZE2MB)[temp_ptr->getAddress()/page_size[1]] = 0;
 			fault_level++;
 			OpalEvent * tse = new OpalEvent(OpalComponent::EventType::REQUEST);
@@ -259,9 +271,9 @@ void PageTableWalker::handleEvent( SST::Event* e )
 		{
 			stall = false;
 			*hold = 0;
-			(*PTE)[temp_ptr->getAddress()/page_size[0]] = temp_ptr->getPaddress();
+			page_table->set(temp_ptr->getAddress(), PageTable::PTE, temp_ptr->getPaddress());
 
-			(*MAPPED_PAGE_SIZE4KB)[temp_ptr->getAddress()/page_size[0]] = 0;
+			page_table->setMapped(temp_ptr->getAddress(), PageTable::PTE);
 
 			fault_level = 0;
 
@@ -299,63 +311,68 @@ void PageTableWalker::recvResp(SST::Event * event)
 
 	SST::Event * ev = event;
 
-
-	long long int pw_id;
+	id_type resp_id;
 	if(!self_connected)
-		pw_id = MEM_REQ[((MemEvent*) ev)->getResponseToID()];
+		resp_id = ((MemEvent*) ev)->getResponseToID();
 	else
-		pw_id = MEM_REQ[((MemEvent*) ev)->getID()];	
+		resp_id = ((MemEvent*) ev)->getID();
 
-	insert_way(WID_Add[pw_id], find_victim_way(WID_Add[pw_id], WSR_COUNT[pw_id]), WSR_COUNT[pw_id]);
-
-	long long int addr = WID_Add[pw_id];
-
-	WSR_READY[pw_id]=true;
+	// There are only a few walks in flight, so we simply look for the one waiting for this access
+	int pw_id = -1;
+	for(int i=0; i < (int) walks.size(); i++)
+		if(walks[i].active && walks[i].mem_req == resp_id)
+		{
+			pw_id = i;
+			break;
+		}
 
 	// Avoiding memory leak by deleting the newly generated dummy requests
-	MEM_REQ.erase(((MemEvent*) ev)->getID());
 	delete ev;
 
-	if(WSR_COUNT[pw_id]==0)
-	{
-		ready_by[WID_EV[pw_id]] =  currTime + latency + 2*upper_link_latency;
+	if(pw_id < 0)
+		output->fatal(CALL_INFO, -1, "Page Table Walker received a response that does not belong to any walk\n");
 
-		ready_by_size[WID_EV[pw_id]] = os_page_size; // FIXME: This hardcoded for now assuming the OS maps virtual pages to 4KB pages only
+	Walk & walk = walks[pw_id];
+
+	// The entry just read goes into the victim way of the page walk cache indexed by the accesses left, without becoming the most recently used
+	if(walk.remaining < sizes && sets[walk.remaining] > 0)
+		insert_way(walk.vaddr, find_victim_way(walk.vaddr, walk.remaining), walk.remaining);
+
+	if(walk.remaining==0)
+	{
+		ReadyRequest ready = { walk.ev, currTime + latency + 2*upper_link_latency, os_page_size, true }; // FIXME: This hardcoded for now assuming the OS maps virtual pages to 4KB pages only
+		ready_by.push_back(ready);
+		walk.active = false;
 	}
 	else
 	{
+		walk.remaining--;
+		issueWalkAccess(pw_id, walk.remaining + leaf_level);
+	}
 
 
-		long long int dummy_add = rand()%10000000;
-
-		// Time to use actual page table addresses if we have page tables
-		if(emulate_faults)
-		{
-
-			long long int page_table_start = 0;
-			if(WSR_COUNT[pw_id]==4)
-				page_table_start = (*PGD)[addr/page_size[3]];
-			else if(WSR_COUNT[pw_id]==3)
-				page_table_start = (*PUD) [addr/page_size[2]];
-			else if(WSR_COUNT[pw_id]==2)
-				page_table_start = (*PMD) [addr/page_size[1]];
-			else if (WSR_COUNT[pw_id] == 1)
-				page_table_start = (*PTE) [addr/page_size[0]];
-
-			dummy_add = page_table_start + (addr/page_size[WSR_COUNT[pw_id]-1])%512;
+}
 
-		}
-		uint64_t dummy_base_add = dummy_add & ~(line_size - 1);
-		MemEvent *e = new MemEvent(Owner, dummy_add, dummy_base_add, Command::GetS);
-		SST::Event * ev = e;
+// Sends the access to the page table entry at 'level' for the walk on slot 'id'
+void PageTableWalker::issueWalkAccess(int id, int level)
+{
 
-		WSR_COUNT[pw_id]--;
-		MEM_REQ[e->getID()]=pw_id;
-		to_mem->send(ev);
+	Walk & walk = walks[id];
 
+	long long int dummy_add = rand()%10000000;
 
+	// Time to use actual page table addresses if we have page tables: the entry sits in the table pointed to by the level above (or CR3)
+	if(emulate_faults)
+	{
+		long long int table = (level == PageTable::PGD) ? (*CR3) : page_table->find(walk.vaddr, level + 1);
+		dummy_add = table + PageTable::index(walk.vaddr, level)*PageTable::ENTRY_SIZE;
 	}
 
+	uint64_t dummy_base_add = dummy_add & ~(line_size - 1);
+	MemEvent *e = new MemEvent(Owner, dummy_add, dummy_base_add, Command::GetS);
+
+	walk.mem_req = e->getID();
+	to_mem->send(e);
 
 }
 
@@ -395,9 +412,7 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 		if(emulate_faults==1)
 		{
 
-			bool fault = true;
-			if((*MAPPED_PAGE_SIZE4KB).find(addr/page_size[0])!=(*MAPPED_PAGE_SIZE4KB).end() || (*MAPPED_PAGE_SIZE2MB).find(addr/page_size[1])!=(*MAPPED_PAGE_SIZE2MB).end() || (*MAPPED_PAGE_SIZE1GB).find(addr/page_size[2])!=(*MAPPED_PAGE_SIZE1GB).end())
-				fault = false;
+			bool fault = !page_table->isMapped(addr);
 
 			if(fault)
 			{
@@ -413,33 +428,29 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 
 		}
 
-		// Those track if any hit in one of the supported pages' structures
-		int hit_id=0;
-
-		// We check the structures in parallel to find if it hits
+		// We check the structures in parallel to find if it hits: structure 0 caches whole translations, and structure k
+		// the entries of page table level k (PMD, PUD, then PGD), leaving k table accesses to walk
 		int k;
+		int hit_entry=-1;
 		for(k=0; k < sizes; k++)
-			if(check_hit(addr, k))
-			{
-				hit_id=k;
+		{
+			hit_entry = find_entry(addr, k);
+			if(hit_entry >= 0)
 				break;
-			}
+		}
 
 
 		// Check if we found the entry in the PTWC of PTEs
 		if(k==0)
 		{
 
-			update_lru(addr, hit_id);
+			touch(hit_entry);
 			hits++;
 			statPageTableWalkerHits->addData(1);
-			if(parallel_mode)
-				ready_by[ev] = x;
-			else
-				ready_by[ev] = x + latency;
 
 			// Tracking the hit request size
-			ready_by_size[ev] = os_page_size; //page_size[hit_id]/1024;
+			ReadyRequest ready = { ev, parallel_mode ? x : x + latency, os_page_size, false }; //page_size[hit_id]/1024;
+			ready_by.push_back(ready);
 
 			st_1 = not_serviced.erase(st_1);
 		}
@@ -447,50 +458,30 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 		{
 
 
-			// Note that this is a hack to reduce the number of walks needed for large pages, however, in case of full-system, the content of the page table 
-			// will tell us that no next level, but since we don't have a full-system status, we will just stop at the priori-known leaf level
-			if(os_page_size == 2048)
-				k = max(k-1, 1);
-			else if(os_page_size == 1024*1024)
-				k = max(k-2, 1); 
+			// With large pages the walk stops at their leaf level, but always takes at least one access
+			k = max(k - leaf_level, 1);
 
 
-			if((int) pending_misses.size() < (int) max_outstanding)
+			if(pending_misses < max_outstanding)
 			{	
 				statPageTableWalkerMisses->addData(1);
 				misses++;
-				pending_misses.push_back(*st_1);
+				pending_misses++;
 				if(to_mem!=NULL)
 				{
 
-					WID_EV[++mmu_id] = (*st_1);
+					int pw_id = 0;
+					while(walks[pw_id].active)
+						pw_id++;
 
-					long long int dummy_add = rand()%10000000;
+					Walk & walk = walks[pw_id];
+					walk.ev = ev;
+					walk.vaddr = addr;
+					walk.remaining = k-1;
+					walk.active = true;
 
-					// Use actual page table base to start the walking if we have real page tables
-					if(emulate_faults)
-					{
-						dummy_add = (*CR3) + (addr/page_size[2])%512;
-					}
-
-					uint64_t dummy_base_add = dummy_add & ~(line_size - 1);
-					MemEvent *e = new MemEvent(Owner, dummy_add, dummy_base_add, Command::GetS);
-					SST::Event * ev = e;
-
-
-
-
-					WSR_COUNT[mmu_id] = k-1;
-					//		WID_EV[mmu_id] = ev;
-					WID_Add[mmu_id] = addr;
-					WSR_READY[mmu_id] = false;					
-
-					// Add it to the tracking structure
-					MEM_REQ[e->getID()]=mmu_id;
-
-					//					std::cout<<"Sending a new request with address "<<std::hex<<dummy_add<<std::endl;
-					// Actually send the event to the cache
-					to_mem->send(ev);
+					// Actually send the first access to the cache, starting from the highest level not found in the page walk caches
+					issueWalkAccess(pw_id, walk.remaining + leaf_level);
 
 
 					st_1 = not_serviced.erase(st_1);
@@ -502,9 +493,8 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 
 
 
-					ready_by[ev] = x + latency + 2*upper_link_latency + page_walk_latency;  // the upper link latency is substituted for sending the miss request and reciving it, Note this is hard coded for the last-level as memory access walk latency, this ****definitely**** needs to change
-
-					ready_by_size[ev] = os_page_size; // FIXME: This hardcoded for now assuming the OS maps virtual pages to 4KB pages only
+					ReadyRequest ready = { ev, x + latency + 2*upper_link_latency + page_walk_latency, os_page_size, true };  // the upper link latency is substituted for sending the miss request and reciving it, Note this is hard coded for the last-level as memory access walk latency, this ****definitely**** needs to change
+					ready_by.push_back(ready); // FIXME: This hardcoded for now assuming the OS maps virtual pages to 4KB pages only
 
 					st_1 = not_serviced.erase(st_1);
 				}
@@ -519,75 +509,45 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 	}
 
 
-	std::map<SST::Event *, SST::Cycle_t>::iterator st, en;
-	st = ready_by.begin();
-	en = ready_by.end();
-
-	while(st!=en)
+	// We iterate over the list of being serviced request to see if any has finished by this cycle, keeping the others in order
+	size_t kept=0;
+	completed.clear();
+	for(size_t i=0; i < ready_by.size(); i++)
 	{
 
-		bool deleted=false;
-		if(st->second <= x)
-		{
-
-
-			uint64_t addr = ((MemEvent*) st->first)->getVirtualAddress();
-
-
-			// Double checking that we actually still don't have it inserted
-			//std::cout<<"The address is"<<addr<<std::endl;
-			if(!check_hit(addr, 0))
-			{
-				insert_way(addr, find_victim_way(addr, 0), 0);
-				update_lru(addr, 0);
-			}
-			else
-				update_lru(addr, 0);
-
-
-			service_back->push_back(st->first);
-
-
-			if(emulate_faults)
-				if((*PTE).find(addr/4096)==(*PTE).end())
-                        {
-					std::cout << "******* Major issue is in Page Table Walker **** " << std::endl;
-					std::cout << "The address is "<< hex << addr << " (" << addr / 4096 << ")" << std::endl;
-                        }
-			(*service_back_size)[st->first]=ready_by_size[st->first];
+		if(ready_by[i].ready > x)
+			ready_by[kept++] = ready_by[i];
+		else
+			completed.push_back(ready_by[i]);
 
+	}
+	ready_by.resize(kept);
 
-			ready_by_size.erase(st->first);
+	// Requests finishing together go back in Event order, as they did when ready_by was a map keyed by the Event
+	std::sort(completed.begin(), completed.end(), completed_before);
 
+	for(std::vector<ReadyRequest>::iterator req = completed.begin(); req != completed.end(); req++)
+	{
 
+		uint64_t addr = ((MemEvent*) req->ev)->getVirtualAddress();
 
 
-			deleted = true;
+		// Double checking that we actually still don't have it inserted
+		fill(addr, 0);
 
 
-			// Deleting it from pending requests
-			std::vector<SST::Event *>::iterator st2, en2;
-			st2 = pending_misses.begin();
-			en2 = pending_misses.end();
+		service_back->push_back(req->ev);
 
 
-			while(st2!=en2)
-			{
-				if(*st2 == st->first)
-				{
-					pending_misses.erase(st2);
-					break;
-				}
-				st2++;
-			}
+		// With emulated faults the walk only completes once the fault has installed the translation
+		if(emulate_faults && !page_table->present(addr, PageTable::PTE))
+			output->fatal(CALL_INFO, -1, "Page Table Walker completed a walk with no PTE for address 0x%" PRIx64 " (page %" PRIu64 ")\n",
+				addr, addr / 4096);
+		(*service_back_size)[req->ev]=req->size;
 
-			ready_by.erase(st);
 
-		}
-		if(deleted)
-			st=ready_by.begin();
-		else
-			st++;
+		if(req->miss)
+			pending_misses--;
 
 	}
 
@@ -598,11 +558,17 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 
 
 
+// The set an address maps to on structure struct_id
+int PageTableWalker::set_index(long long int vaddr, int struct_id)
+{
+	return abs_int_Samba((vaddr/page_size[struct_id])%sets[struct_id]);
+}
+
 void PageTableWalker::insert_way(long long int vaddr, int way, int struct_id)
 {
 
-	int set=abs_int_Samba((vaddr/page_size[struct_id])%sets[struct_id]);
-	tags[struct_id][set][way]=vaddr/page_size[struct_id];
+	int set=set_index(vaddr, struct_id);
+	tags[base[struct_id] + set*assoc[struct_id] + way]=vaddr/page_size[struct_id];
 
 
 }
@@ -617,56 +583,99 @@ long long int PageTableWalker::translate(long long int vadd)
 
 
 
-// Find if it exists
-bool PageTableWalker::check_hit(long long int vadd, int struct_id)
+// Find the entry holding the translation, structures with no entries never hit
+int PageTableWalker::find_entry(long long int vadd, int struct_id)
 {
 
+	if(sets[struct_id] == 0)
+		return -1;
 
-	int set= abs_int_Samba((vadd/page_size[struct_id])%sets[struct_id]);
+	long long int tag = vadd/page_size[struct_id];
+	int first = base[struct_id] + set_index(vadd, struct_id)*assoc[struct_id];
 
 	for(int i=0; i<assoc[struct_id];i++)
-		if(tags[struct_id][set][i]==vadd/page_size[struct_id])
-			return true;
+		if(tags[first + i]==tag)
+			return first + i;
 
-	return false;
+	return -1;
 }
 
 // To insert the translaiton
 int PageTableWalker::find_victim_way(long long int vadd, int struct_id)
 {
 
-	int set= abs_int_Samba((vadd/page_size[struct_id])%sets[struct_id]);
+	int first = base[struct_id] + set_index(vadd, struct_id)*assoc[struct_id];
+
+	int victim=0;
+	for(int i=1; i<assoc[struct_id]; i++)
+		if(age[first + i] < age[first + victim])
+			victim = i;
+
+	return victim;
+}
+
+void PageTableWalker::touch(int entry)
+{
+
+	if(++use_clock == 0)
+		rebase_ages();
+
+	age[entry] = use_clock;
+
+}
+
+void PageTableWalker::fill(long long int vaddr, int struct_id)
+{
+
+	if(sets[struct_id] == 0)
+		return;
 
-	for(int i=0; i<assoc[struct_id]; i++)
-		if(lru[struct_id][set][i]==(assoc[struct_id]-1))
-			return i;
+	int entry = find_entry(vaddr, struct_id);
+	if(entry < 0)
+	{
+		int way = find_victim_way(vaddr, struct_id);
+		insert_way(vaddr, way, struct_id);
+		entry = base[struct_id] + set_index(vaddr, struct_id)*assoc[struct_id] + way;
+	}
 
+	touch(entry);
 
-	return 0;
 }
 
 // This function updates the LRU policy for a given address
 void PageTableWalker::update_lru(long long int vaddr, int struct_id)
 {
 
-	int lru_place=assoc[struct_id]-1;
+	if(sets[struct_id] == 0)
+		return;
 
-	int set= abs_int_Samba((vaddr/page_size[struct_id])%sets[struct_id]);
-	for(int i=0; i<assoc[struct_id];i++)
-		if(tags[struct_id][set][i]==vaddr/page_size[struct_id])
-		{
-			lru_place = lru[struct_id][set][i];
-			break;
-		}
-	for(int i=0; i<assoc[struct_id];i++)
-	{
-		if(lru[struct_id][set][i]==lru_place)
-			lru[struct_id][set][i]=0;
-		else if(lru[struct_id][set][i]<lru_place)
-			lru[struct_id][set][i]++;
-	}
+	int entry = find_entry(vaddr, struct_id);
 
+	// As with LRU positions, a missing translation makes the victim way the most recently used
+	if(entry < 0)
+		entry = base[struct_id] + set_index(vaddr, struct_id)*assoc[struct_id] + find_victim_way(vaddr, struct_id);
+
+	touch(entry);
 
 }
 
+void PageTableWalker::rebase_ages()
+{
+
+	use_clock = 0;
+	std::vector<std::pair<uint32_t, int> > order;
+	for(int id=0; id < sizes; id++)
+		for(int set=0; set < sets[id]; set++)
+		{
+			int first = base[id] + set*assoc[id];
+			order.clear();
+			for(int i=0; i < assoc[id]; i++)
+				order.push_back(std::make_pair(age[first + i], i));
+			std::sort(order.begin(), order.end());
+
+			for(int rank=0; rank < assoc[id]; rank++)
+				age[first + order[rank].second] = rank;
+			use_clock = std::max(use_clock, (uint32_t) assoc[id]);
+		}
 
+}
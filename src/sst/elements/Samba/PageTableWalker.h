@@ -25,9 +25,12 @@
 #include <sst/core/interfaces/simpleMem.h>
 #include <sst/core/link.h>
 #include <sst/core/event.h>
+#include <sst/core/output.h>
 #include<map>
 #include<vector>
+#include<functional>
 #include <sst/core/sst_types.h>
+#include "PageTable.h"
 // This file defines the page table walker and 
 
 typedef std::pair<uint64_t, int> id_type;
@@ -49,9 +52,14 @@ namespace SST { namespace SambaComponent{
 
 		int * assoc; // This represents the associativiety
 
-		long long int *** tags; // This will hold the tags
+		// The page walk caches are laid out as in the TLB units: all tags in one array, the ways of a set contiguous, and LRU kept as per-entry ages
+		std::vector<long long int> tags; // This will hold the tags, -1 if invalid
 
-		int *** lru; // This will hold the lru positions
+		std::vector<uint32_t> age; // This will hold the last use of each entry
+
+		uint32_t use_clock; // Incremented on every use of an entry
+
+		int * base; // Index of the first entry of each structure
 
 		SST::Link * to_mem; // This links the Page table walker to the memory hierarchy
 
@@ -67,23 +75,8 @@ namespace SST { namespace SambaComponent{
 		// Holds CR3 value of current context
 		long long int *CR3;
 
-		// Holds the PGD physical pointers, the key is the 9 bits 39-47, i.e., VA/(4096*512*512*512)
-		std::map<long long int, long long int> * PGD;
-
-		// Holds the PUD physical pointers, the key is the 9 bits 30-38, i.e., VA/(4096*512*512)
-		std::map<long long int, long long int> * PUD;
-
-		// Holds the PMD physical pointers, the key is the 9 bits 21-29, i.e., VA/(4096*512)
-		std::map<long long int, long long int> * PMD;
-
-		// Holds the PTE physical pointers, the key is the 9 bits 12-20, i.e., VA/(4096)
-		std::map<long long int, long long int> * PTE; // This should give you the exact physical address of the page
-
-
-		// The structures below are used to quickly check if the page is mapped or not
-		std::map<long long int,int> * MAPPED_PAGE_SIZE4KB;
-		std::map<long long int,int> * MAPPED_PAGE_SIZE2MB;
-		std::map<long long int,int> * MAPPED_PAGE_SIZE1GB;
+		// Holds the PGD, PUD, PMD and PTE tables, and which pages are mapped
+		PageTable * page_table;
 
 
 
@@ -121,15 +114,40 @@ namespace SST { namespace SambaComponent{
 
 		std::map<SST::Event *, long long int> * service_back_size; // This is used to pass the size of the  requests back to the previous level
 
-		std::map<SST::Event *, SST::Cycle_t > ready_by; // this one is used to keep track of requests that are delayed inside this structure, compensating for latency
+		struct ReadyRequest {
+			SST::Event * ev;
+			SST::Cycle_t ready; // The cycle the request leaves this structure, compensating for latency
+			long long int size; // The size of the translation
+			bool miss; // Set if the request counts against the outstanding misses
+		};
+
+		std::vector<ReadyRequest> ready_by; // this one is used to keep track of requests that are delayed inside this structure, in the order they were scheduled
+
+		std::vector<ReadyRequest> completed; // The requests of ready_by that finished on this cycle
 
-		std::map<SST::Event *, long long int> ready_by_size; // this one is used to keep track of requests' sizes inside this structure
+		static bool completed_before(const ReadyRequest & a, const ReadyRequest & b) { return std::less<SST::Event *>()(a.ev, b.ev); }
 
 		std::vector<SST::Event *> pushed_back; // This is what we got returned from other structures
 
 		std::map<SST::Event *, long long int> pushed_back_size; // This is the sizes of the translations we got returned from other structures
 
-		std::vector<SST::Event *> pending_misses; // This the number of pending misses, only erased when pushed back from next level
+		int pending_misses; // This the number of pending misses, only decremented when the translation is handed back
+
+		// A page walk in progress, one table access is outstanding at a time
+		struct Walk {
+			SST::Event * ev; // The request being translated
+			long long int vaddr;
+			int remaining; // Table accesses left after the outstanding one
+			id_type mem_req; // The outstanding table access
+			bool active;
+		};
+
+		std::vector<Walk> walks; // One slot per possible outstanding miss
+
+		int leaf_level; // The page table level of the OS pages, PTE for 4KB pages, PMD for 2MB and PUD for 1GB
+
+		// Sends the access to the entry for the walk's address at 'level', for a walk on slot 'id'
+		void issueWalkAccess(int id, int level);
 
 		std::vector<SST::Event *> not_serviced; // This holds those accesses not serviced yet
 
@@ -142,6 +160,8 @@ namespace SST { namespace SambaComponent{
 
 		SST::Component * Owner;
 
+		SST::Output * output;
+
 		uint64_t line_size; // For setting base address of MemEvents
 
 		public: 
@@ -150,16 +170,10 @@ namespace SST { namespace SambaComponent{
 		PageTableWalker(int page_size, int assoc, PageTableWalker * next_level, int size);
 		PageTableWalker(int tlb_id, PageTableWalker * Next_level,int level, SST::Component * owner, SST::Params& params);
 
-		void setPageTablePointers( long long int * cr3, std::map<long long int, long long int> * pgd,  std::map<long long int, long long int> * pud,  std::map<long long int, long long int> * pmd,  std::map<long long int, long long int> * pte,  std::map<long long int,int> * gb,  std::map<long long int,int> * mb,  std::map<long long int,int> * kb)
+		void setPageTablePointers( long long int * cr3, PageTable * pt)
 		{
 			CR3 = cr3;
-			PGD = pgd;
-			PUD = pud;
-			PMD = pmd;
-			PTE = pte;
-			MAPPED_PAGE_SIZE4KB = kb;
-			MAPPED_PAGE_SIZE2MB = mb;
-			MAPPED_PAGE_SIZE1GB = gb;
+			page_table = pt;
 		}
 
 		// Does the translation and updating the statistics of miss/hit
@@ -177,7 +191,21 @@ namespace SST { namespace SambaComponent{
 		void setLineSize(uint64_t size) { line_size = size; }
 
 		// Find if it exists
-		bool check_hit(long long int vadd, int struct_id);
+		bool check_hit(long long int vadd, int struct_id) { return find_entry(vadd, struct_id) >= 0; }
+
+		// The index of the entry holding the translation on structure struct_id, or -1
+		int find_entry(long long int vadd, int struct_id);
+
+		// Marks an entry as the most recently used of its set
+		void touch(int entry);
+
+		// Inserts the translation if it is missing and makes it the most recently used
+		void fill(long long int vadd, int struct_id);
+
+		int set_index(long long int vaddr, int struct_id);
+
+		// Restarts the ages from zero, keeping their order within each set, once use_clock wraps around
+		void rebase_ages();
 
 		// To insert the translaiton
 		int find_victim_way(long long int vadd, int struct_id);
@@ -196,14 +224,6 @@ namespace SST { namespace SambaComponent{
 
 		std::map<SST::Event *, long long int> * getPushedBackSize(){return & pushed_back_size;}
 
-		std::map<long long int, int> WSR_COUNT;
-		std::map<long long int, bool> WSR_READY;
-
-		std::map<long long int, long long int> WID_Add;
-
-		std::map<long long int, SST::Event *> WID_EV;
-		std::map<id_type, long long int> MEM_REQ;
-
 		void update_lru(long long int vaddr, int struct_id);
 
 
@@ -37,6 +37,7 @@
 
 #include "TLBhierarchy.h"
 #include "PageTableWalker.h"
+#include "PageTable.h"
 #include <sst/elements/memHierarchy/memEventBase.h>
 
 //#include "arielcore.h"
@@ -60,13 +61,7 @@ namespace SST {
 				// Note, the application might be multi-threaded, however, all threads will share the sambe page table components below
 
 				long long int CR3;
-				std::map<long long int, long long int> PGD;
-				std::map<long long int, long long int> PUD;
-				std::map<long long int, long long int> PMD;
-				std::map<long long int, long long int> PTE;
-				std::map<long long int,int>  MAPPED_PAGE_SIZE4KB;
-				std::map<long long int,int>  MAPPED_PAGE_SIZE2MB;
-				std::map<long long int,int>  MAPPED_PAGE_SIZE1GB;
+				PageTable page_table;
 
 
 			private:
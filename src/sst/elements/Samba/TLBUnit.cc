@@ -19,6 +19,11 @@
 
 
 #include<iostream>
+#include<algorithm>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 using namespace SST::MemHierarchy;
 using namespace SST;
@@ -93,8 +98,9 @@ TLB::TLB(int tlb_id, TLB * Next_level, int Level, SST::Component * owner, SST::P
 	assoc = new int[sizes];
 	page_size = new int[sizes];
 	sets = new int[sizes];
-	tags = new long long int**[sizes];
-	lru = new int **[sizes];
+	base = new int[sizes];
+	page_shift = new int[sizes];
+	set_mask = new int[sizes];
 
 
 	for(int i=0; i < sizes; i++)
@@ -116,30 +122,32 @@ TLB::TLB(int tlb_id, TLB * Next_level, int Level, SST::Component * owner, SST::P
 		// We define the number of sets for that structure of page size number i
 		sets[i] = size[i]/assoc[i];
 
+		// Page and set numbers are shifts and masks for the usual power of two geometries
+		page_shift[i] = -1;
+		if((page_size[i] & (page_size[i] - 1)) == 0)
+			page_shift[i] = __builtin_ctz(page_size[i]);
+
+		set_mask[i] = ((sets[i] & (sets[i] - 1)) == 0) ? sets[i] - 1 : -1;
+
 	}
 
 	hits=misses=0;
 
+	pending_misses=0;
 
-
+	// The initial ages make the last way of a set its first victim, then the one before it, and so on
+	use_clock = 0;
 	for(int id=0; id< sizes; id++)
 	{
-
-		tags[id] = new long long int*[sets[id]];
-
-		lru[id] = new int*[sets[id]];
+		base[id] = tags.size();
+		use_clock = std::max(use_clock, (uint32_t) assoc[id]);
 
 		for(int i=0; i < sets[id]; i++)
-		{
-			tags[id][i]=new long long int[assoc[id]];
-			lru[id][i]=new int[assoc[id]];
 			for(int j=0; j<assoc[id];j++)
 			{
-				tags[id][i][j]=-1;
-				lru[id][i][j]=j;
+				tags.push_back(-1);
+				age.push_back(assoc[id]-1-j);
 			}
-		}
-
 	}
 
 	//	registerClock( cpu_clock, new SST::Clock::Handler<TLB>(this, &TLB::tick ) );
@@ -178,64 +186,44 @@ bool TLB::tick(SST::Cycle_t x)
 
 		// Double checking that we actually still don't have it inserted
 		// Insert the translation into all structures with same or smaller size page support. Note that smaller page sizes will still have the same translation with offset derived from address
+		long long int ev_size = pushed_back_size[ev];
 		std::map<long long int, int>::iterator lu_st, lu_en;
 		lu_st=SIZE_LOOKUP.begin();
 		lu_en=SIZE_LOOKUP.end();
 		while(lu_st!=lu_en)
 		{
-			if(pushed_back_size[ev] >= lu_st->first)
+			if(ev_size >= lu_st->first)
 			{
 				if(!check_hit(addr, lu_st->second))
-				{
-					insert_way(addr, find_victim_way(addr, lu_st->second), lu_st->second);
-					update_lru(addr, lu_st->second);
-				}
+					fill(addr, lu_st->second);
 
 			}
 
 			lu_st++;
 		}
 
-		// Deleting it from pending requests
-		std::vector<SST::Event *>::iterator st, en;
-		st = pending_misses.begin();
-		en = pending_misses.end();
-
-
-		while(st!=en)
-		{
-			if(*st == ev)
-			{
-				pending_misses.erase(st);
-				break;
-			}
-			st++;
-		}
+		// The miss is no longer pending
+		pending_misses--;
 
 		// Note that here we are sustitiuing for latency of checking the tag before proceeing to the next level, we also add the upper link latency for the round trip
-		ready_by[ev]= x + latency + 2*upper_link_latency;
-
-		// We also track the size of tthe ready request
-		ready_by_size[ev]= pushed_back_size[ev];
+		ReadyRequest ready = { ev, x + latency + 2*upper_link_latency, ev_size };
+		ready_by.push_back(ready);
 
 
 		// Check if there are other misses that were going to the same translation and waiting for the response of this miss
-		if((level==1) && (SAME_MISS.find(addr/4096)!=SAME_MISS.end()))
+		if(level==1)
 		{
-		  std::map< SST::Event *, int>::iterator same_st, same_en; 
-		  same_st = SAME_MISS[addr/4096].begin();
-    		  same_en = SAME_MISS[addr/4096].end();
-   		   while(same_st!=same_en)
-		    {
-
-	    		ready_by[same_st->first] = x + latency + 2*upper_link_latency;
-	    		ready_by_size[same_st->first] = pushed_back_size[ev];
-			same_st++;
-		    }	
-		  SAME_MISS.erase(addr/4096);
-		 // PENDING_MISS.erase(addr/4096);
+			std::unordered_map<long long int, std::vector<SST::Event *>>::iterator same = SAME_MISS.find(addr/4096);
+			if(same != SAME_MISS.end())
+			{
+				for(std::vector<SST::Event *>::iterator same_st = same->second.begin(); same_st != same->second.end(); same_st++)
+				{
+					ready.ev = *same_st;
+					ready_by.push_back(ready);
+				}
+				SAME_MISS.erase(same);
+			}
 		}
-		PENDING_MISS.erase(addr/4096);
 
 		pushed_back_size.erase(ev);
 		pushed_back.pop_back();
@@ -269,28 +257,32 @@ bool TLB::tick(SST::Cycle_t x)
 		int hit_id=0;
 
 		// We check the structures in parallel to find if it hits
+		int hit_entry=-1;
 		for(int k=0; k < sizes; k++)
-			if(check_hit(addr, k) || (perfect==1))
+		{
+			hit_entry = find_entry(addr, k);
+			if((hit_entry >= 0) || (perfect==1))
 			{
 				hit=true;
 				hit_id=k;
 				break;
 			}
+		}
 
 		// If it hist in any page size structure, we update the lru position of the translation and update statistics
 		if(hit)
 		{
 
-			update_lru(addr, hit_id);
+			if(hit_entry >= 0)
+				touch(hit_entry);
+			else
+				update_lru(addr, hit_id);
 			hits++;
 			statTLBHits->addData(1);
-			if(parallel_mode)
-				ready_by[ev] = x;
-			else
-				ready_by[ev] = x + latency;
 
 			// Tracking the hit request size
-			ready_by_size[ev] = page_size[hit_id]/1024;
+			ReadyRequest ready = { ev, parallel_mode ? x : x + latency, page_size[hit_id]/1024 };
+			ready_by.push_back(ready);
 
 			st_1 = not_serviced.erase(st_1);
 		}
@@ -298,22 +290,21 @@ bool TLB::tick(SST::Cycle_t x)
 		{
 
 			// Making sure we have a room for an additional miss, i.e., less than the maximum outstanding misses
-			if((int) pending_misses.size() < (int) max_outstanding)
+			if(pending_misses < max_outstanding)
 			{	
 
 				// Check if the miss is not currently being handled
 				bool currently_handled=false;
-				if((level==1) && (PENDING_MISS.find(addr/4096) != PENDING_MISS.end()))
-				{
-
-					SAME_MISS[addr/4096][ev]=1; // Just adding it to the 2D map, so we later hand it back once the master miss is complete
-					currently_handled = true;
-				}
-				else if(level==1)
+				if(level==1)
 				{
-
-					PENDING_MISS[addr/4096]=1;
-
+					std::unordered_map<long long int, std::vector<SST::Event *>>::iterator same = SAME_MISS.find(addr/4096);
+					if(same != SAME_MISS.end())
+					{
+						same->second.push_back(ev); // We later hand it back once the master miss is complete
+						currently_handled = true;
+					}
+					else
+						SAME_MISS[addr/4096]; // This miss becomes the master miss for the page
 				}
 
 				statTLBMisses->addData(1);
@@ -322,7 +313,7 @@ bool TLB::tick(SST::Cycle_t x)
 				if(!currently_handled)
 				{
 
-					pending_misses.push_back(*st_1);
+					pending_misses++;
 					// Check if the last level TLB or not, if last-level, pass the request to the page table walker
 					if(next_level!=NULL)
 					{
@@ -351,86 +342,69 @@ bool TLB::tick(SST::Cycle_t x)
 	}
 
 
-	std::map<SST::Event *, SST::Cycle_t>::iterator st, en;
-	st = ready_by.begin();
-	en = ready_by.end();
-
-	// We iterate over the list of being serviced request to see if any has finished by this cycle
-	while(st!=en)
+	// We iterate over the list of being serviced request to see if any has finished by this cycle, keeping the others in order
+	size_t kept=0;
+	completed.clear();
+	for(size_t i=0; i < ready_by.size(); i++)
 	{
 
-		bool deleted=false;
-		if(st->second <= x)
-		{
-
-			//	std::cout<<"The request was read at "<<st->second<<" The time now is "<<x<<std::endl;
-
-			uint64_t addr = ((MemEvent*) st->first)->getVirtualAddress();
-
-
-			if(SIZE_LOOKUP.find(ready_by_size[st->first])!= SIZE_LOOKUP.end())
-			{
-				// Double checking that we actually still don't have it inserted
-				if(!check_hit(addr, SIZE_LOOKUP[ready_by_size[st->first]]))
-				{
-					insert_way(addr, find_victim_way(addr, SIZE_LOOKUP[ready_by_size[st->first]]), SIZE_LOOKUP[ready_by_size[st->first]]);
-					update_lru(addr, SIZE_LOOKUP[ready_by_size[st->first]]);
-				}
-				else
-					update_lru(addr, SIZE_LOOKUP[ready_by_size[st->first]]);
-			}
-
+		if(ready_by[i].ready > x)
+			ready_by[kept++] = ready_by[i];
+		else
+			completed.push_back(ready_by[i]);
 
+	}
+	ready_by.resize(kept);
 
-			service_back->push_back(st->first);
+	// Requests finishing together go back in Event order, as they did when ready_by was a map keyed by the Event, so the fills below touch the LRU state in the same order
+	std::sort(completed.begin(), completed.end(), completed_before);
 
-			(*service_back_size)[st->first]=ready_by_size[st->first];
+	for(std::vector<ReadyRequest>::iterator req = completed.begin(); req != completed.end(); req++)
+	{
 
+		uint64_t addr = ((MemEvent*) req->ev)->getVirtualAddress();
 
+		std::map<long long int, int>::iterator lu = SIZE_LOOKUP.find(req->size);
+		if(lu != SIZE_LOOKUP.end())
+			fill(addr, lu->second);
 
-			ready_by_size.erase(st->first);
+		service_back->push_back(req->ev);
 
-			deleted = true;
+		(*service_back_size)[req->ev]=req->size;
 
+	}
 
-			// Deleting it from pending requests
-			std::vector<SST::Event *>::iterator st2, en2;
-			st2 = pending_misses.begin();
-			en2 = pending_misses.end();
 
 
-			while(st2!=en2)
-			{
-				if(*st2 == st->first)
-				{
-					pending_misses.erase(st2);
-					break;
-				}
-				st2++;
-			}
+	return false;
+}
 
-			ready_by.erase(st);
 
-		}
-		if(deleted)
-			st=ready_by.begin();
-		else
-			st++;
-
-	}
+// The page number of an address on structure struct_id
+long long int TLB::page_number(long long int vaddr, int struct_id)
+{
+	if(page_shift[struct_id] >= 0 && vaddr >= 0)
+		return vaddr >> page_shift[struct_id];
 
+	return vaddr/page_size[struct_id];
+}
 
+// The set an address maps to on structure struct_id
+int TLB::set_index(long long int vaddr, int struct_id)
+{
+	long long int vpn = page_number(vaddr, struct_id);
+	if(set_mask[struct_id] >= 0 && vpn >= 0)
+		return vpn & set_mask[struct_id];
 
-	return false;
+	return abs_int(vpn%sets[struct_id]);
 }
 
-
 // Used to insert a new translation on a specific way of the TLB structure
 void TLB::insert_way(long long int vaddr, int way, int struct_id)
 {
 
-	int set=abs_int((vaddr/page_size[struct_id])%sets[struct_id]);
-	tags[struct_id][set][way]=vaddr/page_size[struct_id];
+	int set=set_index(vaddr, struct_id);
+	tags[base[struct_id] + set*assoc[struct_id] + way]=page_number(vaddr, struct_id);
 
 
 }
@@ -446,55 +420,103 @@ long long int TLB::translate(long long int vadd)
 
 
 
-// Find if the translation  exists on structure struct_id
-bool TLB::check_hit(long long int vadd, int struct_id)
+// Find the entry holding the translation on structure struct_id, the ways of the set are compared four at a time when AVX2 is available
+int TLB::find_entry(long long int vadd, int struct_id)
 {
 
+	long long int vpn = page_number(vadd, struct_id);
+	int first = base[struct_id] + set_index(vadd, struct_id)*assoc[struct_id];
+	const long long int * set_tags = &tags[first];
+	int i=0;
 
-	int set= abs_int((vadd/page_size[struct_id])%sets[struct_id]);
-	for(int i=0; i<assoc[struct_id];i++)
-		if(tags[struct_id][set][i]==vadd/page_size[struct_id])
-			return true;
+#ifdef __AVX2__
+	const __m256i key = _mm256_set1_epi64x(vpn);
+	for(; i + 4 <= assoc[struct_id]; i += 4)
+	{
+		__m256i ways = _mm256_loadu_si256((const __m256i *) (set_tags + i));
+		int match = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(ways, key)));
+		if(match)
+			return first + i + __builtin_ctz(match);
+	}
+#endif
 
-	return false;
+	for(; i<assoc[struct_id];i++)
+		if(set_tags[i]==vpn)
+			return first + i;
+
+	return -1;
 }
 
 // To insert the translaiton
 int TLB::find_victim_way(long long int vadd, int struct_id)
 {
 
-	int set= abs_int((vadd/page_size[struct_id])%sets[struct_id]);
+	int first = base[struct_id] + set_index(vadd, struct_id)*assoc[struct_id];
 
-	for(int i=0; i<assoc[struct_id]; i++)
-		if(lru[struct_id][set][i]==(assoc[struct_id]-1))
-			return i;
+	int victim=0;
+	for(int i=1; i<assoc[struct_id]; i++)
+		if(age[first + i] < age[first + victim])
+			victim = i;
 
+	return victim;
+}
+
+void TLB::touch(int entry)
+{
+
+	if(++use_clock == 0)
+		rebase_ages();
+
+	age[entry] = use_clock;
+
+}
+
+void TLB::fill(long long int vaddr, int struct_id)
+{
+
+	int entry = find_entry(vaddr, struct_id);
+	if(entry < 0)
+	{
+		int way = find_victim_way(vaddr, struct_id);
+		insert_way(vaddr, way, struct_id);
+		entry = base[struct_id] + set_index(vaddr, struct_id)*assoc[struct_id] + way;
+	}
+
+	touch(entry);
 
-	return 0;
 }
 
 // This function updates the LRU position for a given address of a specific structure
 void TLB::update_lru(long long int vaddr, int struct_id)
 {
 
-	int lru_place=assoc[struct_id]-1;
+	int entry = find_entry(vaddr, struct_id);
 
-	int set= abs_int((vaddr/page_size[struct_id])%sets[struct_id]);
-	for(int i=0; i<assoc[struct_id];i++)
-		if(tags[struct_id][set][i]==vaddr/page_size[struct_id])
-		{
-			lru_place = lru[struct_id][set][i];
-			break;
-		}
-	for(int i=0; i<assoc[struct_id];i++)
-	{
-		if(lru[struct_id][set][i]==lru_place)
-			lru[struct_id][set][i]=0;
-		else if(lru[struct_id][set][i]<lru_place)
-			lru[struct_id][set][i]++;
-	}
+	// As with LRU positions, a missing translation makes the victim way the most recently used
+	if(entry < 0)
+		entry = base[struct_id] + set_index(vaddr, struct_id)*assoc[struct_id] + find_victim_way(vaddr, struct_id);
 
+	touch(entry);
 
 }
 
+void TLB::rebase_ages()
+{
 
+	use_clock = 0;
+	std::vector<std::pair<uint32_t, int> > order;
+	for(int id=0; id < sizes; id++)
+		for(int set=0; set < sets[id]; set++)
+		{
+			int first = base[id] + set*assoc[id];
+			order.clear();
+			for(int i=0; i < assoc[id]; i++)
+				order.push_back(std::make_pair(age[first + i], i));
+			std::sort(order.begin(), order.end());
+
+			for(int rank=0; rank < assoc[id]; rank++)
+				age[first + order[rank].second] = rank;
+			use_clock = std::max(use_clock, (uint32_t) assoc[id]);
+		}
+
+}
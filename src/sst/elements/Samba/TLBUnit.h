@@ -23,7 +23,9 @@
 #include <sst/elements/memHierarchy/memEvent.h>
 #include "PageTableWalker.h"
 #include<map>
+#include<unordered_map>
 #include<vector>
+#include<functional>
 
 // This file defines a TLB structure
 
@@ -42,9 +44,22 @@ class TLB
 
 	int * assoc; // This represents the associativiety
 
-	long long int *** tags; // This will hold the tags
+	/* The tags of all structures live in one array: the ways of a set are contiguous, so a
+	 * lookup is a single vector compare over them, and structure i starts at base[i].
+	 * Each entry has an age, the value of use_clock when it was last touched; the victim
+	 * in a set is the entry with the smallest age, which gives the same order as LRU positions.
+	 */
+	std::vector<long long int> tags; // This will hold the tags, -1 if invalid
 
-	int *** lru; // This will hold the lru positions
+	std::vector<uint32_t> age; // This will hold the last use of each entry
+
+	uint32_t use_clock; // Incremented on every use of an entry
+
+	int * base; // Index of the first entry of each structure
+
+	int * page_shift; // log2 of the page size, or -1 if the page size is not a power of two
+
+	int * set_mask; // sets-1 if the number of sets is a power of two, otherwise -1
 
 	TLB * next_level; // a pointer to the next level Samba structure
 
@@ -52,8 +67,8 @@ class TLB
 
 	std::map<long long int, int> SIZE_LOOKUP; // This structure checks if a size is supported inside the structure, and its index structure
 
-	std::map< long long int, std::map< SST::Event *, int>> SAME_MISS; // This tracks the misses for the same location and deduplicates them
-	std::map<long long int, int> PENDING_MISS; // This tracks the addresses of the current master misses (other contained misses are tracked in SAME_MISS)
+	// This tracks the misses for the same 4KB page and deduplicates them, like MSHRs: a page has an entry while its master miss is outstanding, holding the misses waiting for it
+	std::unordered_map<long long int, std::vector<SST::Event *>> SAME_MISS;
 
 	int  * sets; //stores the number of sets
 
@@ -81,15 +96,23 @@ class TLB
 
 	std::map<SST::Event *, long long int> * service_back_size; // This is used to pass the size of the  requests back to the previous level
 
-	std::map<SST::Event *, SST::Cycle_t > ready_by; // this one is used to keep track of requests that are delayed inside this structure, compensating for latency
+	struct ReadyRequest {
+		SST::Event * ev;
+		SST::Cycle_t ready; // The cycle the request leaves this structure, compensating for latency
+		long long int size; // The size of the translation
+	};
+
+	std::vector<ReadyRequest> ready_by; // this one is used to keep track of requests that are delayed inside this structure, in the order they were scheduled
+
+	std::vector<ReadyRequest> completed; // The requests of ready_by that finished on this cycle
 
-	std::map<SST::Event *, long long int> ready_by_size; // this one is used to keep track of requests' sizes inside this structure
+	static bool completed_before(const ReadyRequest & a, const ReadyRequest & b) { return std::less<SST::Event *>()(a.ev, b.ev); }
 
 	std::vector<SST::Event *> pushed_back; // This is what we got returned from other structures
 
 	std::map<SST::Event *, long long int> pushed_back_size; // This is the sizes of the translations we got returned from other structures
 
-	std::vector<SST::Event *> pending_misses; // This the number of pending misses, only erased when pushed back from next level
+	int pending_misses; // This the number of pending misses, only decremented when pushed back from next level
 
 	std::vector<SST::Event *> not_serviced; // This holds those accesses not serviced yet
 
@@ -108,7 +131,16 @@ class TLB
 	void finish(){}
 
 	// Find if it exists
-	bool check_hit(long long int vadd, int struct_id);
+	bool check_hit(long long int vadd, int struct_id) { return find_entry(vadd, struct_id) >= 0; }
+
+	// The index of the entry holding the translation on structure struct_id, or -1
+	int find_entry(long long int vadd, int struct_id);
+
+	// Marks an entry as the most recently used of its set
+	void touch(int entry);
+
+	// Inserts the translation if it is missing and makes it the most recently used
+	void fill(long long int vadd, int struct_id);
 
 	// To insert the translaiton
 	int find_victim_way(long long int vadd, int struct_id);
@@ -123,6 +155,13 @@ class TLB
 
 	void update_lru(long long int vaddr, int struct_id);
 
+	long long int page_number(long long int vaddr, int struct_id);
+
+	int set_index(long long int vaddr, int struct_id);
+
+	// Restarts the ages from zero, keeping their order within each set, once use_clock wraps around
+	void rebase_ages();
+
 
 	Statistic<uint64_t>* statTLBHits;
 
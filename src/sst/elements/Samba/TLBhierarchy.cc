@@ -168,11 +168,15 @@ bool TLBhierarchy::tick(SST::Cycle_t x)
 		if(emulate_faults)
 		{
 			long long int vaddr = ((MemEvent*) event)->getVirtualAddress();
-			if((*PTE).find(vaddr/4096)==(*PTE).end())
+			long long int frame = page_table->find(vaddr, PageTable::PTE);
+			if(frame == -1)
+			{
 				std::cout<<"Error: That page has never been mapped:  " << vaddr / 4096 << std::endl;
+				frame = 0;
+			}
 
-			((MemEvent*) event)->setAddr((((*PTE)[vaddr / 4096] + vaddr % 4096) / 64) * 64);
-			((MemEvent*) event)->setBaseAddr((((*PTE)[vaddr / 4096] + vaddr % 4096) / 64) * 64);
+			((MemEvent*) event)->setAddr(((frame + vaddr % 4096) / 64) * 64);
+			((MemEvent*) event)->setBaseAddr(((frame + vaddr % 4096) / 64) * 64);
 		}
 		to_cache->send(event);
 
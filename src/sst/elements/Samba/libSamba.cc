@@ -66,6 +66,11 @@ static const ElementInfoParam Samba_params[] = {
     {"page_walk_latency", "Each page table walk latency in nanoseconds", "50"},
     {"self_connected", "Determines if the page walkers are acutally connected to memory hierarchy or just add fixed latency (self-connected)", "0"},
     {"emulate_faults", "This indicates if the page faults should be emulated through requesting pages from Opal", "0"},
+    {"size%(4)d_PTWC", "the number of entries of the page walk cache for whole translations (1), PMD (2), PUD (3) and PGD (4) entries, 0 leaves that cache out", "1"},
+    {"assoc%(4)d_PTWC", "the associativity of the page walk cache number x", "1"},
+    {"latency_PTWC", "the access latency in cycles of the page walk caches", "1"},
+    {"max_outstanding_PTWC", "the number of page walks in flight", "4"},
+    {"max_width_PTWC", "the number of accesses to the page walk caches on the same cycle", "4"},
     {NULL, NULL, NULL},
 };
 
@@ -0,0 +1,64 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "arielblocktracegen.h"
+
+using namespace SST::ArielComponent;
+
+ArielBlockTraceGenerator::ArielBlockTraceGenerator(Component* owner, Params& params) :
+    ArielTraceGenerator() {
+
+    tracePrefix = params.find<std::string>("trace_prefix", "ariel-core");
+    blockSize = params.find<size_t>("block_size", PROSPERO_BLOCK_DEFAULT_SIZE);
+    compressionLevel = params.find<int>("compression_level", 6);
+    coreID = 0;
+}
+
+ArielBlockTraceGenerator::~ArielBlockTraceGenerator() {
+    if(!traceFile.close()) {
+        fprintf(stderr, "ARIEL: Error writing block trace for core %" PRIu32 "\n", coreID);
+    }
+}
+
+void ArielBlockTraceGenerator::publishEntry(const uint64_t picoS,
+        const uint64_t physAddr,
+        const uint32_t reqLength,
+        const ArielTraceEntryOperation op) {
+
+    const char op_type = (READ == op) ? 'R' : 'W';
+    char record[sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t)];
+
+    memcpy(&record[0], &picoS, sizeof(uint64_t));
+    memcpy(&record[sizeof(uint64_t)], &op_type, sizeof(char));
+    memcpy(&record[sizeof(uint64_t) + sizeof(char)], &physAddr, sizeof(uint64_t));
+    memcpy(&record[sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t)], &reqLength, sizeof(uint32_t));
+
+    traceFile.append(record, sizeof(record));
+}
+
+void ArielBlockTraceGenerator::setCoreID(const uint32_t core) {
+    coreID = core;
+
+    char* tracePath = (char*) malloc(sizeof(char) * PATH_MAX);
+    sprintf(tracePath, "%s-%" PRIu32 ".trace.blk", tracePrefix.c_str(), core);
+
+    if(!traceFile.open(tracePath, blockSize, compressionLevel)) {
+        fprintf(stderr, "ARIEL: Unable to open block trace file: %s\n", tracePath);
+        exit(-1);
+    }
+
+    free(tracePath);
+}
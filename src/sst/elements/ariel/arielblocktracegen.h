@@ -0,0 +1,69 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+
+#ifndef _H_SST_ARIEL_BLOCK_TRACE_GEN
+#define _H_SST_ARIEL_BLOCK_TRACE_GEN
+
+#include <climits>
+
+#include <sst/core/params.h>
+#include <sst/elements/prospero/prosblockformat.h>
+#include "arieltracegen.h"
+
+namespace SST {
+namespace ArielComponent {
+
+/*
+ * Writes the binary records of the compressed generator into the block
+ * compressed container, which Prospero (ProsperoBlockTraceReader) reads
+ * back with blocks decoded in parallel and can start from any record.
+ */
+class ArielBlockTraceGenerator : public ArielTraceGenerator {
+
+public:
+
+    SST_ELI_REGISTER_MODULE(ArielBlockTraceGenerator, "ariel", "BlockTraceGenerator",
+            SST_ELI_ELEMENT_VERSION(1,0,0), "Provides tracing to block compressed file capabilities", "SST::ArielComponent::ArielTraceGenerator")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "trace_prefix", "Sets the prefix for the trace file, followed by -<core>", "ariel-core" },
+        { "block_size", "Bytes of trace compressed together in one block", "1048576" },
+        { "compression_level", "zlib compression level from 1 (fastest) to 9 (smallest)", "6" }
+    )
+
+    ArielBlockTraceGenerator(Component* owner, Params& params);
+
+    ~ArielBlockTraceGenerator();
+
+    void publishEntry(const uint64_t picoS, const uint64_t physAddr,
+            const uint32_t reqLength, const ArielTraceEntryOperation op);
+
+    void setCoreID(const uint32_t core);
+
+private:
+    SST::Prospero::ProsperoBlockWriter traceFile;
+    std::string tracePrefix;
+    uint32_t coreID;
+    size_t blockSize;
+    int compressionLevel;
+
+};
+
+}
+}
+
+#endif
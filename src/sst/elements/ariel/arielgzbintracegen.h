@@ -33,7 +33,7 @@ public:
     SST_ELI_REGISTER_MODULE(ArielCompressedBinaryTraceGenerator, "ariel", "CompressedBinaryTraceGenerator",
             SST_ELI_ELEMENT_VERSION(1,0,0), "Provides tracing to compressed file capabilities", "SST::ArielComponent::ArielTraceGenerator")
     
-    SST_ELI_DOCUMENT_PARAMS( { "trace_prefix", "Sets the prefix for the trace file", "ariel-core-" } )
+    SST_ELI_DOCUMENT_PARAMS( { "trace_prefix", "Sets the prefix for the trace file, followed by -<core>", "ariel-core" } )
 
     ArielCompressedBinaryTraceGenerator(Component* owner, Params& params);
 
@@ -0,0 +1,73 @@
+import sst
+import sys,getopt
+
+# Replays a trace recorded by runstreamTrace.py through Prospero,
+# --TraceGen=compressed or block, with --DecodeThreads workers decoding a
+# block trace.
+
+reader = "prospero.ProsperoBlockTraceReader"
+traceFile = "ariel-core-0.trace.blk"
+decodeThreads = "2"
+
+try:
+	opts, args = getopt.getopt(sys.argv[1:], "", ["TraceGen=","DecodeThreads="])
+except getopt.GetoptError as err:
+	print str(err)
+	sys.exit(2)
+for o, a in opts:
+	if o == "--TraceGen":
+		if a == "compressed":
+			reader = "prospero.ProsperoCompressedBinaryTraceReader"
+			traceFile = "ariel-core-0.trace.gz"
+		elif a == "block":
+			reader = "prospero.ProsperoBlockTraceReader"
+			traceFile = "ariel-core-0.trace.blk"
+		else:
+			print "Unknown trace generator", a
+			sys.exit(2)
+	elif o == "--DecodeThreads":
+		decodeThreads = a
+
+sst.setProgramOption("timebase", "1ps")
+
+cpu = sst.Component("cpu", "prospero.prosperoCPU")
+cpu.addParams({
+	"verbose" : "0",
+	"reader" : reader,
+	"readerParams.file" : traceFile,
+	"readerParams.decode_threads" : decodeThreads
+})
+
+l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+l1cache.addParams({
+	"cache_frequency" : "2 Ghz",
+	"cache_size" : "64 KB",
+	"coherence_protocol" : "MSI",
+	"replacement_policy" : "lru",
+	"associativity" : "8",
+	"access_latency_cycles" : "1",
+	"cache_line_size" : "64",
+	"L1" : "1"
+})
+
+memory = sst.Component("memory", "memHierarchy.MemController")
+memory.addParams({
+	"coherence_protocol" : "MSI",
+	"backend.access_time" : "10ns",
+	"backend.mem_size" : "2048MiB",
+	"clock" : "1GHz"
+})
+
+cpu_cache_link = sst.Link("cpu_cache_link")
+cpu_cache_link.connect( (cpu, "cache_link", "50ps"), (l1cache, "high_network_0", "50ps") )
+
+memory_link = sst.Link("mem_bus_link")
+memory_link.connect( (l1cache, "low_network_0", "50ps"), (memory, "direct_link", "50ps") )
+
+sst.setStatisticLoadLevel(5)
+sst.setStatisticOutput("sst.statOutputConsole")
+
+l1cache.enableStatistics([
+      "CacheHits",
+      "CacheMisses"
+])
@@ -0,0 +1,79 @@
+import sst
+import os
+import sys,getopt
+
+# Runs stream through Ariel with a trace generator recording every memory
+# operation, --TraceGen=compressed or block. The generator is left on its
+# default trace_prefix so the trace is written to ariel-core-0.trace.gz or
+# ariel-core-0.trace.blk.
+
+traceGen = "ariel.BlockTraceGenerator"
+
+try:
+	opts, args = getopt.getopt(sys.argv[1:], "", ["TraceGen="])
+except getopt.GetoptError as err:
+	print str(err)
+	sys.exit(2)
+for o, a in opts:
+	if o == "--TraceGen":
+		if a == "compressed":
+			traceGen = "ariel.CompressedBinaryTraceGenerator"
+		elif a == "block":
+			traceGen = "ariel.BlockTraceGenerator"
+		else:
+			print "Unknown trace generator", a
+			sys.exit(2)
+
+sst.setProgramOption("timebase", "1ps")
+
+sst_root = os.getenv( "SST_ROOT" )
+
+ariel = sst.Component("a0", "ariel.ariel")
+ariel.addParams({
+        "verbose" : "0",
+        "maxcorequeue" : "256",
+        "maxissuepercycle" : "2",
+        "pipetimeout" : "0",
+        "executable" : sst_root + "/sst-elements/src/sst/elements/ariel/frontend/simple/examples/stream/stream",
+        "arielmode" : "1",
+        "memmgr.memorylevels" : "1",
+        "memmgr.defaultlevel" : "0",
+        "tracegen" : traceGen
+        })
+
+l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+l1cache.addParams({
+        "cache_frequency" : "2 Ghz",
+        "cache_size" : "64 KB",
+        "coherence_protocol" : "MSI",
+        "replacement_policy" : "lru",
+        "associativity" : "8",
+        "access_latency_cycles" : "1",
+        "cache_line_size" : "64",
+        "L1" : "1",
+        "debug" : "0",
+	})
+
+memory = sst.Component("memory", "memHierarchy.MemController")
+memory.addParams({
+        "coherence_protocol" : "MSI",
+        "backend.access_time" : "10ns",
+        "backend.mem_size" : "2048MiB",
+        "clock" : "1GHz"
+        })
+
+cpu_cache_link = sst.Link("cpu_cache_link")
+cpu_cache_link.connect( (ariel, "cache_link_0", "50ps"), (l1cache, "high_network_0", "50ps") )
+
+memory_link = sst.Link("mem_bus_link")
+memory_link.connect( (l1cache, "low_network_0", "50ps"), (memory, "direct_link", "50ps") )
+
+sst.setStatisticLoadLevel(5)
+sst.setStatisticOutput("sst.statOutputConsole")
+
+ariel.enableStatistics([
+      "cycles",
+      "instruction_count",
+      "read_requests",
+      "write_requests"
+])
@@ -0,0 +1,91 @@
+import os
+import subprocess
+import sys
+
+# Records stream with the Ariel CompressedBinaryTraceGenerator and the
+# BlockTraceGenerator and checks the two recordings hold the same trace.
+#
+# The generators do not change the timing, so both Ariel runs have to give
+# the same output, and each must leave its trace under the default prefix.
+# Prospero then replays both traces, the block one with its blocks decoded
+# on the simulation thread and on worker threads, and every replay has to
+# match the replay of the compressed trace.
+#
+# Run from within ariel/frontend/simple/examples/stream/ with SST_ROOT set
+# and stream built:
+#   python ./test_tracegen.py
+
+# a single OpenMP thread keeps the recorded trace the same from run to run
+env = dict(os.environ)
+env["OMP_NUM_THREADS"] = "1"
+
+traceFiles = { "compressed" : "ariel-core-0.trace.gz",
+               "block" : "ariel-core-0.trace.blk" }
+
+def run_sst(sdl, options):
+    # set the command
+    osCmd = "sst " + sdl + " --model-options=\"" + options + "\""
+    print osCmd
+
+    # run SST
+    p = subprocess.Popen(osCmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE, shell=True, env=env)
+    output, err = p.communicate()
+
+    if p.returncode != 0:
+        print "SST failed: ", err
+        sys.exit(1)
+
+    # the runs only differ in the trace they write or read
+    outputLines = list()
+    for line in output.split("\n"):
+        if line.find("ariel-core-0") == -1:
+            outputLines.append(line)
+
+    return outputLines
+
+results = ""
+failed = False
+
+arielOutput = dict()
+for traceGen in ["compressed", "block"]:
+    if os.path.exists(traceFiles[traceGen]):
+        os.remove(traceFiles[traceGen])
+
+    arielOutput[traceGen] = run_sst("runstreamTrace.py", "--TraceGen=" + traceGen)
+
+    if os.path.exists(traceFiles[traceGen]):
+        results += "[v] " + traceGen + " trace written to " + traceFiles[traceGen] + "\n"
+    else:
+        results += "[x] " + traceGen + " trace written to " + traceFiles[traceGen] + "\n"
+        print "-----RUNNING ARIEL TRACEGEN-----"
+        print(results)
+        sys.exit(1)
+
+if arielOutput["compressed"] == arielOutput["block"]:
+    results += "[v] Ariel output matches with either generator\n"
+else:
+    results += "[x] Ariel output matches with either generator\n"
+    failed = True
+
+compressedReplay = run_sst("replaystreamTrace.py", "--TraceGen=compressed")
+
+for decodeThreads in ["0", "2"]:
+    blockReplay = run_sst("replaystreamTrace.py", "--TraceGen=block --DecodeThreads=" + decodeThreads)
+
+    if blockReplay == compressedReplay:
+        results += "[v] Block replay with decodeThreads=" + decodeThreads + " matches the compressed replay\n"
+    else:
+        results += "[x] Block replay with decodeThreads=" + decodeThreads + " matches the compressed replay\n"
+        failed = True
+        for compressedLine, blockLine in zip(compressedReplay, blockReplay):
+            if compressedLine != blockLine:
+                results += "    compressed: " + compressedLine + "\n"
+                results += "    block:      " + blockLine + "\n"
+                break
+
+print "-----RUNNING ARIEL TRACEGEN-----"
+print(results)
+print("done.\n")
+
+if failed:
+    sys.exit(1)
@@ -0,0 +1,168 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "baseprefetch.h"
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace SST::Cassini;
+
+BasePrefetcher::BasePrefetcher(Component* owner, Params& params) : CacheListener(owner, params),
+	recentPrefetches(params.find<uint32_t>("history", 64), 8) {
+
+	Simulation::getSimulation()->requireEvent("memHierarchy.MemEvent");
+
+	char* new_prefix = (char*) malloc(sizeof(char) * 128);
+	sprintf(new_prefix, "Prefetcher[%s | @f:@p:@l] ", parent->getName().c_str());
+	output = new Output(new_prefix, params.find<int>("verbose", 0), 0, Output::STDOUT);
+	free(new_prefix);
+
+	blockSize = params.find<uint64_t>("cache_line_size", 64);
+	pageSize = params.find<uint64_t>("page_size", 4096);
+	overrunPageBoundary = params.find<uint32_t>("overrun_page_boundaries", 0) != 0;
+
+	degree = params.find<uint32_t>("degree", 2);
+	maxDegree = params.find<uint32_t>("max_degree", 8);
+	throttleInterval = params.find<uint32_t>("throttle_interval", 256);
+	highAccuracy = params.find<double>("throttle_high_accuracy", 0.75);
+	lowAccuracy = params.find<double>("throttle_low_accuracy", 0.40);
+
+	if(blockSize == 0) {
+		output->fatal(CALL_INFO, -1, "Invalid param(%s): cache_line_size - must be greater than 0\n", parent->getName().c_str());
+	}
+	if(degree == 0) degree = 1;
+	if(maxDegree < degree) maxDegree = degree;
+
+	intervalOutcomes = intervalUsed = intervalUnused = 0;
+
+	statPrefetchEventsIssued = registerStatistic<uint64_t>("prefetches_issued");
+	statPrefetchIssueCanceledByPageBoundary = registerStatistic<uint64_t>("prefetches_canceled_by_page_boundary");
+	statPrefetchIssueCanceledByHistory = registerStatistic<uint64_t>("prefetches_canceled_by_history");
+	statPrefetchUseful = registerStatistic<uint64_t>("prefetch_useful");
+	statPrefetchLate = registerStatistic<uint64_t>("prefetch_late");
+	statPrefetchRedundant = registerStatistic<uint64_t>("prefetch_redundant");
+	statPrefetchDropped = registerStatistic<uint64_t>("prefetch_dropped");
+	statPrefetchUnused = registerStatistic<uint64_t>("prefetch_unused");
+	statDegreeRaised = registerStatistic<uint64_t>("prefetch_degree_raised");
+	statDegreeLowered = registerStatistic<uint64_t>("prefetch_degree_lowered");
+}
+
+BasePrefetcher::~BasePrefetcher() {
+	delete output;
+}
+
+void BasePrefetcher::notifyAccess(const CacheListenerNotification& notify) {
+	candidates.clear();
+	train(notify, candidates);
+
+	const Addr triggerAddr = notify.getPhysicalAddress();
+	for(size_t i = 0; i < candidates.size(); i++) {
+		issuePrefetch(triggerAddr, lineAddress(candidates[i]));
+	}
+}
+
+void BasePrefetcher::issuePrefetch(Addr triggerAddr, Addr prefetchAddr) {
+	if(prefetchAddr == lineAddress(triggerAddr)) return;
+
+	if(! overrunPageBoundary && (prefetchAddr / pageSize) != (triggerAddr / pageSize)) {
+		output->verbose(CALL_INFO, 2, 0, "Cancel prefetch of %" PRIx64 ", request exceeds physical page limit\n", prefetchAddr);
+		statPrefetchIssueCanceledByPageBoundary->addData(1);
+		return;
+	}
+
+	if(recentPrefetches.find(prefetchAddr) != NULL) {
+		output->verbose(CALL_INFO, 2, 0, "Cancel prefetch of %" PRIx64 ", line is in the recent prefetch history\n", prefetchAddr);
+		statPrefetchIssueCanceledByHistory->addData(1);
+		return;
+	}
+	recentPrefetches.insert(prefetchAddr);
+
+	output->verbose(CALL_INFO, 2, 0, "Issue prefetch, trigger address: %" PRIx64 ", prefetch address: %" PRIx64 "\n", triggerAddr, prefetchAddr);
+	statPrefetchEventsIssued->addData(1);
+
+	// Cycle over each registered call back and notify them that we want to issue a prefetch request
+	for(std::vector<Event::HandlerBase*>::iterator callbackItr = registeredCallbacks.begin(); callbackItr != registeredCallbacks.end(); callbackItr++) {
+		// Create a new read request, we cannot issue a write because the data will get
+		// overwritten and corrupt memory (even if we really do want to do a write)
+		MemEvent* newEv = new MemEvent(parent, prefetchAddr, prefetchAddr, Command::GetS);
+		newEv->setSize(blockSize);
+		newEv->setPrefetchFlag(true);
+		(*(*callbackItr))(newEv);
+	}
+}
+
+void BasePrefetcher::notifyPrefetchResult(const Addr baseAddr, NotifyPrefetchResultType result) {
+	switch(result) {
+	case PREFETCH_USEFUL:
+		statPrefetchUseful->addData(1);
+		intervalUsed++;
+		break;
+	case PREFETCH_LATE:
+		statPrefetchLate->addData(1);
+		intervalUsed++;
+		break;
+	case PREFETCH_REDUNDANT:
+		statPrefetchRedundant->addData(1);
+		break;
+	case PREFETCH_DROPPED:
+		statPrefetchDropped->addData(1);
+		break;
+	case PREFETCH_UNUSED:
+		statPrefetchUnused->addData(1);
+		intervalUnused++;
+		break;
+	}
+
+	if(throttleInterval != 0 && ++intervalOutcomes == throttleInterval) {
+		adjustDegree();
+	}
+
+	feedback(baseAddr, result);
+}
+
+/*
+ * Accuracy is judged only on prefetches whose fate is known (used or evicted unused);
+ * redundant and dropped prefetches cost bandwidth in the prefetcher but not cache capacity
+ */
+void BasePrefetcher::adjustDegree() {
+	const uint32_t resolved = intervalUsed + intervalUnused;
+	if(resolved != 0) {
+		const double accuracy = (double) intervalUsed / (double) resolved;
+
+		if(accuracy >= highAccuracy && degree < maxDegree) {
+			degree++;
+			statDegreeRaised->addData(1);
+		} else if(accuracy < lowAccuracy && degree > 1) {
+			degree--;
+			statDegreeLowered->addData(1);
+		}
+
+		output->verbose(CALL_INFO, 1, 0, "Prefetch accuracy %.3f over %" PRIu32 " outcomes, degree now %" PRIu32 "\n",
+			accuracy, intervalOutcomes, degree);
+	}
+
+	intervalOutcomes = intervalUsed = intervalUnused = 0;
+}
+
+void BasePrefetcher::registerResponseCallback(Event::HandlerBase *handler) {
+	registeredCallbacks.push_back(handler);
+}
+
+void BasePrefetcher::printStats(Output &out) {
+	out.output("  Prefetcher degree: %" PRIu32 " (max %" PRIu32 ")\n", degree, maxDegree);
+}
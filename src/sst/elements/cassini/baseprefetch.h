@@ -0,0 +1,130 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_CASSINI_BASE_PREFETCH
+#define _H_SST_CASSINI_BASE_PREFETCH
+
+#include <vector>
+
+#include <sst/core/event.h>
+#include <sst/core/sst_types.h>
+#include <sst/core/component.h>
+#include <sst/core/elementinfo.h>
+#include <sst/core/output.h>
+#include <sst/elements/memHierarchy/memEvent.h>
+#include <sst/elements/memHierarchy/cacheListener.h>
+
+#include "trainingtable.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+namespace SST {
+namespace Cassini {
+
+#define CASSINI_BASEPREFETCH_ELI_PARAMS \
+	{ "verbose", "Controls the verbosity of the prefetcher", "0" }, \
+	{ "cache_line_size", "Size of the cache line the prefetcher is attached to", "64" }, \
+	{ "page_size", "Page size for this controller", "4096" }, \
+	{ "overrun_page_boundaries", "Allow prefetcher to run over page boundaries, 0 is no, 1 is yes", "0" }, \
+	{ "degree", "Initial number of prefetches issued per trigger", "2" }, \
+	{ "max_degree", "Largest degree the feedback throttle may raise the prefetcher to", "8" }, \
+	{ "history", "Number of recently issued prefetch lines remembered so they are not issued again", "64" }, \
+	{ "throttle_interval", "Number of prefetch outcomes reported by the cache between degree adjustments, 0 disables throttling", "256" }, \
+	{ "throttle_high_accuracy", "Raise the degree if at least this fraction of the prefetches that were used or evicted were used", "0.75" }, \
+	{ "throttle_low_accuracy", "Lower the degree if less than this fraction of the prefetches that were used or evicted were used", "0.40" }
+
+#define CASSINI_BASEPREFETCH_ELI_STATS \
+	{ "prefetches_issued", "Number of prefetch requests issued", "prefetches", 1 }, \
+	{ "prefetches_canceled_by_page_boundary", "Prefetches which would not be executed because they span over a page boundary", "prefetches", 1 }, \
+	{ "prefetches_canceled_by_history", "Prefetches which did not get issued because the line was recently prefetched", "prefetches", 1 }, \
+	{ "prefetch_useful", "Prefetched lines that were hit by a demand request", "prefetches", 1 }, \
+	{ "prefetch_late", "Prefetches still outstanding when a demand request for the line arrived", "prefetches", 1 }, \
+	{ "prefetch_redundant", "Prefetches for lines that were already in the cache", "prefetches", 1 }, \
+	{ "prefetch_dropped", "Prefetches the cache dropped", "prefetches", 1 }, \
+	{ "prefetch_unused", "Prefetched lines that left the cache without being used", "prefetches", 1 }, \
+	{ "prefetch_degree_raised", "Throttle intervals after which the degree was raised", "intervals", 1 }, \
+	{ "prefetch_degree_lowered", "Throttle intervals after which the degree was lowered", "intervals", 1 }
+
+/*
+ * Common base for prefetch engines
+ *
+ * An engine only decides which lines to prefetch: train() sees each access
+ * and appends candidate addresses. The base issues them (dropping duplicates
+ * and, if configured, page crossings), tracks the outcomes the cache reports
+ * back, and adjusts the degree - the number of prefetches engines should
+ * generate per trigger - according to how many prefetches get used.
+ */
+class BasePrefetcher : public SST::MemHierarchy::CacheListener {
+    public:
+	BasePrefetcher(Component* owner, Params& params);
+	virtual ~BasePrefetcher();
+
+	void notifyAccess(const CacheListenerNotification& notify);
+	void notifyPrefetchResult(const Addr baseAddr, NotifyPrefetchResultType result);
+	void registerResponseCallback(Event::HandlerBase *handler);
+	void printStats(Output &out);
+
+    protected:
+	/* Called for every access; append addresses to prefetch, scaled to getDegree() */
+	virtual void train(const CacheListenerNotification& notify, std::vector<Addr>& candidates) = 0;
+
+	/* Called for every outcome the cache reports, after the base has accounted for it */
+	virtual void feedback(const Addr UNUSED(baseAddr), NotifyPrefetchResultType UNUSED(result)) {}
+
+	uint32_t getDegree() const { return degree; }
+	Addr lineAddress(Addr addr) const { return addr - (addr % blockSize); }
+
+	Output* output;
+	uint64_t blockSize;
+	uint64_t pageSize;
+
+    private:
+	void issuePrefetch(Addr triggerAddr, Addr prefetchAddr);
+	void adjustDegree();
+
+	std::vector<Event::HandlerBase*> registeredCallbacks;
+	std::vector<Addr> candidates;
+	TrainingTable<bool> recentPrefetches;
+	bool overrunPageBoundary;
+
+	uint32_t degree;
+	uint32_t maxDegree;
+	uint32_t throttleInterval;
+	double highAccuracy;
+	double lowAccuracy;
+
+	/* Outcomes in the current throttle interval */
+	uint32_t intervalOutcomes;
+	uint32_t intervalUsed;
+	uint32_t intervalUnused;
+
+	Statistic<uint64_t>* statPrefetchEventsIssued;
+	Statistic<uint64_t>* statPrefetchIssueCanceledByPageBoundary;
+	Statistic<uint64_t>* statPrefetchIssueCanceledByHistory;
+	Statistic<uint64_t>* statPrefetchUseful;
+	Statistic<uint64_t>* statPrefetchLate;
+	Statistic<uint64_t>* statPrefetchRedundant;
+	Statistic<uint64_t>* statPrefetchDropped;
+	Statistic<uint64_t>* statPrefetchUnused;
+	Statistic<uint64_t>* statDegreeRaised;
+	Statistic<uint64_t>* statDegreeLowered;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,116 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "boprefetch.h"
+
+#include <algorithm>
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace SST::Cassini;
+
+BestOffsetPrefetcher::BestOffsetPrefetcher(Component* owner, Params& params) : BasePrefetcher(owner, params),
+	prefetchedHits(params.find<uint32_t>("prefetched_hit_entries", 16), params.find<uint32_t>("prefetched_hit_ways", 16)) {
+
+	uint32_t maxOffset = params.find<uint32_t>("max_offset", 64);
+	for(uint32_t n = 1; n <= maxOffset; n++) {
+		uint32_t rem = n;
+		while(rem % 2 == 0) rem /= 2;
+		while(rem % 3 == 0) rem /= 3;
+		while(rem % 5 == 0) rem /= 5;
+		if(rem == 1) offsets.push_back(n);
+	}
+	if(offsets.empty()) {
+		output->fatal(CALL_INFO, -1, "Invalid param(%s): max_offset - must be at least 1\n", parent->getName().c_str());
+	}
+	scores.resize(offsets.size(), 0);
+
+	uint32_t rrEntries = params.find<uint32_t>("recent_requests", 256);
+	recentRequests.resize(rrEntries == 0 ? 1 : rrEntries, 0);
+
+	scoreMax = params.find<uint32_t>("score_max", 31);
+	roundMax = params.find<uint32_t>("round_max", 100);
+	badScore = params.find<uint32_t>("bad_score", 1);
+
+	testIndex = 0;
+	round = 0;
+	bestOffset = 1;
+	prefetchOn = true;
+}
+
+void BestOffsetPrefetcher::train(const CacheListenerNotification& notify, std::vector<Addr>& candidates) {
+	const uint64_t line = notify.getPhysicalAddress() / blockSize;
+
+	if(notify.getResultType() == HIT && ! prefetchedHits.erase(line)) return;
+
+	learn(line);
+
+	if(! prefetchOn) return;
+
+	const uint32_t degree = getDegree();
+	for(uint32_t i = 1; i <= degree; i++) {
+		candidates.push_back((Addr) (line + bestOffset * i) * blockSize);
+	}
+}
+
+void BestOffsetPrefetcher::feedback(const Addr baseAddr, NotifyPrefetchResultType result) {
+	if(result == PREFETCH_USEFUL || result == PREFETCH_LATE) {
+		prefetchedHits.insert(baseAddr / blockSize);
+	}
+}
+
+/*
+ * Test one offset per trigger. The recent requests table is filled with the
+ * triggering lines themselves: this ignores the time a prefetch takes to
+ * complete, which the cache does not report, so offsets are ranked on
+ * coverage rather than timeliness.
+ */
+void BestOffsetPrefetcher::learn(uint64_t line) {
+	const uint64_t base = line - offsets[testIndex];
+	if(recentRequests[recentIndex(base)] == base + 1) {
+		if(++scores[testIndex] >= scoreMax) {
+			endPhase();
+			recentRequests[recentIndex(line)] = line + 1;
+			return;
+		}
+	}
+
+	if(++testIndex == offsets.size()) {
+		testIndex = 0;
+		if(++round >= roundMax) endPhase();
+	}
+
+	recentRequests[recentIndex(line)] = line + 1;
+}
+
+void BestOffsetPrefetcher::endPhase() {
+	uint32_t best = 0;
+	for(uint32_t i = 1; i < scores.size(); i++) {
+		if(scores[i] > scores[best]) best = i;
+	}
+
+	prefetchOn = scores[best] > badScore;
+	bestOffset = offsets[best];
+
+	output->verbose(CALL_INFO, 2, 0, "Learning phase ended, best offset %" PRId64 " with score %" PRIu32 ", prefetching %s\n",
+		bestOffset, scores[best], prefetchOn ? "on" : "off");
+
+	std::fill(scores.begin(), scores.end(), 0);
+	testIndex = 0;
+	round = 0;
+}
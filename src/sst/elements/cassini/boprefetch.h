@@ -0,0 +1,92 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_CASSINI_BO_PREFETCH
+#define _H_SST_CASSINI_BO_PREFETCH
+
+#include "baseprefetch.h"
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * Best-Offset prefetcher
+ *
+ * Prefetches X + D for each triggering access X, where D is learnt by
+ * testing a list of candidate offsets against a table of recent requests:
+ * offset d scores a point whenever X - d was recently requested. A learning
+ * phase ends once an offset reaches score_max or after round_max passes over
+ * the list; the best offset is then used for the next phase, or prefetching
+ * is switched off if even it scored no more than bad_score. Triggers are
+ * misses and the first hit on a line that was prefetched.
+ */
+class BestOffsetPrefetcher : public BasePrefetcher {
+    public:
+	BestOffsetPrefetcher(Component* owner, Params& params);
+	~BestOffsetPrefetcher() {}
+
+	SST_ELI_REGISTER_SUBCOMPONENT(
+		BestOffsetPrefetcher,
+		"cassini",
+		"BestOffsetPrefetcher",
+		SST_ELI_ELEMENT_VERSION(1,0,0),
+		"Best-Offset prefetcher",
+		"SST::Cassini::CacheListener"
+	)
+
+	SST_ELI_DOCUMENT_PARAMS(
+		CASSINI_BASEPREFETCH_ELI_PARAMS,
+		{ "max_offset", "Largest offset, in lines, tested. Offsets are the numbers up to this with no prime factor above 5", "64" },
+		{ "recent_requests", "Number of entries in the recent requests table", "256" },
+		{ "score_max", "Score at which an offset wins immediately", "31" },
+		{ "round_max", "Number of passes over the offset list in one learning phase", "100" },
+		{ "bad_score", "Prefetching is turned off for a phase if the best offset scored no more than this", "1" },
+		{ "prefetched_hit_entries", "Number of prefetched lines the cache reported a hit on that are remembered until they are requested again", "16" },
+		{ "prefetched_hit_ways", "Associativity of the prefetched hit table", "16" }
+	)
+
+	SST_ELI_DOCUMENT_STATISTICS(
+		CASSINI_BASEPREFETCH_ELI_STATS
+	)
+
+    protected:
+	void train(const CacheListenerNotification& notify, std::vector<Addr>& candidates);
+	void feedback(const Addr baseAddr, NotifyPrefetchResultType result);
+
+    private:
+	void learn(uint64_t line);
+	void endPhase();
+	uint32_t recentIndex(uint64_t line) const { return (uint32_t) ((line ^ (line >> 8)) % recentRequests.size()); }
+
+	std::vector<int64_t> offsets;
+	std::vector<uint32_t> scores;
+	std::vector<uint64_t> recentRequests;	// Direct mapped, line + 1 so that 0 is empty
+	TrainingTable<bool> prefetchedHits;	// Lines the cache reported as hits on a prefetch
+
+	uint32_t testIndex;
+	uint32_t round;
+	uint32_t scoreMax;
+	uint32_t roundMax;
+	uint32_t badScore;
+
+	int64_t bestOffset;
+	bool prefetchOn;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,72 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "ipstrideprefetch.h"
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace SST::Cassini;
+
+#define STREAM_MAX_CONFIDENCE 3
+
+/* Page keys are tagged so they cannot collide with instruction pointers */
+#define STREAM_PAGE_KEY_TAG (1ULL << 63)
+
+IPStridePrefetcher::IPStridePrefetcher(Component* owner, Params& params) : BasePrefetcher(owner, params),
+	streams(params.find<uint32_t>("table_entries", 64), params.find<uint32_t>("table_ways", 4)) {
+
+	uint32_t threshold = params.find<uint32_t>("confidence_threshold", 2);
+	confidenceThreshold = (threshold > STREAM_MAX_CONFIDENCE) ? STREAM_MAX_CONFIDENCE : threshold;
+	distance = params.find<uint32_t>("distance", 1);
+	if(distance == 0) distance = 1;
+}
+
+void IPStridePrefetcher::train(const CacheListenerNotification& notify, std::vector<Addr>& candidates) {
+	const Addr addr = notify.getPhysicalAddress();
+	const Addr ip = notify.getInstructionPointer();
+	const uint64_t line = addr / blockSize;
+	const uint64_t key = (ip != 0) ? ip : ((addr / pageSize) | STREAM_PAGE_KEY_TAG);
+
+	StreamEntry* stream = streams.find(key);
+	if(stream == NULL) {
+		streams.insert(key).lastLine = line;
+		return;
+	}
+
+	const int64_t delta = (int64_t) (line - stream->lastLine);
+	if(delta == 0) return;
+	stream->lastLine = line;
+
+	if(delta == stream->stride) {
+		if(stream->confidence < STREAM_MAX_CONFIDENCE) stream->confidence++;
+	} else {
+		if(stream->confidence > 0) stream->confidence--;
+		if(stream->confidence == 0) stream->stride = delta;
+		return;
+	}
+
+	if(stream->confidence < confidenceThreshold) return;
+
+	output->verbose(CALL_INFO, 4, 0, "Stream %" PRIx64 " stride %" PRId64 " lines, confidence %" PRIu32 "\n",
+		key, stream->stride, (uint32_t) stream->confidence);
+
+	const uint32_t degree = getDegree();
+	for(uint32_t i = 0; i < degree; i++) {
+		candidates.push_back((Addr) (line + stream->stride * (int64_t) (distance + i)) * blockSize);
+	}
+}
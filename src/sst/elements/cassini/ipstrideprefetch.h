@@ -0,0 +1,78 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_CASSINI_IP_STRIDE_PREFETCH
+#define _H_SST_CASSINI_IP_STRIDE_PREFETCH
+
+#include "baseprefetch.h"
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * Multi-stream stride prefetcher
+ *
+ * Each table entry follows one stream: accesses from the same instruction,
+ * or from the same page when the cache does not see instruction pointers.
+ * Interleaved streams therefore train independently, where a single global
+ * history sees their strides mixed together.
+ */
+class IPStridePrefetcher : public BasePrefetcher {
+    public:
+	IPStridePrefetcher(Component* owner, Params& params);
+	~IPStridePrefetcher() {}
+
+	SST_ELI_REGISTER_SUBCOMPONENT(
+		IPStridePrefetcher,
+		"cassini",
+		"IPStridePrefetcher",
+		SST_ELI_ELEMENT_VERSION(1,0,0),
+		"Per-instruction (or per-page) multi-stream stride prefetcher",
+		"SST::Cassini::CacheListener"
+	)
+
+	SST_ELI_DOCUMENT_PARAMS(
+		CASSINI_BASEPREFETCH_ELI_PARAMS,
+		{ "table_entries", "Number of streams tracked", "64" },
+		{ "table_ways", "Associativity of the stream table", "4" },
+		{ "confidence_threshold", "Number of times a stride must repeat before it is prefetched (at most 3)", "2" },
+		{ "distance", "How many strides ahead of the access the first prefetch is", "1" }
+	)
+
+	SST_ELI_DOCUMENT_STATISTICS(
+		CASSINI_BASEPREFETCH_ELI_STATS
+	)
+
+    protected:
+	void train(const CacheListenerNotification& notify, std::vector<Addr>& candidates);
+
+    private:
+	struct StreamEntry {
+		StreamEntry() : lastLine(0), stride(0), confidence(0) {}
+		uint64_t lastLine;
+		int64_t stride;		// In lines
+		uint8_t confidence;
+	};
+
+	TrainingTable<StreamEntry> streams;
+	uint8_t confidenceThreshold;
+	uint32_t distance;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,78 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "smsprefetch.h"
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace SST::Cassini;
+
+SMSPrefetcher::SMSPrefetcher(Component* owner, Params& params) : BasePrefetcher(owner, params),
+	accumulation(params.find<uint32_t>("accumulation_entries", 32), params.find<uint32_t>("accumulation_ways", 8)),
+	patterns(params.find<uint32_t>("pattern_entries", 1024), params.find<uint32_t>("pattern_ways", 8)) {
+
+	regionSize = params.find<uint64_t>("region_size", 2048);
+	if(regionSize < blockSize || regionSize % blockSize != 0 || regionSize / blockSize > 64) {
+		output->fatal(CALL_INFO, -1, "Invalid param(%s): region_size - must be a multiple of cache_line_size and at most 64 lines, got %" PRIu64 "\n",
+			parent->getName().c_str(), regionSize);
+	}
+	regionLines = regionSize / blockSize;
+	linesPerDegree = params.find<uint32_t>("lines_per_degree", 8);
+	if(linesPerDegree == 0) linesPerDegree = 1;
+}
+
+void SMSPrefetcher::train(const CacheListenerNotification& notify, std::vector<Addr>& candidates) {
+	const Addr addr = notify.getPhysicalAddress();
+	const uint64_t region = addr / regionSize;
+	const uint32_t offset = (addr % regionSize) / blockSize;
+
+	Generation* gen = accumulation.find(region);
+	if(gen != NULL) {
+		gen->footprint |= (1ULL << offset);
+		return;
+	}
+
+	// Trigger access: open a generation. The one it displaces has ended, so
+	// its footprint is learnt unless only the trigger line was ever touched.
+	const uint64_t trigger = (notify.getInstructionPointer() << 6) | offset;
+	Generation& newGen = accumulation.insert(region, [this](uint64_t, Generation& old) {
+		if((old.footprint & (old.footprint - 1)) != 0) {
+			patterns.insert(old.trigger) = old.footprint;
+		}
+	});
+	newGen.trigger = trigger;
+	newGen.footprint = (1ULL << offset);
+
+	const uint64_t* pattern = patterns.find(trigger);
+	if(pattern == NULL) return;
+
+	output->verbose(CALL_INFO, 4, 0, "Region %" PRIx64 " trigger %" PRIx64 " matches footprint %" PRIx64 "\n",
+		region, trigger, *pattern);
+
+	// Lines nearest the trigger are most likely to be needed soonest
+	const uint32_t limit = getDegree() * linesPerDegree;
+	const Addr regionBase = region * regionSize;
+	for(uint32_t dist = 1; dist < regionLines && candidates.size() < limit; dist++) {
+		if(offset + dist < regionLines && (*pattern & (1ULL << (offset + dist)))) {
+			candidates.push_back(regionBase + (offset + dist) * blockSize);
+		}
+		if(dist <= offset && (*pattern & (1ULL << (offset - dist))) && candidates.size() < limit) {
+			candidates.push_back(regionBase + (offset - dist) * blockSize);
+		}
+	}
+}
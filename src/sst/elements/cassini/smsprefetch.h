@@ -0,0 +1,83 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_CASSINI_SMS_PREFETCH
+#define _H_SST_CASSINI_SMS_PREFETCH
+
+#include "baseprefetch.h"
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * Spatial memory streaming prefetcher
+ *
+ * Memory is divided into regions. The first access to a region (the trigger)
+ * opens a generation in the accumulation table, which records the footprint -
+ * the set of lines touched in the region - until the entry is evicted. The
+ * footprint is then stored in the pattern history table under the trigger's
+ * instruction pointer and offset, and the next time that trigger opens a
+ * generation the stored footprint is prefetched.
+ */
+class SMSPrefetcher : public BasePrefetcher {
+    public:
+	SMSPrefetcher(Component* owner, Params& params);
+	~SMSPrefetcher() {}
+
+	SST_ELI_REGISTER_SUBCOMPONENT(
+		SMSPrefetcher,
+		"cassini",
+		"SMSPrefetcher",
+		SST_ELI_ELEMENT_VERSION(1,0,0),
+		"Spatial memory streaming (footprint) prefetcher",
+		"SST::Cassini::CacheListener"
+	)
+
+	SST_ELI_DOCUMENT_PARAMS(
+		CASSINI_BASEPREFETCH_ELI_PARAMS,
+		{ "region_size", "Size of a spatial region in bytes, at most 64 cache lines", "2048" },
+		{ "accumulation_entries", "Number of regions whose footprint is recorded at once", "32" },
+		{ "accumulation_ways", "Associativity of the accumulation table", "8" },
+		{ "pattern_entries", "Number of footprints remembered", "1024" },
+		{ "pattern_ways", "Associativity of the pattern history table", "8" },
+		{ "lines_per_degree", "Lines of a footprint prefetched per unit of degree, those nearest the trigger first", "8" }
+	)
+
+	SST_ELI_DOCUMENT_STATISTICS(
+		CASSINI_BASEPREFETCH_ELI_STATS
+	)
+
+    protected:
+	void train(const CacheListenerNotification& notify, std::vector<Addr>& candidates);
+
+    private:
+	struct Generation {
+		Generation() : trigger(0), footprint(0) {}
+		uint64_t trigger;
+		uint64_t footprint;	// Bit per line in the region
+	};
+
+	TrainingTable<Generation> accumulation;
+	TrainingTable<uint64_t> patterns;
+	uint64_t regionSize;
+	uint32_t regionLines;
+	uint32_t linesPerDegree;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,80 @@
+#!/usr/bin/env python
+
+import subprocess
+import sys
+
+# Runs the stream CPU with the IP stride, SMS and Best-Offset prefetchers and
+# checks that each engine and the feedback throttle did their work.
+#
+# For each engine the cache has to issue prefetches, report some of them
+# back as used (useful or late), and the throttle has to raise or lower the
+# degree at least once. The run also has to complete earlier than the run
+# without a prefetcher.
+#
+# Run from within cassini/tests/:
+#   python ./checkPrefetch.py
+
+engines = [ ("IPStridePrefetcher", "streamcpu-ipsp.py"),
+            ("SMSPrefetcher", "streamcpu-sms.py"),
+            ("BestOffsetPrefetcher", "streamcpu-bo.py") ]
+
+def run_sst(sdl):
+    osCmd = "sst " + sdl
+    print osCmd
+
+    p = subprocess.Popen(osCmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE, shell=True)
+    output, err = p.communicate()
+
+    if p.returncode != 0:
+        print "SST failed: ", err
+        sys.exit(1)
+
+    return output.split("\n")
+
+def get_completed(outputLines):
+    for line in outputLines:
+        if line.startswith("Completed @ "):
+            return int(line.split()[2])
+    return -1
+
+def get_stat(outputLines, stat):
+    key = "l1cache." + stat + " : "
+    for line in outputLines:
+        if line.find(key) != -1:
+            return int(line[line.find("Sum.u64 = ")+len("Sum.u64 = "):].split(";")[0])
+    return -1
+
+nopfCompleted = get_completed(run_sst("streamcpu-nopf.py"))
+
+results = ""
+failed = False
+
+def check(condition, description):
+    global results
+    global failed
+    if condition:
+        results += "[v] " + description + "\n"
+    else:
+        results += "[x] " + description + "\n"
+        failed = True
+
+for engine, sdl in engines:
+    outputLines = run_sst(sdl)
+
+    issued = get_stat(outputLines, "prefetches_issued")
+    used = get_stat(outputLines, "prefetch_useful") + get_stat(outputLines, "prefetch_late")
+    raised = get_stat(outputLines, "prefetch_degree_raised")
+    lowered = get_stat(outputLines, "prefetch_degree_lowered")
+    completed = get_completed(outputLines)
+
+    check(issued > 0, engine + " issued " + str(issued) + " prefetches")
+    check(used > 0, engine + " was told " + str(used) + " prefetches were used")
+    check(raised + lowered > 0, engine + " throttle raised the degree " + str(raised) + " and lowered it " + str(lowered) + " times")
+    check(completed > 0 and completed < nopfCompleted, engine + " completed @ " + str(completed) + " ns, before " + str(nopfCompleted) + " ns without prefetching")
+
+print "-----RUNNING CASSINI PREFETCH-----"
+print(results)
+print("done.\n")
+
+if failed:
+    sys.exit(1)
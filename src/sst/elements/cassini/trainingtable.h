@@ -0,0 +1,134 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_CASSINI_TRAINING_TABLE
+#define _H_SST_CASSINI_TRAINING_TABLE
+
+#include <stdint.h>
+#include <vector>
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * Fixed-size, set-associative table with LRU replacement, the structure
+ * behind most hardware prefetcher state (stride tables, region
+ * accumulation tables, pattern history tables, ...). Sizing it like the
+ * hardware it models bounds both the simulated storage and the cost of a
+ * lookup, unlike an unbounded map.
+ */
+template<typename Entry>
+class TrainingTable {
+public:
+	TrainingTable(uint32_t entries, uint32_t ways) : useCounter(0) {
+		if(ways == 0 || ways > entries) ways = entries;
+		if(entries == 0) entries = ways = 1;
+
+		numWays = ways;
+		numSets = entries / ways;
+		if(numSets == 0) numSets = 1;
+
+		slots.resize(numSets * numWays);
+	}
+
+	/* Return the entry for key, or NULL if it is not present. A hit makes the entry most recently used. */
+	Entry* find(uint64_t key) {
+		Slot* slot = lookup(key);
+		if(slot == NULL) return NULL;
+		slot->lastUse = ++useCounter;
+		return &slot->entry;
+	}
+
+	bool contains(uint64_t key) {
+		return lookup(key) != NULL;
+	}
+
+	/* Return a fresh entry for key, replacing the least recently used entry in its set */
+	Entry& insert(uint64_t key) {
+		return insert(key, [](uint64_t, Entry&) {});
+	}
+
+	/* As insert(), but call onEvict(key, entry) for a valid entry that is displaced */
+	template<typename EvictFn>
+	Entry& insert(uint64_t key, EvictFn onEvict) {
+		Slot* slot = lookup(key);
+		if(slot == NULL) {
+			Slot* set = &slots[setOf(key) * numWays];
+			slot = set;
+			for(uint32_t i = 0; i < numWays; i++) {
+				if(! set[i].valid) {
+					slot = &set[i];
+					break;
+				}
+				if(set[i].lastUse < slot->lastUse) slot = &set[i];
+			}
+			if(slot->valid) onEvict(slot->key, slot->entry);
+		}
+
+		slot->key = key;
+		slot->valid = true;
+		slot->lastUse = ++useCounter;
+		slot->entry = Entry();
+		return slot->entry;
+	}
+
+	bool erase(uint64_t key) {
+		Slot* slot = lookup(key);
+		if(slot == NULL) return false;
+		slot->valid = false;
+		return true;
+	}
+
+	void clear() {
+		for(size_t i = 0; i < slots.size(); i++) slots[i].valid = false;
+	}
+
+	uint32_t capacity() const { return numSets * numWays; }
+
+private:
+	struct Slot {
+		Slot() : key(0), lastUse(0), valid(false) {}
+		uint64_t key;
+		uint64_t lastUse;
+		bool valid;
+		Entry entry;
+	};
+
+	uint32_t setOf(uint64_t key) const {
+		// Mix the key so strided keys (line or page numbers) spread over the sets
+		key ^= key >> 17;
+		key *= 0x9E3779B97F4A7C15ULL;
+		return (uint32_t) ((key >> 32) % numSets);
+	}
+
+	Slot* lookup(uint64_t key) {
+		Slot* set = &slots[setOf(key) * numWays];
+		for(uint32_t i = 0; i < numWays; i++) {
+			if(set[i].valid && set[i].key == key) return &set[i];
+		}
+		return NULL;
+	}
+
+	std::vector<Slot> slots;
+	uint32_t numSets;
+	uint32_t numWays;
+	uint64_t useCounter;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,185 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_ADDRDECODER_H
+#define MEMHIERARCHY_ADDRDECODER_H
+
+#include <vector>
+#include <algorithm>
+
+#include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/endpointRegistry.h"
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Maps an address to the destination whose MemRegion contains it
+ *
+ * Destinations are added in priority order (the first region containing an
+ * address wins, as when scanning the destination set) and then compiled.
+ * The region boundaries split the address space into intervals, each with
+ * the list of regions that span it. An interval is resolved one of three ways:
+ *  - DIRECT: the first region spanning it is not interleaved
+ *  - TABLE:  the interleaved regions share a power-of-two step, so the
+ *            destination is a table lookup on (addr & (step-1)) >> granule
+ *  - SCAN:   anything else, check each region in turn
+ */
+class AddrDecoder {
+public:
+    AddrDecoder() { clear(); }
+
+    void clear() {
+        targets_.clear();
+        regions_.clear();
+        bounds_.clear();
+        intervals_.clear();
+        candidates_.clear();
+        table_.clear();
+    }
+
+    void add(const MemRegion &region, EndpointID dst) {
+        targets_.push_back(dst);
+        regions_.push_back(region);
+    }
+
+    bool empty() const { return targets_.empty(); }
+
+    void compile() {
+        bounds_.clear();
+        intervals_.clear();
+        candidates_.clear();
+        table_.clear();
+
+        for (size_t i = 0; i < regions_.size(); i++) {
+            bounds_.push_back(regions_[i].start);
+            bounds_.push_back(regions_[i].end);
+        }
+        std::sort(bounds_.begin(), bounds_.end());
+        bounds_.erase(std::unique(bounds_.begin(), bounds_.end()), bounds_.end());
+
+        /* Interval i covers [bounds_[i], bounds_[i+1]), the last one runs to the top of the address space */
+        for (size_t i = 0; i < bounds_.size(); i++) {
+            Addr lo = bounds_[i];
+            Addr hi = (i + 1 < bounds_.size()) ? bounds_[i + 1] : lo;
+            Interval interval;
+            interval.kind = NONE;
+            interval.candidateOffset = candidates_.size();
+            if (i + 1 < bounds_.size()) {
+                for (size_t r = 0; r < regions_.size(); r++) {
+                    if (regions_[r].start <= lo && regions_[r].end >= hi) {
+                        candidates_.push_back(r);
+                        if (regions_[r].interleaveSize == 0) break; /* Matches everything, later regions are never reached */
+                    }
+                }
+            }
+            interval.candidateCount = candidates_.size() - interval.candidateOffset;
+            if (interval.candidateCount != 0) classify(interval);
+            intervals_.push_back(interval);
+        }
+    }
+
+    /* Return the destination for 'addr' or NO_ENDPOINT if no region contains it */
+    EndpointID find(Addr addr) const {
+        std::vector<Addr>::const_iterator it = std::upper_bound(bounds_.begin(), bounds_.end(), addr);
+        if (it == bounds_.begin()) return EndpointRegistry::NO_ENDPOINT;
+        const Interval &interval = intervals_[(it - bounds_.begin()) - 1];
+
+        switch (interval.kind) {
+            case DIRECT:
+                return targets_[interval.target];
+            case TABLE:
+                {
+                    int32_t index = table_[interval.tableOffset + ((addr & interval.mask) >> interval.shift)];
+                    return (index < 0) ? EndpointRegistry::NO_ENDPOINT : targets_[index];
+                }
+            case SCAN:
+                for (uint32_t i = 0; i < interval.candidateCount; i++) {
+                    uint32_t r = candidates_[interval.candidateOffset + i];
+                    if (regions_[r].contains(addr)) return targets_[r];
+                }
+                return EndpointRegistry::NO_ENDPOINT;
+            default:
+                return EndpointRegistry::NO_ENDPOINT;
+        }
+    }
+
+private:
+    enum Kind { NONE, DIRECT, TABLE, SCAN };
+
+    static const uint64_t kMaxTableEntries = 4096;   /* Per interval */
+
+    struct Interval {
+        Kind kind;
+        uint32_t target;            /* DIRECT */
+        uint32_t tableOffset;       /* TABLE */
+        uint32_t shift;
+        uint64_t mask;
+        uint32_t candidateOffset;   /* SCAN */
+        uint32_t candidateCount;
+    };
+
+    std::vector<EndpointID> targets_;
+    std::vector<MemRegion> regions_;
+    std::vector<Addr> bounds_;
+    std::vector<Interval> intervals_;
+    std::vector<uint32_t> candidates_;
+    std::vector<int32_t> table_;
+
+    void classify(Interval &interval) {
+        const MemRegion &first = regions_[candidates_[interval.candidateOffset]];
+        if (first.interleaveSize == 0) {
+            interval.kind = DIRECT;
+            interval.target = candidates_[interval.candidateOffset];
+            return;
+        }
+
+        /* All interleaved candidates need the same power-of-two step. The granule is the largest
+         * power of two that divides the step, every chunk size, and every start offset within the step. */
+        uint64_t step = first.interleaveStep;
+        interval.kind = SCAN;
+        if (step == 0 || (step & (step - 1)) != 0) return;
+
+        uint64_t bits = step;
+        for (uint32_t i = 0; i < interval.candidateCount; i++) {
+            const MemRegion &region = regions_[candidates_[interval.candidateOffset + i]];
+            if (region.interleaveSize == 0) break;
+            if (region.interleaveStep != step) return;
+            bits |= region.interleaveSize | (region.start & (step - 1));
+        }
+        uint64_t granule = bits & (~bits + 1);
+        if (step / granule > kMaxTableEntries) return;
+
+        interval.kind = TABLE;
+        interval.mask = step - 1;
+        interval.shift = 0;
+        while (((uint64_t)1 << interval.shift) < granule) interval.shift++;
+        interval.tableOffset = table_.size();
+
+        for (uint64_t phase = 0; phase < step; phase += granule) {
+            int32_t match = -1;
+            for (uint32_t i = 0; i < interval.candidateCount && match < 0; i++) {
+                uint32_t r = candidates_[interval.candidateOffset + i];
+                const MemRegion &region = regions_[r];
+                if (region.interleaveSize == 0 || ((phase - region.start) & (step - 1)) < region.interleaveSize)
+                    match = r;
+            }
+            table_.push_back(match);
+        }
+    }
+};
+
+}}
+
+#endif /* MEMHIERARCHY_ADDRDECODER_H */
@@ -0,0 +1,191 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_ADDRHASHMAP_H
+#define MEMHIERARCHY_ADDRHASHMAP_H
+
+#include <vector>
+#include <utility>
+
+#include "sst/elements/memHierarchy/util.h"
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Open-addressing hash map keyed by address
+ *
+ * Keys and values are held in flat arrays and collisions are resolved with
+ * linear probing, so a lookup touches one or two cache lines and no entry
+ * needs its own heap node. Erase shifts later entries of the probe run back
+ * (no tombstones) so lookups stay short under heavy insert/erase churn.
+ *
+ * Pointers/references to values are invalidated by insert() (the table may
+ * grow) and by erase() (entries may shift). Iteration order is unspecified.
+ */
+template<typename V>
+class AddrHashMap {
+public:
+    AddrHashMap(size_t initialCapacity = 64) : size_(0), lastProbeLength_(0) {
+        size_t capacity = 8;
+        while (capacity < initialCapacity) capacity <<= 1;
+        allocate(capacity);
+    }
+
+    /** Return a pointer to the value for 'key' or nullptr if not present */
+    V* find(Addr key) {
+        size_t slot;
+        return lookup(key, slot) ? &values_[slot] : nullptr;
+    }
+
+    bool contains(Addr key) {
+        size_t slot;
+        return lookup(key, slot);
+    }
+
+    /** Return the value for 'key', inserting a default-constructed one if not present */
+    V& operator[](Addr key) {
+        size_t slot;
+        if (lookup(key, slot)) return values_[slot];
+        if ((size_ + 1) * 10 > keys_.size() * 7) {
+            grow();
+            lookup(key, slot);
+        }
+        keys_[slot] = key;
+        used_[slot] = true;
+        values_[slot] = V();
+        size_++;
+        return values_[slot];
+    }
+
+    /** Insert or overwrite the value for 'key' */
+    void insert(Addr key, const V& value) { (*this)[key] = value; }
+
+    /** Remove 'key', return whether it was present */
+    bool erase(Addr key) {
+        size_t slot;
+        if (!lookup(key, slot)) return false;
+
+        /* Backward-shift: move later members of the run into the hole if their home slot allows it */
+        size_t hole = slot;
+        size_t next = (hole + 1) & mask_;
+        while (used_[next]) {
+            size_t home = hash(keys_[next]);
+            bool movable = (hole <= next) ? (home <= hole || home > next) : (home <= hole && home > next);
+            if (movable) {
+                keys_[hole] = keys_[next];
+                values_[hole] = std::move(values_[next]);
+                hole = next;
+            }
+            next = (next + 1) & mask_;
+        }
+        used_[hole] = false;
+        values_[hole] = V();
+        size_--;
+        return true;
+    }
+
+    void clear() {
+        for (size_t i = 0; i < used_.size(); i++) {
+            if (used_[i]) values_[i] = V();
+            used_[i] = false;
+        }
+        size_ = 0;
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    /** Number of slots examined by the most recent find/insert/erase, for profiling */
+    size_t lastProbeLength() const { return lastProbeLength_; }
+
+    /* Forward iteration over occupied slots; dereferences to (key, value) */
+    class iterator {
+    public:
+        iterator(AddrHashMap * map, size_t slot) : map_(map), slot_(slot) { skip(); }
+        std::pair<Addr, V&> operator*() const { return std::pair<Addr, V&>(map_->keys_[slot_], map_->values_[slot_]); }
+        Addr key() const { return map_->keys_[slot_]; }
+        V& value() const { return map_->values_[slot_]; }
+        iterator& operator++() { slot_++; skip(); return *this; }
+        bool operator==(const iterator &other) const { return slot_ == other.slot_; }
+        bool operator!=(const iterator &other) const { return slot_ != other.slot_; }
+    private:
+        void skip() { while (slot_ < map_->used_.size() && !map_->used_[slot_]) slot_++; }
+        AddrHashMap *   map_;
+        size_t          slot_;
+    };
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, used_.size()); }
+
+private:
+    std::vector<Addr>       keys_;
+    std::vector<V>          values_;
+    std::vector<uint8_t>    used_;
+    size_t                  size_;
+    size_t                  mask_;
+    unsigned int            shift_;
+    size_t                  lastProbeLength_;
+
+    /* Fibonacci hashing - keys are usually line-aligned so the low bits carry little information */
+    size_t hash(Addr key) const { return (size_t)((key * 0x9E3779B97F4A7C15ULL) >> shift_); }
+
+    /* Return true and the slot holding 'key' if present, else false and the free slot where it would go */
+    bool lookup(Addr key, size_t &slot) {
+        slot = hash(key);
+        lastProbeLength_ = 1;
+        while (used_[slot]) {
+            if (keys_[slot] == key) return true;
+            slot = (slot + 1) & mask_;
+            lastProbeLength_++;
+        }
+        return false;
+    }
+
+    void allocate(size_t capacity) {
+        keys_.assign(capacity, 0);
+        values_.clear();
+        values_.resize(capacity);
+        used_.assign(capacity, 0);
+        mask_ = capacity - 1;
+        shift_ = 64;
+        while (capacity > 1) {
+            capacity >>= 1;
+            shift_--;
+        }
+    }
+
+    void grow() {
+        std::vector<Addr> oldKeys;
+        std::vector<V> oldValues;
+        std::vector<uint8_t> oldUsed;
+        oldKeys.swap(keys_);
+        oldValues.swap(values_);
+        oldUsed.swap(used_);
+
+        allocate(oldKeys.size() << 1);
+        for (size_t i = 0; i < oldKeys.size(); i++) {
+            if (!oldUsed[i]) continue;
+            size_t slot;
+            lookup(oldKeys[i], slot);
+            keys_[slot] = oldKeys[i];
+            values_[slot] = std::move(oldValues[i]);
+            used_[slot] = true;
+        }
+    }
+};
+
+}}
+
+#endif /* MEMHIERARCHY_ADDRHASHMAP_H */
@@ -86,7 +86,7 @@ bool Bus::clockTick(Cycle_t time) {
 
 void Bus::broadcastEvent(SST::Event* ev) {
     MemEventBase* memEvent = dynamic_cast<MemEventBase*>(ev);
-    LinkId_t srcLinkId = lookupNode(memEvent->getSrc());
+    LinkId_t srcLinkId = lookupNode(memEvent->getSrcID());
     SST::Link* srcLink = linkIdMap_[srcLinkId];
 
     for (int i = 0; i < numHighNetPorts_; i++) {
@@ -114,7 +114,7 @@ void Bus::sendSingleEvent(SST::Event* ev) {
                    this->getName().c_str(), event->getDeliveryLink()->getId(), event->getBriefString().c_str());
     }
 #endif
-    LinkId_t dstLinkId = lookupNode(event->getDst());
+    LinkId_t dstLinkId = lookupNode(event->getDstID());
     SST::Link* dstLink = linkIdMap_[dstLinkId];
     MemEventBase* forwardEvent = event->clone();
 #ifdef __SST_DEBUG_OUTPUT__
@@ -133,8 +133,8 @@ void Bus::sendSingleEvent(SST::Event* ev) {
  * Helper functions
  *---------------------------------------*/
 
-void Bus::mapNodeEntry(const std::string& name, LinkId_t id) {
-	std::map<std::string, LinkId_t>::iterator it = nameMap_.find(name);
+void Bus::mapNodeEntry(EndpointID name, LinkId_t id) {
+	std::unordered_map<EndpointID, LinkId_t>::iterator it = nameMap_.find(name);
 	if (it != nameMap_.end() ) {
             if (it->second != id)
                 dbg_.fatal(CALL_INFO, -1, "%s, Error: Bus attempting to map node that has already been mapped\n", getName().c_str());
@@ -143,10 +143,10 @@ void Bus::mapNodeEntry(const std::string& name, LinkId_t id) {
     nameMap_[name] = id;
 }
 
-LinkId_t Bus::lookupNode(const std::string& name) {
-	std::map<std::string, LinkId_t>::iterator it = nameMap_.find(name);
+LinkId_t Bus::lookupNode(EndpointID name) {
+	std::unordered_map<EndpointID, LinkId_t>::iterator it = nameMap_.find(name);
     if (nameMap_.end() == it) {
-        dbg_.fatal(CALL_INFO, -1, "%s, Error: Bus lookup of node %s returned no mapping\n", getName().c_str(), name.c_str());
+        dbg_.fatal(CALL_INFO, -1, "%s, Error: Bus lookup of node %s returned no mapping\n", getName().c_str(), EndpointRegistry::getName(name).c_str());
     }
     return it->second;
 }
@@ -223,7 +223,7 @@ void Bus::init(unsigned int phase) {
 
             if (memEvent && memEvent->getCmd() == Command::NULLCMD) {
                 dbg_.debug(_L10_, "bus %s broadcasting upper event to lower ports (%d): %s\n", getName().c_str(), numLowNetPorts_, memEvent->getVerboseString().c_str());
-                mapNodeEntry(memEvent->getSrc(), highNetPorts_[i]->getId());
+                mapNodeEntry(memEvent->getSrcID(), highNetPorts_[i]->getId());
                 for (int k = 0; k < numLowNetPorts_; k++)
                     lowNetPorts_[k]->sendInitData(memEvent->clone());
             } else if (memEvent) {
@@ -241,7 +241,7 @@ void Bus::init(unsigned int phase) {
             if (!memEvent) delete memEvent;
             else if (memEvent->getCmd() == Command::NULLCMD) {
                 dbg_.debug(_L10_, "bus %s broadcasting lower event to upper ports (%d): %s\n", getName().c_str(), numHighNetPorts_, memEvent->getVerboseString().c_str());
-                mapNodeEntry(memEvent->getSrc(), lowNetPorts_[i]->getId());
+                mapNodeEntry(memEvent->getSrcID(), lowNetPorts_[i]->getId());
                 for (int i = 0; i < numHighNetPorts_; i++) {
                     highNetPorts_[i]->sendInitData(memEvent->clone());
                 }
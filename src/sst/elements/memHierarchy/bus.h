@@ -18,6 +18,7 @@
 
 #include <queue>
 #include <map>
+#include <unordered_map>
 
 #include <sst/core/event.h>
 #include <sst/core/sst_types.h>
@@ -90,8 +91,8 @@ private:
     void configureParameters(SST::Params&);
     void configureLinks();
     
-    void mapNodeEntry(const std::string&, LinkId_t);
-    LinkId_t lookupNode(const std::string&);
+    void mapNodeEntry(EndpointID, LinkId_t);
+    LinkId_t lookupNode(EndpointID);
 
 
     Output                          dbg_;
@@ -113,7 +114,7 @@ private:
     std::string                     bus_latency_cycles_;
 	std::vector<SST::Link*>         highNetPorts_;
 	std::vector<SST::Link*>         lowNetPorts_;
-	std::map<string, LinkId_t>      nameMap_;
+	std::unordered_map<EndpointID, LinkId_t> nameMap_;
     std::map<LinkId_t, SST::Link*>  linkIdMap_;
     std::queue<SST::Event*>         eventQueue_;
     
@@ -28,32 +28,21 @@ namespace SST { namespace MemHierarchy {
 /* Set Associative Array Class */
 SetAssociativeArray::SetAssociativeArray(Output* dbg, unsigned int numLines, unsigned int lineSize, unsigned int associativity, ReplacementMgr* rm, HashFunction* hf, bool sharersAware) :
     CacheArray(dbg, numLines, associativity, lineSize, rm, hf, sharersAware, true) 
-    { 
-        setStates = new State[associativity];
-        setSharers = new unsigned int[associativity];
-        setOwned = new bool[associativity];
-    }
+    { }
 
 
-SetAssociativeArray::~SetAssociativeArray() {
-    delete [] setStates;
-    delete [] setSharers;
-    delete [] setOwned;
-}
+SetAssociativeArray::~SetAssociativeArray() { }
 
 CacheArray::CacheLine* SetAssociativeArray::lookup(const Addr baseAddr, bool update) {
     Addr lineAddr = toLineAddr(baseAddr);
     int set = hash_->hash(0, lineAddr) % numSets_;
     int setBegin = set * associativity_;
-    int setEnd = setBegin + associativity_;
    
-    for (int i = setBegin; i < setEnd; i++) {
-        if (lines_[i]->getBaseAddr() == baseAddr) {
-            if (update) replacementMgr_->update(i);
-            return lines_[i];
-        }
-    }
-    return nullptr;
+    int index = findWay(setBegin, baseAddr);
+    if (index == -1) return nullptr;
+
+    if (update) replacementMgr_->update(index);
+    return lines_[index];
 }
 
 CacheArray::CacheLine* SetAssociativeArray::findReplacementCandidate(const Addr baseAddr, bool cache) {
@@ -66,12 +55,7 @@ unsigned int SetAssociativeArray::preReplace(const Addr baseAddr) {
     int set         = hash_->hash(0, lineAddr) % numSets_;
     int setBegin    = set * associativity_;
     
-    for (unsigned int id = 0; id < associativity_; id++) {
-        setStates[id] = lines_[id+setBegin]->getState();
-        setSharers[id] = lines_[id+setBegin]->numSharers();
-        setOwned[id] = lines_[id+setBegin]->ownerExists();
-    }
-    return replacementMgr_->findBestCandidate(setBegin, setStates, setSharers, setOwned, sharersAware_? true: false);
+    return replacementMgr_->findBestCandidate(setBegin, tagStore_->states + setBegin, tagStore_->sharerCounts + setBegin, tagStore_->owned + setBegin, sharersAware_? true: false);
 }
 
 void SetAssociativeArray::replace(const Addr baseAddr, CacheArray::CacheLine * candidate, CacheArray::DataLine * dataCandidate) {
@@ -102,9 +86,6 @@ DualSetAssociativeArray::DualSetAssociativeArray(Output* dbg, unsigned int lineS
             dataLines_[i] = new DataLine(lineSize_, i, dbg_);
         }
 
-        dirSetStates    = new State[dirAssociativity];
-        dirSetSharers   = new unsigned int[dirAssociativity];
-        dirSetOwned     = new bool[dirAssociativity];
         cacheSetStates  = new State[cacheAssociativity];
         cacheSetSharers = new unsigned int[cacheAssociativity];
         cacheSetOwned   = new bool[cacheAssociativity];
@@ -115,20 +96,17 @@ CacheArray::CacheLine* DualSetAssociativeArray::lookup(const Addr baseAddr, bool
     Addr lineAddr = toLineAddr(baseAddr);
     int set = hash_->hash(0, lineAddr) % numSets_;
     int setBegin = set * associativity_;
-    int setEnd = setBegin + associativity_;
    
-    for (int i = setBegin; i < setEnd; i++) {
-        if (lines_[i]->getBaseAddr() == baseAddr) {
-            if (update) {
-                replacementMgr_->update(i);
-                if (lines_[i]->getDataLine() != NULL) {
-                    cacheReplacementMgr_->update(lines_[i]->getDataLine()->getIndex());
-                }
-            }
-            return lines_[i];
+    int index = findWay(setBegin, baseAddr);
+    if (index == -1) return nullptr;
+
+    if (update) {
+        replacementMgr_->update(index);
+        if (lines_[index]->getDataLine() != NULL) {
+            cacheReplacementMgr_->update(lines_[index]->getDataLine()->getIndex());
         }
     }
-    return nullptr;
+    return lines_[index];
 }
 
 CacheArray::CacheLine * DualSetAssociativeArray::findReplacementCandidate(const Addr baseAddr, bool cache) {
@@ -152,12 +130,7 @@ unsigned int DualSetAssociativeArray::preReplaceDir(const Addr baseAddr) {
     int set         = hash_->hash(0, lineAddr) % numSets_;
     int setBegin    = set * associativity_;
     
-    for (unsigned int id = 0; id < associativity_; id++) {
-        dirSetStates[id]    = lines_[id+setBegin]->getState();
-        dirSetSharers[id]   = lines_[id+setBegin]->numSharers();
-        dirSetOwned[id]     = lines_[id+setBegin]->ownerExists();
-    }
-    return replacementMgr_->findBestCandidate(setBegin, dirSetStates, dirSetSharers, dirSetOwned, sharersAware_);
+    return replacementMgr_->findBestCandidate(setBegin, tagStore_->states + setBegin, tagStore_->sharerCounts + setBegin, tagStore_->owned + setBegin, sharersAware_);
 }
 
 void DualSetAssociativeArray::replace(const Addr baseAddr, CacheArray::CacheLine * candidate, CacheArray::DataLine * dataCandidate) {
@@ -195,9 +168,9 @@ unsigned int DualSetAssociativeArray::preReplaceCache(const Addr baseAddr) {
             cacheSetSharers[id] = 0;
             cacheSetOwned[id] = false;
         } else {
-            cacheSetStates[id]  = lines_[dirIndex]->getState();
-            cacheSetSharers[id] = lines_[dirIndex]->numSharers();
-            cacheSetOwned[id]   = lines_[dirIndex]->ownerExists();
+            cacheSetStates[id]  = tagStore_->states[dirIndex];
+            cacheSetSharers[id] = tagStore_->sharerCounts[dirIndex];
+            cacheSetOwned[id]   = tagStore_->owned[dirIndex];
         }
     }
     return cacheReplacementMgr_->findBestCandidate(setBegin, cacheSetStates, cacheSetSharers, cacheSetOwned, sharersAware_);
@@ -224,5 +197,31 @@ void CacheArray::errorChecking() {
     if(associativity_ < 1)                  dbg_->fatal(CALL_INFO, -1, "Associativity has to be greater than zero. Associativity = %d\n", associativity_);
 }
 
+/* Insert 'id' at its place in name order and shift the endpoints after it, including their bits in every line */
+uint32_t CacheArray::SharerIndex::assignIndex(EndpointID id) {
+    if (id >= indexOf_.size()) indexOf_.resize(id + 1, UNASSIGNED);
+    if (id == EndpointRegistry::EMPTY_ENDPOINT) {
+        indexOf_[id] = NO_SHARER;
+        return NO_SHARER;
+    }
+
+    const std::string& name = EndpointRegistry::getName(id);
+    uint32_t pos = endpoints_.size();
+    while (pos > 0 && name < EndpointRegistry::getName(endpoints_[pos - 1])) pos--;
+
+    if (pos != endpoints_.size()) {
+        for (vector<SharerSet*>::iterator it = sets_.begin(); it != sets_.end(); it++)
+            (*it)->insertAt(pos, endpoints_.size());
+    }
+    endpoints_.insert(endpoints_.begin() + pos, id);
+    for (uint32_t i = pos; i < endpoints_.size(); i++)
+        indexOf_[endpoints_[i]] = i;
+    return pos;
+}
+
+/* SharerIndex::assignIndex() passes UNASSIGNED to vector::resize() by reference, so the constants need storage */
+const uint32_t CacheArray::SharerIndex::NO_SHARER;
+const uint32_t CacheArray::SharerIndex::UNASSIGNED;
+
 }}
 
@@ -25,6 +25,7 @@
 #include <sst/core/output.h>
 
 #include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/endpointRegistry.h"
 #include "sst/elements/memHierarchy/hash.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
@@ -75,17 +76,203 @@ public:
     };
 
 
+    class SharerSet;
+
+    /* 
+     * Dense numbering for the upper-level endpoints that hold copies of lines in this array.
+     * Lines record sharers as bit positions in this numbering rather than as a set of names.
+     * The number of distinct sharers of an array is small (the caches directly above it) so
+     * indices are assigned on first use and never recycled. Indices follow the order of the 
+     * endpoint names so that sharers are visited in the same order as a set of names; 
+     * registering a name that sorts before existing ones renumbers the tracked lines.
+     */
+    class SharerIndex {
+    public:
+        static const uint32_t NO_SHARER = 0xFFFFFFFF;
+
+        /** Return the index for 'id', assigning one if needed. The empty name never shares */
+        uint32_t getIndex(EndpointID id) {
+            if (id < indexOf_.size() && indexOf_[id] != UNASSIGNED) return indexOf_[id];
+            return assignIndex(id);
+        }
+
+        /** Return the index for 'id' or NO_SHARER if it has never shared a line */
+        uint32_t findIndex(EndpointID id) const {
+            if (id >= indexOf_.size() || indexOf_[id] == UNASSIGNED) return NO_SHARER;
+            return indexOf_[id];
+        }
+
+        /** Return the endpoint that owns an index */
+        EndpointID getEndpoint(uint32_t index) const { return endpoints_[index]; }
+
+        /** Register a line's sharer set so it is renumbered along with the index */
+        void track(SharerSet * set) { sets_.push_back(set); }
+
+    private:
+        static const uint32_t UNASSIGNED = 0xFFFFFFFE;
+
+        uint32_t assignIndex(EndpointID id);
+
+        vector<uint32_t>    indexOf_;   // EndpointID -> index
+        vector<EndpointID>  endpoints_; // index -> EndpointID, sorted by name
+        vector<SharerSet*>  sets_;      // Sharer sets numbered by this index
+    };
+
+    /* Sharer bitmask. The first 64 sharers are held inline, more spill into overflow words */
+    class SharerSet {
+    public:
+        SharerSet() : bits_(0) {}
+
+        void set(uint32_t i) {
+            if (i < 64) { 
+                bits_ |= (1ULL << i);
+                return;
+            }
+            size_t word = (i >> 6) - 1;
+            if (word >= overflow_.size()) overflow_.resize(word + 1, 0);
+            overflow_[word] |= (1ULL << (i & 63));
+        }
+
+        void reset(uint32_t i) {
+            if (i < 64) {
+                bits_ &= ~(1ULL << i);
+                return;
+            }
+            size_t word = (i >> 6) - 1;
+            if (word < overflow_.size()) overflow_[word] &= ~(1ULL << (i & 63));
+        }
+
+        bool test(uint32_t i) const {
+            if (i < 64) return bits_ & (1ULL << i);
+            size_t word = (i >> 6) - 1;
+            return word < overflow_.size() && (overflow_[word] & (1ULL << (i & 63)));
+        }
+
+        unsigned int count() const {
+            unsigned int num = __builtin_popcountll(bits_);
+            for (size_t i = 0; i < overflow_.size(); i++)
+                num += __builtin_popcountll(overflow_[i]);
+            return num;
+        }
+
+        bool empty() const {
+            if (bits_) return false;
+            for (size_t i = 0; i < overflow_.size(); i++)
+                if (overflow_[i]) return false;
+            return true;
+        }
+
+        /** Open a zero bit at 'pos' by moving bits [pos, size) up by one */
+        void insertAt(uint32_t pos, uint32_t size) {
+            for (uint32_t i = size; i > pos; i--) {
+                if (test(i - 1)) set(i);
+                else reset(i);
+            }
+            reset(pos);
+        }
+
+        /* Keeps overflow capacity so lines that have had many sharers don't reallocate */
+        void clear() {
+            bits_ = 0;
+            overflow_.clear();
+        }
+
+        /** Return the first set index >= i or SharerIndex::NO_SHARER */
+        uint32_t next(uint32_t i) const {
+            if (i < 64) {
+                uint64_t word = bits_ & (~0ULL << i);
+                if (word) return __builtin_ctzll(word);
+                i = 64;
+            }
+            size_t w = (i >> 6) - 1;
+            if (w >= overflow_.size()) return SharerIndex::NO_SHARER;
+            uint64_t word = overflow_[w] & (~0ULL << (i & 63));
+            while (!word) {
+                if (++w >= overflow_.size()) return SharerIndex::NO_SHARER;
+                word = overflow_[w];
+            }
+            return ((w + 1) << 6) + __builtin_ctzll(word);
+        }
+
+    private:
+        uint64_t            bits_;
+        vector<uint64_t>    overflow_;
+    };
+
+    /* Iterates the sharers of a line, yielding their EndpointIDs */
+    class SharerIterator {
+    public:
+        SharerIterator(const SharerSet * set, const SharerIndex * index, uint32_t pos) : set_(set), index_(index), pos_(pos) {}
+
+        EndpointID operator*() const { return index_->getEndpoint(pos_); }
+        SharerIterator& operator++() { pos_ = set_->next(pos_ + 1); return *this; }
+        SharerIterator operator++(int) { SharerIterator tmp(*this); ++(*this); return tmp; }
+        bool operator==(const SharerIterator &other) const { return pos_ == other.pos_; }
+        bool operator!=(const SharerIterator &other) const { return pos_ != other.pos_; }
+
+    private:
+        const SharerSet *   set_;
+        const SharerIndex * index_;
+        uint32_t            pos_;
+    };
+
+    /* Lightweight view of a line's sharers, returned by CacheLine::getSharers() */
+    class SharerList {
+    public:
+        SharerList(const SharerSet * set, const SharerIndex * index) : set_(set), index_(index) {}
+
+        SharerIterator begin() const { return SharerIterator(set_, index_, set_->next(0)); }
+        SharerIterator end() const { return SharerIterator(set_, index_, SharerIndex::NO_SHARER); }
+        unsigned int size() const { return set_->count(); }
+        bool empty() const { return set_->empty(); }
+
+    private:
+        const SharerSet *   set_;
+        const SharerIndex * index_;
+    };
+
+    /* 
+     * Fields of each line that are read when searching or picking a victim in a set. 
+     * The array keeps these packed by line index so that a probe scans contiguous memory; 
+     * each CacheLine refers to its own slots and keeps them up to date.
+     */
+    struct TagStore {
+        Addr *          tags;
+        State *         states;
+        unsigned int *  sharerCounts;
+        bool *          owned;
+
+        TagStore(unsigned int numLines) {
+            tags            = new Addr[numLines];
+            states          = new State[numLines];
+            sharerCounts    = new unsigned int[numLines];
+            owned           = new bool[numLines];
+        }
+
+        ~TagStore() {
+            delete [] tags;
+            delete [] states;
+            delete [] sharerCounts;
+            delete [] owned;
+        }
+    };
+
     /* Cache line type - didn't bother splitting into different types (L1/lower-level/dir) because space overhead is small */
     class CacheLine {
     protected:
         const uint32_t      size_;
         const int           index_;
         Output *            dbg_;
+        SharerIndex *       sharerIndex_;
         
-        Addr                baseAddr_;
-        State               state_;
-        set<std::string>    sharers_;
-        std::string         owner_;
+        /* Held in the array's TagStore */
+        Addr &              baseAddr_;
+        State &             state_;
+        unsigned int &      numSharers_;
+        bool &              owned_;
+
+        SharerSet           sharers_;
+        EndpointID          owner_;     // EMPTY_ENDPOINT if no owner
         
         uint64_t            lastSendTimestamp_; // Use to force sequential timing for subsequent accesses to the line
 
@@ -101,7 +288,11 @@ public:
         vector<uint8_t> data_;
 
     public:
-        CacheLine (unsigned int size, int index, Output * dbg, bool cache) : size_(size), index_(index), dbg_(dbg), baseAddr_(0), state_(I) {
+        CacheLine (unsigned int size, int index, Output * dbg, SharerIndex * sharerIndex, TagStore * tagStore, bool cache) : size_(size), index_(index), dbg_(dbg), 
+                sharerIndex_(sharerIndex), baseAddr_(tagStore->tags[index]), state_(tagStore->states[index]), 
+                numSharers_(tagStore->sharerCounts[index]), owned_(tagStore->owned[index]) {
+            baseAddr_ = 0;
+            sharerIndex_->track(&sharers_);
             reset();
             if (cache) data_.resize(size_/sizeof(uint8_t));
         }
@@ -111,7 +302,8 @@ public:
         void reset() {
             state_ = I;
             sharers_.clear();
-            owner_.clear();
+            numSharers_ = 0;
+            clearOwner();
             
             lastSendTimestamp_      = 0;
 
@@ -129,11 +321,12 @@ public:
             str << std::hex << "0x" << baseAddr_;
             str << " State: " << StateString[state_];
             str << " Sharers: [";
-            for (std::set<std::string>::iterator it = sharers_.begin(); it != sharers_.end(); it++) {
-                if (it != sharers_.begin()) str << ",";
-                str << *it;
+            SharerList sharers = getSharers();
+            for (SharerIterator it = sharers.begin(); it != sharers.end(); it++) {
+                if (it != sharers.begin()) str << ",";
+                str << EndpointRegistry::getName(*it);
             }
-            str << "] Owner: " << owner_;
+            str << "] Owner: " << EndpointRegistry::getName(owner_);
             return str.str();
         }
 
@@ -153,7 +346,8 @@ public:
             if (state == I) {
                 clearAtomics();
                 sharers_.clear();
-                owner_.clear();
+                numSharers_ = 0;
+                clearOwner();
             }
         }
 
@@ -167,38 +361,49 @@ public:
         /** Getter for sharer field - return whether sharer field is empty */
         bool isShareless() { return sharers_.empty(); }
         /** Getter for sharer field */
-        set<std::string>* getSharers() { return &sharers_; }
+        SharerList getSharers() { return SharerList(&sharers_, sharerIndex_); }
         /** Getter for sharer field - return number of sharers in set*/
-        unsigned int numSharers() { return sharers_.size(); }
+        unsigned int numSharers() { return numSharers_; }
         
         /** Getter for sharer field - return whether a particular sharer exists in the set*/
-        bool isSharer(std::string name) { 
-            if (name.empty()) return false; 
-            return sharers_.find(name) != sharers_.end(); 
+        bool isSharer(EndpointID id) { 
+            uint32_t index = sharerIndex_->findIndex(id);
+            if (index == SharerIndex::NO_SHARER) return false;
+            return sharers_.test(index);
         }
         
         /** Setter for sharer field - remove a specific sharer */
-        void removeSharer(std::string name) {
-            if(name.empty()) return;
-            if (sharers_.find(name) == sharers_.end()) 
-                dbg_->fatal(CALL_INFO, -1, "Error: cannot remove sharer '%s', not a current sharer. Addr = 0x%" PRIx64 "\n", name.c_str(), baseAddr_);
-            sharers_.erase(name);        
+        void removeSharer(EndpointID id) {
+            if (id == EndpointRegistry::EMPTY_ENDPOINT) return;
+            uint32_t index = sharerIndex_->findIndex(id);
+            if (index == SharerIndex::NO_SHARER || !sharers_.test(index))
+                dbg_->fatal(CALL_INFO, -1, "Error: cannot remove sharer '%s', not a current sharer. Addr = 0x%" PRIx64 "\n", EndpointRegistry::getName(id).c_str(), baseAddr_);
+            sharers_.reset(index);
+            numSharers_--;
         }
     
         /** Setter for sharer field - add a specific sharer */
-        void addSharer(std::string name) {
-            if (name.empty()) return;
-            sharers_.insert(name);
+        void addSharer(EndpointID id) {
+            uint32_t index = sharerIndex_->getIndex(id);
+            if (index == SharerIndex::NO_SHARER || sharers_.test(index)) return;
+            sharers_.set(index);
+            numSharers_++;
         }
 
         /** Setter for owner field */
-        void setOwner(std::string owner) { owner_ = owner; }
+        void setOwner(EndpointID owner) { 
+            owner_ = owner; 
+            owned_ = (owner != EndpointRegistry::EMPTY_ENDPOINT);
+        }
         /** Getter for owner field */
-        std::string getOwner() { return owner_; }
+        EndpointID getOwner() { return owner_; }
         /** Setter for owner field - clear field */
-        void clearOwner() { owner_.clear(); }
+        void clearOwner() { 
+            owner_ = EndpointRegistry::EMPTY_ENDPOINT; 
+            owned_ = false;
+        }
         /** Getter for owner field - return whether field is set */
-        bool ownerExists() { return !owner_.empty(); }
+        bool ownerExists() { return owned_; }
 
         /** Setter for timestamp field */
         void setTimestamp(uint64_t timestamp) { lastSendTimestamp_ = timestamp; }
@@ -282,6 +487,7 @@ public:
     virtual ~CacheArray() {
         for (unsigned int i = 0; i < lines_.size(); i++)
             delete lines_[i];
+        delete tagStore_;
         delete replacementMgr_;
         delete hash_;
     }
@@ -318,6 +524,20 @@ protected:
     bool            sharersAware_;
     unsigned int    slices_;    // Both slices are banks_ are banks; slices_ are external to this cache array, banks_ are internal
     unsigned int    banks_;
+    SharerIndex     sharerIndex_;   // Shared by all lines in the array
+    TagStore *      tagStore_;      // Packed tag/state/replacement fields for all lines, indexed by line index
+
+    /** Return the index of the way in [setBegin, setBegin + associativity_) holding baseAddr or -1 */
+    int findWay(unsigned int setBegin, Addr baseAddr) {
+        const Addr * tags = tagStore_->tags + setBegin;
+        /* No early exit so the compare loop can be vectorized, sets are small. 
+         * Scan from the top so that the lowest matching way wins, as with a forward search */
+        int way = -1;
+        for (int i = associativity_ - 1; i >= 0; i--) {
+            way = (tags[i] == baseAddr) ? i : way;
+        }
+        return (way == -1) ? -1 : (int)setBegin + way;
+    }
 
     CacheArray(Output* dbg, unsigned int numLines, unsigned int associativity, unsigned int lineSize,
                ReplacementMgr* replacementMgr, HashFunction* hash, bool sharersAware, bool cache) : dbg_(dbg), 
@@ -330,8 +550,9 @@ protected:
         slices_ = 1;
         banks_ = 1;
 
+        tagStore_ = new TagStore(numLines_);
         for (unsigned int i = 0; i < numLines_; i++) {
-            lines_[i] = new CacheLine(lineSize_, i, dbg_, cache);
+            lines_[i] = new CacheLine(lineSize_, i, dbg_, &sharerIndex_, tagStore_, cache);
         }
 
         printConfiguration();
@@ -358,9 +579,6 @@ public:
     void replace(Addr baseAddr, CacheLine * candidate_id, DataLine * dataCandidate);
     unsigned int preReplace(Addr baseAddr);
     void deallocate(unsigned int index);
-    State * setStates;
-    unsigned int * setSharers;
-    bool * setOwned;
 };
 
 /*
@@ -383,9 +601,6 @@ public:
     void deallocateCache(unsigned int index);
     
     vector<DataLine*> dataLines_;
-    State * dirSetStates;
-    unsigned int * dirSetSharers;
-    bool * dirSetOwned;
     State * cacheSetStates;
     unsigned int * cacheSetSharers;
     bool * cacheSetOwned;
@@ -119,7 +119,7 @@ void Cache::processCacheRequest(MemEvent* event, Command cmd, Addr baseAddr, boo
     line = cacheArray_->lookup(baseAddr, false);
 
     // Special case -> allocate line for prefetches to non-inclusive caches
-    bool localPrefetch = event->isPrefetch() && event->getRqstr() == getName();
+    bool localPrefetch = event->isPrefetch() && event->getRqstrID() == nameID_;
     if (type_ == "noninclusive_with_directory" && localPrefetch && line->getDataLine() == NULL && line->getState() == I) {
         if (!allocateDirCacheLine(event, baseAddr, line, false)) {
             if (is_debug_addr(baseAddr)) d_->debug(_L3_, "-- Data Cache Miss --\n");
@@ -356,11 +356,13 @@ bool Cache::allocateLine(MemEvent * event, Addr baseAddr) {
             return false;
         }
         
+        Addr victimAddr = replacementLine->getBaseAddr();
         CacheAction action = coherenceMgr_->handleEviction(replacementLine, this->getName(), false);
         if (action == STALL) {
             mshr_->insertPointer(replacementLine->getBaseAddr(), event->getBaseAddr());
             return false;
         }
+        if (trackPrefetches_) trackPrefetchEviction(victimAddr);
     }
 
     /* OK to replace line */
@@ -383,11 +385,13 @@ bool Cache::allocateCacheLine(MemEvent* event, Addr baseAddr) {
             return false;
         }
         
+        Addr victimAddr = replacementLine->getBaseAddr();
         CacheAction action = coherenceMgr_->handleEviction(replacementLine, this->getName(), false);
         if (action == STALL) {
             mshr_->insertPointer(replacementLine->getBaseAddr(), event->getBaseAddr());
             return false;
         }
+        if (trackPrefetches_) trackPrefetchEviction(victimAddr);
     }
     
     /* OK to replace line  */
@@ -415,6 +419,7 @@ bool Cache::allocateDirCacheLine(MemEvent * event, Addr baseAddr, CacheLine * di
             mshr_->insertPointer(replacementDirLine->getBaseAddr(), baseAddr);
             return false;
         }
+        if (trackPrefetches_) trackPrefetchEviction(replacementDirLine->getBaseAddr());
         coherenceMgr_->handleEviction(replacementDirLine, this->getName(), true);
     }
 
@@ -445,7 +450,8 @@ void Cache::activatePrevEvents(Addr baseAddr) {
     //mshr_->printTable();
     if (!mshr_->isHit(baseAddr)) return;
     
-    vector<mshrType> entries = mshr_->removeAll(baseAddr);
+    vector<mshrType> entries;
+    mshr_->removeAll(baseAddr, entries);
     bool cont;
     int i = 0;
     
@@ -472,7 +478,8 @@ void Cache::activatePrevEvents(Addr baseAddr) {
             
             // Reactivate entries for address that was waiting for baseAddr
             // This entry list shouldn't include pointers unless a writeback occured (and even then...)
-            vector<mshrType> pointerEntries = mshr_->removeAll(pointerAddr);    
+            vector<mshrType> pointerEntries;
+            mshr_->removeAll(pointerAddr, pointerEntries);
             for (vector<mshrType>::iterator it2 = pointerEntries.begin(); it2 != pointerEntries.end(); i++) {
                 if ((*it2).elem.isAddr()) {
                     Addr elemAddr = ((*it2).elem).getAddr();
@@ -613,8 +620,13 @@ void Cache::postRequestProcessing(MemEvent* event, CacheLine* cacheLine, bool re
     Addr addr   = event->getBaseAddr();
 
     /* Clean up */
-    if (event->isPrefetch() && event->getRqstr() == this->getName() && !replay) {
-        statPrefetchHit->addData(1);
+    if (event->isPrefetch() && event->getRqstrID() == nameID_) {
+        if (!replay) {
+            statPrefetchHit->addData(1);
+            listener_->notifyPrefetchResult(addr, PREFETCH_REDUNDANT);
+        } else if (trackPrefetches_) {
+            trackPrefetchFill(addr);
+        }
     }
     recordLatency(event);
     delete event;
@@ -640,7 +652,7 @@ void Cache::reActivateEventWaitingForUserLock(CacheLine* cacheLine) {
 /* ---------------------------------------
    Extras
    --------------------------------------- */
-MemEvent* Cache::getOrigReq(const vector<mshrType> entries) {
+MemEvent* Cache::getOrigReq(const vector<mshrType>& entries) {
     if (entries.front().elem.isAddr()) {
         out_->fatal(CALL_INFO, -1, "%s, Error: Request at front of the mshr is not of type MemEvent. Time = %" PRIu64 "\n",
                 this->getName().c_str(), getCurrentSimTimeNano());
@@ -710,7 +722,7 @@ void Cache::printLine(Addr addr) {
         State state = (line == nullptr) ? NP : line->getState();
         bool isCached = (line == nullptr) ? false : (line->getDataLine() != NULL);
         unsigned int sharers = (line == nullptr) ? 0 : line->numSharers();
-        string owner = (line == nullptr) ? "" : line->getOwner();
+        string owner = (line == nullptr) ? "" : EndpointRegistry::getName(line->getOwner());
         d_->debug(_L8_, "0x%" PRIx64 ": %s, %u, \"%s\" %d\n", 
                 addr, StateString[state], sharers, owner.c_str(), isCached); 
     } else if (L1_) {
@@ -721,7 +733,7 @@ void Cache::printLine(Addr addr) {
         CacheLine * line = cacheArray_->lookup(addr, false);
         State state = (line == nullptr) ? NP : line->getState();
         unsigned int sharers = (line == NULL) ? 0 : line->numSharers();
-        string owner = (line == NULL) ? "" : line->getOwner();
+        string owner = (line == NULL) ? "" : EndpointRegistry::getName(line->getOwner());
         d_->debug(_L8_, "0x%" PRIx64 ": %s, %u, \"%s\"\n", addr, StateString[state], sharers, owner.c_str());
     }
 }
@@ -41,6 +41,7 @@
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/cacheListener.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/addrHashMap.h"
 
 namespace SST { namespace MemHierarchy {
 
@@ -138,6 +139,10 @@ public:
             {"TotalEventsReplayed",     "Total number of events that were initially blocked and then were replayed", "events", 1},
             {"TotalNoncacheableEventsReceived", "Total number of non-cache or noncacheable cache events that were received by this cache and forward", "events", 1},
             {"MSHR_occupancy",          "Number of events in MSHR each cycle", "events", 1},
+            {"MSHR_probe_length",       "Number of MSHR table slots examined per MSHR lookup", "count", 10},
+            {"EventPool_allocations",   "Number of memory events allocated while this cache was handling events", "events", 10},
+            {"EventPool_heap_allocations", "Number of memory event allocations that could not be satisfied from the event pool", "events", 10},
+            {"EventPool_releases",      "Number of memory events freed back to the event pool while this cache was handling events", "events", 10},
             {"Bank_conflicts",          "Total number of bank conflicts detected", "count", 1},
             {"Prefetch_requests",       "Number of prefetches received from prefetcher at this cache", "events", 1},
             {"Prefetch_hits",           "Number of prefetches that were cancelled due to cache or MSHR hit", "events", 1},
@@ -212,6 +217,11 @@ private:
     
     /** Self-Event prefetch handler for this component */
     void processPrefetchEvent(SST::Event *event);
+
+    /** Prefetch feedback to the listener: a demand request arrived for / the cache is evicting / a prefetch filled 'baseAddr' */
+    void trackPrefetchDemand(Addr baseAddr);
+    void trackPrefetchEviction(Addr baseAddr);
+    void trackPrefetchFill(Addr baseAddr);
     
     /** Function processes incomming access requests from HiLv$ or the CPU
         It appropriately redirects requests to Top and/or Bottom controllers.  */
@@ -281,7 +291,7 @@ private:
     void recordLatency(MemEvent * event);
 
     /** Get the front element of a MSHR entry */
-    MemEvent* getOrigReq(const vector<mshrType> entries);
+    MemEvent* getOrigReq(const vector<mshrType>& entries);
    
     /** Print cache line for debugging */
     void printLine(Addr addr);
@@ -351,6 +361,8 @@ private:
     /* Cache structures */
     CacheArray*             cacheArray_;
     CacheListener*          listener_;
+    bool                    trackPrefetches_;   // Whether a prefetcher is attached and wants feedback
+    AddrHashMap<uint8_t>    prefetchedLines_;   // Lines brought in (or being brought in) by our prefetcher and not yet used
     MemLinkBase*            linkUp_;
     MemLinkBase*            linkDown_;
     Link*                   prefetchLink_;
@@ -371,7 +383,8 @@ private:
     vector<string>          upperLevelCacheNames_;
     uint64_t                timestamp_;
     int                     requestsThisCycle_;
-    std::map<SST::Event::id_type, std::string> responseDst_; 
+    std::map<SST::Event::id_type, EndpointID> responseDst_;
+    EndpointID              nameID_;            // Interned getName() 
     std::queue<MemEventBase*>       requestBuffer_;                 // Buffer requests that can't be processed due to port limits
     std::vector< std::queue<MemEventBase*> > bankConflictBuffer_;   // Buffer requests that have bank conflicts
     std::map<MemEvent*,uint64>      startTimeList_;
@@ -429,6 +442,10 @@ private:
     Statistic<uint64_t>* statInvStalledByLockedLine;
 
     Statistic<uint64_t>* statMSHROccupancy;
+    Statistic<uint64_t>* statMSHRProbeLength;
+    Statistic<uint64_t>* statEventPoolAllocations;
+    Statistic<uint64_t>* statEventPoolHeapAllocations;
+    Statistic<uint64_t>* statEventPoolReleases;
     Statistic<uint64_t>* statBankConflicts;
 
     // Prefetch statistics
@@ -283,11 +283,15 @@ bool Cache::processEvent(MemEventBase* ev, bool replay) {
             }
             
             profileEvent(event, cmd, replay, canStall);
+
+            if (trackPrefetches_ && !replay && !event->isPrefetch())
+                trackPrefetchDemand(baseAddr);
             
             if (mshr_->isHit(baseAddr) && canStall) {
                 // Drop local prefetches if there are outstanding requests for the same address NOTE this includes replacements/inv/etc.
-                if (event->isPrefetch() && event->getRqstr() == this->getName()) {
+                if (event->isPrefetch() && event->getRqstrID() == nameID_) {
                     statPrefetchDrop->addData(1);
+                    listener_->notifyPrefetchResult(baseAddr, PREFETCH_DROPPED);
                     delete event;
                     break;
                 }
@@ -360,11 +364,11 @@ bool Cache::processEvent(MemEventBase* ev, bool replay) {
 void Cache::processNoncacheable(MemEventBase* event) {
     if (CommandCPUSide[(int)event->getCmd()]) {
         if (!(event->queryFlag(MemEvent::F_NORESPONSE))) {
-            responseDst_.insert(std::make_pair(event->getID(), event->getSrc()));
+            responseDst_.insert(std::make_pair(event->getID(), event->getSrcID()));
         }
         coherenceMgr_->forwardTowardsMem(event);
     } else {
-        std::map<SST::Event::id_type,std::string>::iterator it = responseDst_.find(event->getResponseToID());
+        std::map<SST::Event::id_type,EndpointID>::iterator it = responseDst_.find(event->getResponseToID());
         if (it == responseDst_.end()) {
             out_->fatal(CALL_INFO, 01, "%s, Error: noncacheable response received does not match a request. Event: (%s). Time: %" PRIu64 "\n",
                     getName().c_str(), event->getVerboseString().c_str(), getCurrentSimTimeNano());
@@ -399,15 +403,62 @@ void Cache::processPrefetchEvent(SST::Event* ev) {
             processEvent(event, false);
         } else {
             statPrefetchDrop->addData(1);
+            listener_->notifyPrefetchResult(event->getBaseAddr(), PREFETCH_DROPPED);
             delete event;
         }
     } else {
         statPrefetchDrop->addData(1);
+        listener_->notifyPrefetchResult(event->getBaseAddr(), PREFETCH_DROPPED);
         delete event;
     }
 }
 
 
+/* 
+ * Prefetch feedback
+ * Lines our prefetcher brought in are remembered until they are used or leave the cache
+ * so the listener can learn how accurate and timely its prefetches are
+ */
+enum { PREFETCH_LINE_LATE = 1, PREFETCH_LINE_RESIDENT = 2 };
+
+void Cache::trackPrefetchDemand(Addr baseAddr) {
+    uint8_t * state = prefetchedLines_.find(baseAddr);
+    if (state != nullptr) {
+        if (*state == PREFETCH_LINE_LATE) return; // Already reported
+        prefetchedLines_.erase(baseAddr);
+
+        /* The line may have been invalidated from below since it was prefetched */
+        CacheLine * line = cacheArray_->lookup(baseAddr, false);
+        listener_->notifyPrefetchResult(baseAddr, (line != nullptr && line->valid()) ? PREFETCH_USEFUL : PREFETCH_UNUSED);
+        return;
+    }
+
+    if (mshr_->exists(baseAddr)) {
+        MemEvent * front = mshr_->lookupFront(baseAddr);
+        if (front->isPrefetch() && front->getRqstrID() == nameID_) {
+            prefetchedLines_[baseAddr] = PREFETCH_LINE_LATE;
+            listener_->notifyPrefetchResult(baseAddr, PREFETCH_LATE);
+        }
+    }
+}
+
+void Cache::trackPrefetchFill(Addr baseAddr) {
+    uint8_t * state = prefetchedLines_.find(baseAddr);
+    if (state != nullptr && *state == PREFETCH_LINE_LATE)
+        prefetchedLines_.erase(baseAddr);  // Demand request was waiting on it, so it has been used
+    else
+        prefetchedLines_[baseAddr] = PREFETCH_LINE_RESIDENT;
+}
+
+void Cache::trackPrefetchEviction(Addr baseAddr) {
+    uint8_t * state = prefetchedLines_.find(baseAddr);
+    if (state != nullptr && *state == PREFETCH_LINE_RESIDENT) {
+        prefetchedLines_.erase(baseAddr);
+        listener_->notifyPrefetchResult(baseAddr, PREFETCH_UNUSED);
+    }
+}
+
+
 
 void Cache::init(unsigned int phase) {
     if (linkUp_ == linkDown_) {
@@ -457,7 +508,7 @@ void Cache::init(unsigned int phase) {
             d_->debug(_L10_, "%s received init event %s\n", getName().c_str(), memEvent->getVerboseString().c_str());
             MemEventInit * mEv = memEvent->clone();
             mEv->setSrc(getName());
-            mEv->setDst(linkDown_->findTargetDestination(mEv->getRoutingAddress()));
+            mEv->setDstID(linkDown_->findTargetDestinationID(mEv->getRoutingAddress()));
             linkDown_->sendInitData(mEv);
         }
         delete memEvent;
@@ -556,6 +607,7 @@ void Cache::finish() {
 
 /* Main handler for links to upper and lower caches/cores/buses/etc */
 void Cache::processIncomingEvent(SST::Event* ev) {
+    MemEventPoolScope<Statistic<uint64_t> > poolScope(statEventPoolAllocations, statEventPoolHeapAllocations, statEventPoolReleases);
     MemEventBase* event = static_cast<MemEventBase*>(ev);
     if (!clockIsOn_) {
         turnClockOn();
@@ -577,6 +629,7 @@ void Cache::processIncomingEvent(SST::Event* ev) {
 
 /* Clock handler */
 bool Cache::clockTick(Cycle_t time) {
+    MemEventPoolScope<Statistic<uint64_t> > poolScope(statEventPoolAllocations, statEventPoolHeapAllocations, statEventPoolReleases);
     timestamp_++;
     bool queuesEmpty = coherenceMgr_->sendOutgoingCommands(getCurrentSimTimeNano());
         
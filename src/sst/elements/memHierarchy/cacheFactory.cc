@@ -49,6 +49,8 @@ Cache::Cache(ComponentId_t id, Params &params) : Component(id) {
     
     d2_ = new Output();
     d2_->init("", params.find<int>("debug_level", 1), 0,(Output::output_location_t)params.find<int>("debug", SST::Output::NONE));
+
+    nameID_ = EndpointRegistry::intern(getName());
     
     /* Debug filtering */
     std::vector<Addr> addrArr;
@@ -382,6 +384,7 @@ void Cache::createPrefetcher(Params &params, int mshrSize) {
         dropPrefetchLevel_ = mshrSize - 1; // Always have to leave one free for deadlock avoidance
     }
     
+    trackPrefetches_ = !prefetcher.empty();
     if (prefetcher.empty()) {
 	Params emptyParams;
 	listener_ = new CacheListener(this, emptyParams);
@@ -632,5 +635,10 @@ void Cache::registerStatistics() {
     statInv_recv                    = registerStatistic<uint64_t>("Inv_recv");
     statNACK_recv                   = registerStatistic<uint64_t>("NACK_recv");
     statMSHROccupancy               = registerStatistic<uint64_t>("MSHR_occupancy");
+    statMSHRProbeLength             = registerStatistic<uint64_t>("MSHR_probe_length");
+    mshr_->setProbeLengthStatistic(statMSHRProbeLength);
+    statEventPoolAllocations        = registerStatistic<uint64_t>("EventPool_allocations");
+    statEventPoolHeapAllocations    = registerStatistic<uint64_t>("EventPool_heap_allocations");
+    statEventPoolReleases           = registerStatistic<uint64_t>("EventPool_releases");
     statBankConflicts               = registerStatistic<uint64_t>("Bank_conflicts");
 }
@@ -40,6 +40,15 @@ namespace MemHierarchy {
 enum NotifyAccessType{ READ, WRITE };
 enum NotifyResultType{ HIT, MISS };
 
+/* What became of a prefetch the cache accepted from its listener */
+enum NotifyPrefetchResultType{
+    PREFETCH_USEFUL,        // A demand request hit the prefetched line
+    PREFETCH_LATE,          // A demand request arrived while the prefetch was still outstanding
+    PREFETCH_REDUNDANT,     // The line was already in the cache
+    PREFETCH_DROPPED,       // The cache was too busy or the line was already being fetched
+    PREFETCH_UNUSED         // The prefetched line left the cache before it was used (pollution)
+};
+
 class CacheListenerNotification {
 public:
 	CacheListenerNotification(const Addr pAddr, const Addr vAddr,
@@ -72,6 +81,7 @@ public:
 
     virtual void printStats(Output &UNUSED(out)) {}
     virtual void notifyAccess(const CacheListenerNotification& UNUSED(notify)) {}
+    virtual void notifyPrefetchResult(const Addr UNUSED(baseAddr), NotifyPrefetchResultType UNUSED(result)) {}
     virtual void registerResponseCallback(Event::HandlerBase *handler) { delete handler; }
 };
 
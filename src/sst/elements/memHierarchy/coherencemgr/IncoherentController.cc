@@ -206,7 +206,7 @@ CacheAction IncoherentController::handleGetSRequest(MemEvent* event, CacheLine*
     vector<uint8_t>* data = cacheLine->getData();
     if (is_debug_event(event)) printData(cacheLine->getData(), false);
 
-    bool shouldRespond = !(event->isPrefetch() && (event->getRqstr() == parent->getName()));
+    bool shouldRespond = !(event->isPrefetch() && (event->getRqstrID() == parentID_));
     recordStateEventCount(event->getCmd(), state);
 
     uint64_t sendTime = 0;
@@ -355,7 +355,7 @@ CacheAction IncoherentController::handleDataResponse(MemEvent* responseEvent, Ca
     State state = cacheLine->getState();
     recordStateEventCount(responseEvent->getCmd(), state);
     
-    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstr() == parent->getName()));
+    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstrID() == parentID_));
     uint64_t sendTime = 0;
     switch (state) {
         case IS:
@@ -444,7 +444,7 @@ void IncoherentController::forwardFlushLine(Addr baseAddr, string origRqstr, Cac
 void IncoherentController::sendFlushResponse(MemEvent * requestEvent, bool success) {
     MemEvent * flushResponse = requestEvent->makeResponse();
     flushResponse->setSuccess(success);
-    flushResponse->setDst(requestEvent->getSrc());
+    flushResponse->setDstID(requestEvent->getSrcID());
 
     uint64_t deliveryTime = timestamp_ + mshrLatency_;
     Response resp = {flushResponse, deliveryTime, packetHeaderBytes};
@@ -252,7 +252,7 @@ CacheAction L1CoherenceController::handleGetSRequest(MemEvent* event, CacheLine*
     State state = cacheLine->getState();
     vector<uint8_t>* data = cacheLine->getData();
     
-    bool shouldRespond = !(event->isPrefetch() && (event->getRqstr() == parent->getName()));
+    bool shouldRespond = !(event->isPrefetch() && (event->getRqstrID() == parentID_));
     recordStateEventCount(event->getCmd(), state);
     uint64_t sendTime = 0;
     switch (state) {
@@ -403,7 +403,7 @@ CacheAction L1CoherenceController::handleFlushLineInvRequest(MemEvent * event, C
  */
 void L1CoherenceController::handleDataResponse(MemEvent* responseEvent, CacheLine* cacheLine, MemEvent* origRequest){
     
-    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstr() == parent->getName()));
+    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstrID() == parentID_));
     
     State state = cacheLine->getState();
     recordStateEventCount(responseEvent->getCmd(), state);
@@ -632,7 +632,7 @@ int L1CoherenceController::isCoherenceMiss(MemEvent* event, CacheLine* cacheLine
     if (cmd == Command::GetSX) cmd = Command::GetX;  // for our purposes these are equal
 
     if (state == I) return 1;
-    if (event->isPrefetch() && event->getRqstr() == parent->getName()) return 0;
+    if (event->isPrefetch() && event->getRqstrID() == parentID_) return 0;
     
     switch (state) {
         case S:
@@ -686,7 +686,7 @@ void L1CoherenceController::sendResponseDown(MemEvent* event, CacheLine* cacheLi
 uint64_t L1CoherenceController::sendResponseUp(MemEvent * event, std::vector<uint8_t>* data, bool replay, uint64_t baseTime, bool finishedAtomically) {
     Command cmd = event->getCmd();
     MemEvent * responseEvent = event->makeResponse();
-    responseEvent->setDst(event->getSrc());
+    responseEvent->setDstID(event->getSrcID());
     bool noncacheable = event->queryFlag(MemEvent::F_NONCACHEABLE);
      
     if (!noncacheable) {
@@ -808,8 +808,8 @@ void L1CoherenceController::forwardFlushLine(Addr baseAddr, Command cmd, string
 void L1CoherenceController::sendFlushResponse(MemEvent * requestEvent, bool success, uint64_t baseTime, bool replay) {
     MemEvent * flushResponse = requestEvent->makeResponse();
     flushResponse->setSuccess(success);
-    flushResponse->setDst(requestEvent->getSrc());
-    flushResponse->setRqstr(requestEvent->getRqstr());
+    flushResponse->setDstID(requestEvent->getSrcID());
+    flushResponse->setRqstrID(requestEvent->getRqstrID());
     
     uint64_t deliveryTime = baseTime + (replay ? mshrLatency_ : tagLatency_);
     Response resp = {flushResponse, deliveryTime, packetHeaderBytes};
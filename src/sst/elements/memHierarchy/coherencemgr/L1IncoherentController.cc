@@ -177,7 +177,7 @@ CacheAction L1IncoherentController::handleGetSRequest(MemEvent* event, CacheLine
     State state = cacheLine->getState();
     vector<uint8_t>* data = cacheLine->getData();
     
-    bool shouldRespond = !(event->isPrefetch() && (event->getRqstr() == parent->getName()));
+    bool shouldRespond = !(event->isPrefetch() && (event->getRqstrID() == parentID_));
     recordStateEventCount(event->getCmd(), state);
     
     uint64_t sendTime = 0;
@@ -310,7 +310,7 @@ CacheAction L1IncoherentController::handleFlushLineInvRequest(MemEvent * event,
 void L1IncoherentController::handleDataResponse(MemEvent* responseEvent, CacheLine* cacheLine, MemEvent* origRequest){
     
     cacheLine->setData(responseEvent->getPayload(), 0);
-    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstr() == parent->getName()));
+    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstrID() == parentID_));
     
     State state = cacheLine->getState();
     recordStateEventCount(responseEvent->getCmd(), state);
@@ -382,7 +382,7 @@ int L1IncoherentController::isCoherenceMiss(MemEvent* event, CacheLine* cacheLin
 uint64_t L1IncoherentController::sendResponseUp(MemEvent * event, std::vector<uint8_t>* data, bool replay, uint64_t baseTime, bool finishedAtomically) {
     Command cmd = event->getCmd();
     MemEvent * responseEvent = event->makeResponse();
-    responseEvent->setDst(event->getSrc());
+    responseEvent->setDstID(event->getSrcID());
     bool noncacheable = event->queryFlag(MemEvent::F_NONCACHEABLE);
     
     if (!noncacheable) {
@@ -466,8 +466,8 @@ void L1IncoherentController::forwardFlushLine(Addr baseAddr, Command cmd, string
 void L1IncoherentController::sendFlushResponse(MemEvent * requestEvent, bool success, uint64_t baseTime, bool replay) {
     MemEvent * flushResponse = requestEvent->makeResponse();
     flushResponse->setSuccess(success);
-    flushResponse->setDst(requestEvent->getSrc());
-    flushResponse->setRqstr(requestEvent->getRqstr());
+    flushResponse->setDstID(requestEvent->getSrcID());
+    flushResponse->setRqstrID(requestEvent->getRqstrID());
     
     uint64_t deliveryTime = baseTime + (replay ? mshrLatency_ : tagLatency_);
     Response resp = {flushResponse, deliveryTime, packetHeaderBytes};
@@ -75,7 +75,7 @@ CacheAction MESIController::handleEviction(CacheLine* wbCacheLine, string rqstr,
                 return DONE;
             }
             if (wbCacheLine->numSharers() > 0) {
-                invalidateAllSharers(wbCacheLine, parent->getName(), false); 
+                invalidateAllSharers(wbCacheLine, parentID_, false); 
                 wbCacheLine->setState(SI);
                 
                 if (is_debug_addr(wbBaseAddr)) debug->debug(_L7_, "Eviction requires invalidating sharers\n");
@@ -92,7 +92,7 @@ CacheAction MESIController::handleEviction(CacheLine* wbCacheLine, string rqstr,
                 return DONE;
             }
             if (wbCacheLine->numSharers() > 0) {
-                invalidateAllSharers(wbCacheLine, parent->getName(), false); 
+                invalidateAllSharers(wbCacheLine, parentID_, false); 
                 wbCacheLine->setState(EI);
                 
                 if (is_debug_addr(wbBaseAddr)) debug->debug(_L7_, "Eviction requires invalidating sharers\n");
@@ -100,7 +100,7 @@ CacheAction MESIController::handleEviction(CacheLine* wbCacheLine, string rqstr,
                 return STALL;
             }
             if (wbCacheLine->ownerExists()) {
-                sendFetchInv(wbCacheLine, parent->getName(), false);
+                sendFetchInv(wbCacheLine, parentID_, false);
                 mshr_->incrementAcksNeeded(wbBaseAddr);
                 wbCacheLine->setState(EI);
                 
@@ -118,7 +118,7 @@ CacheAction MESIController::handleEviction(CacheLine* wbCacheLine, string rqstr,
                 return DONE;
             }
             if (wbCacheLine->numSharers() > 0) {
-                invalidateAllSharers(wbCacheLine, parent->getName(), false); 
+                invalidateAllSharers(wbCacheLine, parentID_, false); 
                 wbCacheLine->setState(MI);
                 
                 if (is_debug_addr(wbBaseAddr)) debug->debug(_L7_, "Eviction requires invalidating sharers\n");
@@ -126,7 +126,7 @@ CacheAction MESIController::handleEviction(CacheLine* wbCacheLine, string rqstr,
                 return STALL;
             }
             if (wbCacheLine->ownerExists()) {
-                sendFetchInv(wbCacheLine, parent->getName(), false);
+                sendFetchInv(wbCacheLine, parentID_, false);
     /* Event/State combinations - Count how many times an event was seen in particular state */
                 mshr_->incrementAcksNeeded(wbBaseAddr);
                 wbCacheLine->setState(MI);
@@ -300,12 +300,12 @@ bool MESIController::isRetryNeeded(MemEvent* event, CacheLine* cacheLine) {
         case Command::FetchInv:
         case Command::FetchInvX:
             if (state == I) return false;   // Already resolved the request, don't resend
-            if (cacheLine->getOwner() != event->getDst()) {
-                if (cacheLine->isSharer(event->getDst()) && cmd == Command::FetchInv) { // Got a downgrade from the owner but still need to invalidate
+            if (cacheLine->getOwner() != event->getDstID()) {
+                if (cacheLine->isSharer(event->getDstID()) && cmd == Command::FetchInv) { // Got a downgrade from the owner but still need to invalidate
                     uint64_t deliveryTime = 0;
                     MemEvent * inv = new MemEvent(parent, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Command::Inv);
-                    inv->setDst(event->getDst());
-                    inv->setRqstr(event->getRqstr());
+                    inv->setDstID(event->getDstID());
+                    inv->setRqstrID(event->getRqstrID());
                     inv->setSize(cacheLine->getSize());
                     deliveryTime = timestamp_  + mshrLatency_;
                     Response resp = {inv, deliveryTime, packetHeaderBytes};
@@ -321,7 +321,7 @@ bool MESIController::isRetryNeeded(MemEvent* event, CacheLine* cacheLine) {
             return true;
         case Command::Inv:
             if (state == I) return false;   // Already resolved the request, don't resend
-            if (!cacheLine->isSharer(event->getDst())) return false;    // Must have gotten a replacement from this sharer
+            if (!cacheLine->isSharer(event->getDstID())) return false;    // Must have gotten a replacement from this sharer
             return true;
         default:
             debug->fatal(CALL_INFO,-1,"%s, Error: NACKed event is unrecognized. Event = %s. Time = %" PRIu64 "ns\n",
@@ -343,7 +343,7 @@ int MESIController::isCoherenceMiss(MemEvent* event, CacheLine* cacheLine) {
     if (cmd == Command::GetSX) cmd = Command::GetX;  // for our purposes these are equal
 
     if (state == I) return 1;
-    if (event->isPrefetch() && event->getRqstr() == parent->getName()) return 0;
+    if (event->isPrefetch() && event->getRqstrID() == parentID_) return 0;
     if (state == S && lastLevel_) state = M;
     switch (state) {
         case S:
@@ -354,7 +354,7 @@ int MESIController::isCoherenceMiss(MemEvent* event, CacheLine* cacheLine) {
             if (cacheLine->ownerExists()) return 3;
             if (cmd == Command::GetS) return 0;  // hit
             if (cmd == Command::GetX) {
-                if (cacheLine->isShareless() || (cacheLine->isSharer(event->getSrc()) && cacheLine->numSharers() == 1)) return 0; // Hit
+                if (cacheLine->isShareless() || (cacheLine->isSharer(event->getSrcID()) && cacheLine->numSharers() == 1)) return 0; // Hit
             }
             return 3;
         case IS:
@@ -387,7 +387,7 @@ CacheAction MESIController::handleGetSRequest(MemEvent* event, CacheLine* cacheL
     if (is_debug_event(event)) printData(cacheLine->getData(), false);
     
     uint64_t sendTime = 0;
-    bool shouldRespond = !(event->isPrefetch() && (event->getRqstr() == parent->getName()));
+    bool shouldRespond = !(event->isPrefetch() && (event->getRqstrID() == parentID_));
     recordStateEventCount(event->getCmd(), state);
     switch (state) {
         case I:
@@ -399,7 +399,7 @@ CacheAction MESIController::handleGetSRequest(MemEvent* event, CacheLine* cacheL
         case S:
             notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
             if (!shouldRespond) return DONE;
-            cacheLine->addSharer(event->getSrc());
+            cacheLine->addSharer(event->getSrcID());
             sendTime = sendResponseUp(event, data, replay, cacheLine->getTimestamp());
             cacheLine->setTimestamp(sendTime);
             return DONE;
@@ -413,14 +413,14 @@ CacheAction MESIController::handleGetSRequest(MemEvent* event, CacheLine* cacheL
             if (!inclusive_) {
                 sendTime = sendResponseUp(event, Command::GetXResp, data, state == M, replay, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
-                cacheLine->setOwner(event->getSrc());
+                cacheLine->setOwner(event->getSrcID());
                 return DONE;
             }
 
             if (cacheLine->isShareless() && !cacheLine->ownerExists() && protocol_) {
                 if (is_debug_addr(cacheLine->getBaseAddr())) debug->debug(_L7_, "New owner: %s\n", event->getSrc().c_str());
                 
-                cacheLine->setOwner(event->getSrc());
+                cacheLine->setOwner(event->getSrcID());
                 sendTime = sendResponseUp(event, Command::GetXResp, data, replay, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
                 return DONE;
@@ -428,13 +428,13 @@ CacheAction MESIController::handleGetSRequest(MemEvent* event, CacheLine* cacheL
             if (cacheLine->ownerExists()) {
                 if (is_debug_addr(cacheLine->getBaseAddr())) debug->debug(_L7_,"GetS request but exclusive owner exists \n");
                 
-                sendFetchInvX(cacheLine, event->getRqstr(), replay);
+                sendFetchInvX(cacheLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 if (state == E) cacheLine->setState(E_InvX);
                 else cacheLine->setState(M_InvX);
                 return STALL;
             }
-            cacheLine->addSharer(event->getSrc());
+            cacheLine->addSharer(event->getSrcID());
             sendTime = sendResponseUp(event, data, replay, cacheLine->getTimestamp());
             cacheLine->setTimestamp(sendTime);
             return DONE;
@@ -472,7 +472,7 @@ CacheAction MESIController::handleGetXRequest(MemEvent* event, CacheLine* cacheL
         case S:
             notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
             sendTime = forwardMessage(event, cacheLine->getBaseAddr(), cacheLine->getSize(), cacheLine->getTimestamp(), NULL);
-            if (invalidateSharersExceptRequestor(cacheLine, event->getSrc(), event->getRqstr(), replay)) {
+            if (invalidateSharersExceptRequestor(cacheLine, event->getSrcID(), event->getRqstrID(), replay)) {
                 cacheLine->setState(SM_Inv);
             } else {
                 cacheLine->setState(SM);
@@ -485,19 +485,19 @@ CacheAction MESIController::handleGetXRequest(MemEvent* event, CacheLine* cacheL
             notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
 
             if (!cacheLine->isShareless()) {
-                if (invalidateSharersExceptRequestor(cacheLine, event->getSrc(), event->getRqstr(), replay)) {
+                if (invalidateSharersExceptRequestor(cacheLine, event->getSrcID(), event->getRqstrID(), replay)) {
                     cacheLine->setState(M_Inv);
                     return STALL;
                 }
             }
             if (cacheLine->ownerExists()) {
-                sendFetchInv(cacheLine, event->getRqstr(), replay);
+                sendFetchInv(cacheLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 cacheLine->setState(M_Inv);
                 return STALL;
             }
-            cacheLine->setOwner(event->getSrc());
-            if (cacheLine->isSharer(event->getSrc())) cacheLine->removeSharer(event->getSrc());
+            cacheLine->setOwner(event->getSrcID());
+            if (cacheLine->isSharer(event->getSrcID())) cacheLine->removeSharer(event->getSrcID());
             sendTime = sendResponseUp(event, cacheLine->getData(), replay, cacheLine->getTimestamp());
             cacheLine->setTimestamp(sendTime);
             
@@ -536,16 +536,16 @@ CacheAction MESIController::handleFlushLineRequest(MemEvent * event, CacheLine*
             break;
         case E:
         case M:
-            if (cacheLine->getOwner() == event->getSrc()) {
+            if (cacheLine->getOwner() == event->getSrcID()) {
                 cacheLine->clearOwner();
-                cacheLine->addSharer(event->getSrc());
+                cacheLine->addSharer(event->getSrcID());
                 if (event->getDirty()) {
                     cacheLine->setData(event->getPayload(), 0);
                     cacheLine->setState(M);
                 }
             }
             if (cacheLine->ownerExists()) {
-                sendFetchInvX(cacheLine, event->getRqstr(), replay);
+                sendFetchInvX(cacheLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 state == M ? cacheLine->setState(M_InvX) : cacheLine->setState(E_InvX);
                 return STALL;
@@ -560,9 +560,9 @@ CacheAction MESIController::handleFlushLineRequest(MemEvent * event, CacheLine*
             return STALL; // Wait for the Get* request to finish
         case EI:
         case MI:
-            if (cacheLine->getOwner() == event->getSrc()) {
+            if (cacheLine->getOwner() == event->getSrcID()) {
                 cacheLine->clearOwner();
-                cacheLine->addSharer(event->getSrc());
+                cacheLine->addSharer(event->getSrcID());
                 if (event->getDirty()) {
                     cacheLine->setData(event->getPayload(), 0);
                     cacheLine->setState(MI);
@@ -571,9 +571,9 @@ CacheAction MESIController::handleFlushLineRequest(MemEvent * event, CacheLine*
             return STALL;
         case M_Inv:
         case E_Inv:
-            if (cacheLine->getOwner() == event->getSrc()) {
+            if (cacheLine->getOwner() == event->getSrcID()) {
                 cacheLine->clearOwner();
-                cacheLine->addSharer(event->getSrc());
+                cacheLine->addSharer(event->getSrcID());
                 if (event->getDirty()) {
                     cacheLine->setData(event->getPayload(), 0);
                     cacheLine->setState(M_Inv);
@@ -582,9 +582,9 @@ CacheAction MESIController::handleFlushLineRequest(MemEvent * event, CacheLine*
             return STALL;
         case M_InvX:
         case E_InvX:
-            if (cacheLine->getOwner() == event->getSrc()) {
+            if (cacheLine->getOwner() == event->getSrcID()) {
                 cacheLine->clearOwner();
-                cacheLine->addSharer(event->getSrc());
+                cacheLine->addSharer(event->getSrcID());
                 mshr_->decrementAcksNeeded(event->getBaseAddr());
                 if (event->getDirty()) {
                     cacheLine->setData(event->getPayload(), 0);
@@ -606,7 +606,7 @@ CacheAction MESIController::handleFlushLineRequest(MemEvent * event, CacheLine*
                     debug->fatal(CALL_INFO, -1, "%s, Error: Handling not implemented because state not expected: noninclusive cache, state = %s, request = %s. Time = %" PRIu64 " ns\n",
                             parent->getName().c_str(), StateString[state], event->getVerboseString().c_str(), getCurrentSimTimeNano());
                 } else {
-                    cacheLine->addSharer(reqEvent->getSrc());
+                    cacheLine->addSharer(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, cacheLine->getData(), (event->getDirty()), cacheLine->getTimestamp());
                     cacheLine->setTimestamp(sendTime);
                     (state == M_InvX || event->getDirty()) ? cacheLine->setState(M) : cacheLine->setState(E);
@@ -638,11 +638,11 @@ CacheAction MESIController::handleFlushLineInvRequest(MemEvent * event, CacheLin
     // Apply incoming flush -> remove if sharer/owner & update data if dirty
     
     if (cacheLine) {
-        if (cacheLine->isSharer(event->getSrc())) {
-            cacheLine->removeSharer(event->getSrc());
+        if (cacheLine->isSharer(event->getSrcID())) {
+            cacheLine->removeSharer(event->getSrcID());
             if (mshr_->getAcksNeeded(event->getBaseAddr()) > 0) mshr_->decrementAcksNeeded(event->getBaseAddr());
         }
-        if (cacheLine->getOwner() == event->getSrc()) {
+        if (cacheLine->getOwner() == event->getSrcID()) {
             cacheLine->clearOwner();
             if (mshr_->getAcksNeeded(event->getBaseAddr()) > 0) mshr_->decrementAcksNeeded(event->getBaseAddr());
         }
@@ -665,33 +665,33 @@ CacheAction MESIController::handleFlushLineInvRequest(MemEvent * event, CacheLin
             break;
         case S:
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(S_Inv);
                 return STALL;
             }
             break;
         case E:
             if (cacheLine->ownerExists()) {
-                sendFetchInv(cacheLine, event->getRqstr(), replay);
+                sendFetchInv(cacheLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 cacheLine->setState(E_Inv);
                 return STALL;
             }
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(E_Inv);
                 return STALL;
             }
             break;
         case M:
             if (cacheLine->ownerExists()) {
-                sendFetchInv(cacheLine, event->getRqstr(), replay);
+                sendFetchInv(cacheLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 cacheLine->setState(M_Inv);
                 return STALL;
             }
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(M_Inv);
                 return STALL;
             }
@@ -719,7 +719,7 @@ CacheAction MESIController::handleFlushLineInvRequest(MemEvent * event, CacheLin
             if (mshr_->getAcksNeeded(event->getBaseAddr()) == 0) {
                 if (reqEvent->getCmd() == Command::Inv) {
                     if (cacheLine->numSharers() > 0) {  // May not have invalidated GetX requestor -> cannot also be the FlushLine requestor since that one is in I and blocked on flush
-                        invalidateAllSharers(cacheLine, reqEvent->getRqstr(), true);
+                        invalidateAllSharers(cacheLine, reqEvent->getRqstrID(), true);
                         return STALL;
                     } else {
                         sendAckInv(reqEvent);
@@ -759,8 +759,8 @@ CacheAction MESIController::handleFlushLineInvRequest(MemEvent * event, CacheLin
                     cacheLine->setState(I);
                     return DONE;
                 } else if (reqEvent->getCmd() == Command::GetX || reqEvent->getCmd() == Command::GetSX) {
-                    cacheLine->setOwner(reqEvent->getSrc());
-                    if (cacheLine->isSharer(reqEvent->getSrc())) cacheLine->removeSharer(reqEvent->getSrc());
+                    cacheLine->setOwner(reqEvent->getSrcID());
+                    if (cacheLine->isSharer(reqEvent->getSrcID())) cacheLine->removeSharer(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, cacheLine->getData(), true, cacheLine->getTimestamp());
                     cacheLine->setTimestamp(sendTime);
                     cacheLine->setState(M);
@@ -795,17 +795,17 @@ CacheAction MESIController::handleFlushLineInvRequest(MemEvent * event, CacheLin
                     else cacheLine->setState(E);
                     return handleFlushLineRequest(reqEvent, cacheLine, NULL, true);
                 } else if (!inclusive_) { // cmd = GetS; need to forward dirty/M so we don't lose that info
-                    cacheLine->setOwner(reqEvent->getSrc());
+                    cacheLine->setOwner(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, Command::GetXResp, cacheLine->getData(), (state == M_InvX || event->getDirty()), true, cacheLine->getTimestamp());
                     cacheLine->setTimestamp(sendTime);
                     (state == M_InvX || event->getDirty()) ? cacheLine->setState(M) : cacheLine->setState(E);
                 } else if (protocol_) { // MESI, fwd exclusive since now no other owner
-                    cacheLine->setOwner(reqEvent->getSrc());
+                    cacheLine->setOwner(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, Command::GetXResp, cacheLine->getData(), true, cacheLine->getTimestamp());
                     cacheLine->setTimestamp(sendTime);
                     (state == M_InvX || event->getDirty()) ? cacheLine->setState(M) : cacheLine->setState(E);
                 } else {
-                    cacheLine->addSharer(reqEvent->getSrc());
+                    cacheLine->addSharer(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, cacheLine->getData(), true, cacheLine->getTimestamp());
                     cacheLine->setTimestamp(sendTime);
                     (state == M_InvX || event->getDirty()) ? cacheLine->setState(M) : cacheLine->setState(E);
@@ -869,8 +869,8 @@ CacheAction MESIController::handlePutSRequest(MemEvent* event, CacheLine* line,
     } 
     if (mshr_->getAcksNeeded(event->getBaseAddr()) > 0) mshr_->decrementAcksNeeded(event->getBaseAddr());
 
-    if (line->isSharer(event->getSrc())) {
-        line->removeSharer(event->getSrc());
+    if (line->isSharer(event->getSrcID())) {
+        line->removeSharer(event->getSrcID());
     }
     
     bool retry = (mshr_->getAcksNeeded(event->getBaseAddr()) == 0);
@@ -945,8 +945,8 @@ CacheAction MESIController::handlePutSRequest(MemEvent* event, CacheLine* line,
                 sendResponseDown(reqEvent, line, true, true);
                 line->setState(I);
             } else if (reqEvent->getCmd() == Command::GetX || reqEvent->getCmd() == Command::GetSX) {
-                line->setOwner(reqEvent->getSrc());
-                if (line->isSharer(reqEvent->getSrc())) line->removeSharer(reqEvent->getSrc());
+                line->setOwner(reqEvent->getSrcID());
+                if (line->isSharer(reqEvent->getSrcID())) line->removeSharer(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, line->getData(), true, line->getTimestamp());
                 line->setTimestamp(sendTime);
                 line->setState(M);
@@ -964,7 +964,7 @@ CacheAction MESIController::handlePutSRequest(MemEvent* event, CacheLine* line,
         case SM_Inv:
             if (reqEvent->getCmd() == Command::Inv) {
                 if (line->numSharers() > 0) { // Possible that GetX requestor was never invalidated
-                    invalidateAllSharers(line, reqEvent->getRqstr(), true);
+                    invalidateAllSharers(line, reqEvent->getRqstrID(), true);
                     return IGNORE;
                 } else {
                     sendAckInv(reqEvent);
@@ -1071,7 +1071,7 @@ CacheAction MESIController::handlePutMRequest(MemEvent* event, CacheLine* cacheL
             } else {
                 cacheLine->setState(M);
                 notifyListenerOfAccess(reqEvent, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                cacheLine->setOwner(reqEvent->getSrc());
+                cacheLine->setOwner(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, cacheLine->getData(), true, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
             
@@ -1092,15 +1092,15 @@ CacheAction MESIController::handlePutMRequest(MemEvent* event, CacheLine* cacheL
             } else if (!inclusive_) { // Race with GetS
                 sendTime = sendResponseUp(reqEvent, Command::GetXResp, cacheLine->getData(), (cacheLine->getState() == M), true, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
-                cacheLine->setOwner(reqEvent->getSrc());
+                cacheLine->setOwner(reqEvent->getSrcID());
             } else if (protocol_) {
                 if (is_debug_addr(cacheLine->getBaseAddr())) debug->debug(_L7_, "New owner: %s\n", reqEvent->getSrc().c_str());
                 
-                cacheLine->setOwner(reqEvent->getSrc());
+                cacheLine->setOwner(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, Command::GetXResp, cacheLine->getData(), true, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
             } else {
-                cacheLine->addSharer(reqEvent->getSrc());
+                cacheLine->addSharer(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, cacheLine->getData(), true, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
             }
@@ -1134,7 +1134,7 @@ CacheAction MESIController::handleInv(MemEvent* event, CacheLine* cacheLine, boo
         case S_B:
         case S:
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 if (state == S) cacheLine->setState(S_Inv);
                 else cacheLine->setState(SB_Inv);
                 return STALL;
@@ -1145,7 +1145,7 @@ CacheAction MESIController::handleInv(MemEvent* event, CacheLine* cacheLine, boo
             return DONE;
         case SM:
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(SM_Inv);
                 return STALL;
             }
@@ -1184,7 +1184,7 @@ CacheAction MESIController::handleForceInv(MemEvent * event, CacheLine * cacheLi
         case S_B:
         case S:
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 if (state == S) cacheLine->setState(S_Inv);
                 else cacheLine->setState(SB_Inv);
                 return STALL;
@@ -1195,7 +1195,7 @@ CacheAction MESIController::handleForceInv(MemEvent * event, CacheLine * cacheLi
             return DONE;
         case SM:
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(SM_Inv);
                 return STALL;
             }
@@ -1212,13 +1212,13 @@ CacheAction MESIController::handleForceInv(MemEvent * event, CacheLine * cacheLi
         case E:
         case M:
             if (cacheLine->ownerExists()) {
-                sendForceInv(cacheLine, event->getRqstr(), replay);
+                sendForceInv(cacheLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 cacheLine->setState(M_Inv);
                 return STALL;
             }
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(M_Inv);
                 return STALL;
             }
@@ -1263,14 +1263,14 @@ CacheAction MESIController::handleFetchInv(MemEvent * event, CacheLine * cacheLi
             return IGNORE;
         case S: // Happens when there is a non-inclusive cache below us
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(S_Inv);
                 return STALL;
             }
             break;
         case S_B:
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(SB_Inv);
                 return STALL;
             }
@@ -1279,7 +1279,7 @@ CacheAction MESIController::handleFetchInv(MemEvent * event, CacheLine * cacheLi
             return DONE;
         case SM:
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(SM_Inv);
                 return STALL;
             }
@@ -1288,26 +1288,26 @@ CacheAction MESIController::handleFetchInv(MemEvent * event, CacheLine * cacheLi
             return DONE;
         case E:
             if (cacheLine->ownerExists()) {
-                sendFetchInv(cacheLine, event->getRqstr(), replay);
+                sendFetchInv(cacheLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 cacheLine->setState(E_Inv);
                 return STALL;
             }
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(E_Inv);
                 return STALL;
             }
             break;
         case M:
             if (cacheLine->ownerExists()) {
-                sendFetchInv(cacheLine, event->getRqstr(), replay);
+                sendFetchInv(cacheLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 cacheLine->setState(M_Inv);
                 return STALL;
             }
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(M_Inv);
                 return STALL;
             }
@@ -1357,7 +1357,7 @@ CacheAction MESIController::handleFetchInvX(MemEvent * event, CacheLine * cacheL
             return IGNORE;
         case E:
             if (cacheLine->ownerExists()) {
-                sendFetchInvX(cacheLine, event->getRqstr(), replay);
+                sendFetchInvX(cacheLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 cacheLine->setState(E_InvX);
                 return STALL;
@@ -1365,7 +1365,7 @@ CacheAction MESIController::handleFetchInvX(MemEvent * event, CacheLine * cacheL
             break;
         case M:
             if (cacheLine->ownerExists()) {
-                sendFetchInvX(cacheLine, event->getRqstr(), replay);
+                sendFetchInvX(cacheLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 cacheLine->setState(M_InvX);
                 return STALL;
@@ -1440,7 +1440,7 @@ CacheAction MESIController::handleDataResponse(MemEvent* responseEvent, CacheLin
     State state = cacheLine->getState();
     recordStateEventCount(responseEvent->getCmd(), state);
     
-    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstr() == parent->getName()));
+    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstrID() == parentID_));
     
     uint64_t sendTime = 0;
     
@@ -1457,13 +1457,13 @@ CacheAction MESIController::handleDataResponse(MemEvent* responseEvent, CacheLin
             if (!shouldRespond) return DONE;
             
             if (!inclusive_ && cacheLine->getState() != S) { // Transfer E/M permission
-                cacheLine->setOwner(origRequest->getSrc());
+                cacheLine->setOwner(origRequest->getSrcID());
                 sendTime = sendResponseUp(origRequest, Command::GetXResp, &responseEvent->getPayload(), state == M, true, cacheLine->getTimestamp());
             } else if (protocol_ && cacheLine->getState() != S) { // Send exclusive response
-                cacheLine->setOwner(origRequest->getSrc());
+                cacheLine->setOwner(origRequest->getSrcID());
                 sendTime = sendResponseUp(origRequest, Command::GetXResp, &responseEvent->getPayload(), true, cacheLine->getTimestamp());
             } else { // Default shared response
-                cacheLine->addSharer(origRequest->getSrc());
+                cacheLine->addSharer(origRequest->getSrcID());
                 sendTime = sendResponseUp(origRequest, &responseEvent->getPayload(), true, cacheLine->getTimestamp());
             }
 
@@ -1478,8 +1478,8 @@ CacheAction MESIController::handleDataResponse(MemEvent* responseEvent, CacheLin
             if (is_debug_event(responseEvent)) printData(cacheLine->getData(), true);
         case SM:
             cacheLine->setState(M);
-            cacheLine->setOwner(origRequest->getSrc());
-            if (cacheLine->isSharer(origRequest->getSrc())) cacheLine->removeSharer(origRequest->getSrc());
+            cacheLine->setOwner(origRequest->getSrcID());
+            if (cacheLine->isSharer(origRequest->getSrcID())) cacheLine->removeSharer(origRequest->getSrcID());
             notifyListenerOfAccess(origRequest, NotifyAccessType::WRITE, NotifyResultType::HIT);
             sendTime = sendResponseUp(origRequest, cacheLine->getData(), true, cacheLine->getTimestamp());
             cacheLine->setTimestamp(sendTime);
@@ -1541,7 +1541,7 @@ CacheAction MESIController::handleFetchResp(MemEvent * responseEvent, CacheLine*
             break;
         case E_InvX:
             cacheLine->clearOwner();
-            cacheLine->addSharer(responseEvent->getSrc());
+            cacheLine->addSharer(responseEvent->getSrcID());
             if (reqEvent->getCmd() == Command::FetchInvX) {
                 sendResponseDownFromMSHR(responseEvent, reqEvent, responseEvent->getDirty());
                 cacheLine->setState(S);
@@ -1559,7 +1559,7 @@ CacheAction MESIController::handleFetchResp(MemEvent * responseEvent, CacheLine*
                     cacheLine->setData(responseEvent->getPayload(), 0);
                 }
                 if (cacheLine->numSharers() > 0) {
-                    invalidateAllSharers(cacheLine, reqEvent->getRqstr(), true);
+                    invalidateAllSharers(cacheLine, reqEvent->getRqstrID(), true);
                     responseEvent->getDirty() ? cacheLine->setState(M_Inv) : cacheLine->setState(E_Inv);
                     return STALL;
                 }
@@ -1568,7 +1568,7 @@ CacheAction MESIController::handleFetchResp(MemEvent * responseEvent, CacheLine*
                 break;
             } else {
                 notifyListenerOfAccess(reqEvent, NotifyAccessType::READ, NotifyResultType::HIT);
-                cacheLine->addSharer(reqEvent->getSrc());
+                cacheLine->addSharer(reqEvent->getSrcID());
                 if (responseEvent->getDirty()) {
                     cacheLine->setState(M);
                     cacheLine->setData(responseEvent->getPayload(), 0);
@@ -1580,8 +1580,8 @@ CacheAction MESIController::handleFetchResp(MemEvent * responseEvent, CacheLine*
         case E_Inv:
             if (reqEvent->getCmd() == Command::FlushLineInv) {
                 
-                if (cacheLine->isSharer(responseEvent->getSrc())) cacheLine->removeSharer(responseEvent->getSrc());
-                if (cacheLine->getOwner() == responseEvent->getSrc()) cacheLine->clearOwner();
+                if (cacheLine->isSharer(responseEvent->getSrcID())) cacheLine->removeSharer(responseEvent->getSrcID());
+                if (cacheLine->getOwner() == responseEvent->getSrcID()) cacheLine->clearOwner();
                 if (responseEvent->getDirty()) {
                     cacheLine->setState(M);
                     cacheLine->setData(responseEvent->getPayload(), 0);
@@ -1593,14 +1593,14 @@ CacheAction MESIController::handleFetchResp(MemEvent * responseEvent, CacheLine*
                 action = handleFlushLineInvRequest(reqEvent, cacheLine, NULL, true);
                 break;
             }
-            if (cacheLine->isSharer(responseEvent->getSrc())) cacheLine->removeSharer(responseEvent->getSrc());
-            if (cacheLine->getOwner() == responseEvent->getSrc()) cacheLine->clearOwner();
+            if (cacheLine->isSharer(responseEvent->getSrcID())) cacheLine->removeSharer(responseEvent->getSrcID());
+            if (cacheLine->getOwner() == responseEvent->getSrcID()) cacheLine->clearOwner();
             sendResponseDown(reqEvent, cacheLine, responseEvent->getDirty(), true);
             cacheLine->setState(I);
             break;
         case M_InvX:
             cacheLine->clearOwner();
-            cacheLine->addSharer(responseEvent->getSrc());
+            cacheLine->addSharer(responseEvent->getSrcID());
             if (reqEvent->getCmd() == Command::FetchInvX) {
                 sendResponseDown(reqEvent, cacheLine, true, true);
                 cacheLine->setState(S);
@@ -1618,7 +1618,7 @@ CacheAction MESIController::handleFetchResp(MemEvent * responseEvent, CacheLine*
                     cacheLine->setData(responseEvent->getPayload(), 0);
                 }
                 if (cacheLine->numSharers() > 0) {
-                    invalidateAllSharers(cacheLine, reqEvent->getRqstr(), true);
+                    invalidateAllSharers(cacheLine, reqEvent->getRqstrID(), true);
                     cacheLine->setState(M_Inv);
                     return STALL;
                 }
@@ -1627,7 +1627,7 @@ CacheAction MESIController::handleFetchResp(MemEvent * responseEvent, CacheLine*
                 break;
             } else {    // reqEvent->getCmd() == GetS
                 notifyListenerOfAccess(reqEvent, NotifyAccessType::READ, NotifyResultType::HIT);
-                cacheLine->addSharer(reqEvent->getSrc());
+                cacheLine->addSharer(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, cacheLine->getData(), true, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
                 cacheLine->setState(M);
@@ -1636,7 +1636,7 @@ CacheAction MESIController::handleFetchResp(MemEvent * responseEvent, CacheLine*
         case M_Inv:
             cacheLine->clearOwner();
             if (reqEvent->getCmd() == Command::FlushLineInv) {
-                if (cacheLine->getOwner() == responseEvent->getSrc()) cacheLine->clearOwner();
+                if (cacheLine->getOwner() == responseEvent->getSrcID()) cacheLine->clearOwner();
                 if (responseEvent->getDirty()) cacheLine->setData(responseEvent->getPayload(), 0);
                 cacheLine->setState(M);
                 if (action != DONE) { // Sanity check...
@@ -1650,8 +1650,8 @@ CacheAction MESIController::handleFetchResp(MemEvent * responseEvent, CacheLine*
                 cacheLine->setState(I);
             } else {    // reqEvent->getCmd() == GetX
                 notifyListenerOfAccess(reqEvent, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                cacheLine->setOwner(reqEvent->getSrc());
-                if (cacheLine->isSharer(reqEvent->getSrc())) cacheLine->removeSharer(reqEvent->getSrc());
+                cacheLine->setOwner(reqEvent->getSrcID());
+                if (cacheLine->isSharer(reqEvent->getSrcID())) cacheLine->removeSharer(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, cacheLine->getData(), true, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
                 
@@ -1676,10 +1676,10 @@ CacheAction MESIController::handleAckInv(MemEvent * ack, CacheLine * line, MemEv
     
     recordStateEventCount(ack->getCmd(), state);
 
-    if (line && line->isSharer(ack->getSrc())) {
-        line->removeSharer(ack->getSrc());
+    if (line && line->isSharer(ack->getSrcID())) {
+        line->removeSharer(ack->getSrcID());
     }
-    if (line && line->getOwner() == ack->getSrc()) {
+    if (line && line->getOwner() == ack->getSrcID()) {
         line->clearOwner();
     }
     
@@ -1717,7 +1717,7 @@ CacheAction MESIController::handleAckInv(MemEvent * ack, CacheLine * line, MemEv
             if (action == DONE) {
                 if (reqEvent->getCmd() == Command::Inv || reqEvent->getCmd() == Command::ForceInv) {
                     if (line->numSharers() > 0) { // May not have invalidated GetX requestor
-                        invalidateAllSharers(line, reqEvent->getRqstr(), true);
+                        invalidateAllSharers(line, reqEvent->getRqstrID(), true);
                         return IGNORE;
                     } else {
                         sendAckInv(reqEvent);
@@ -1735,7 +1735,7 @@ CacheAction MESIController::handleAckInv(MemEvent * ack, CacheLine * line, MemEv
         case SB_Inv:
             if (action == DONE) {
                 if (line->numSharers() > 0) {
-                    invalidateAllSharers(line, reqEvent->getRqstr(), true);
+                    invalidateAllSharers(line, reqEvent->getRqstrID(), true);
                     return IGNORE;
                 }
                 sendAckInv(ack);
@@ -1790,8 +1790,8 @@ CacheAction MESIController::handleAckInv(MemEvent * ack, CacheLine * line, MemEv
                     line->setState(I);  
                 } else { // reqEvent->getCmd() == GetX/GetSX
                     notifyListenerOfAccess(reqEvent, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                    line->setOwner(reqEvent->getSrc());
-                    if (line->isSharer(reqEvent->getSrc())) line->removeSharer(reqEvent->getSrc());
+                    line->setOwner(reqEvent->getSrcID());
+                    if (line->isSharer(reqEvent->getSrcID())) line->removeSharer(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, line->getData(), true, line->getTimestamp());
                     line->setTimestamp(sendTime);
                     
@@ -1828,13 +1828,13 @@ CacheAction MESIController::handleAckInv(MemEvent * ack, CacheLine * line, MemEv
 /**
  *  Send an Inv to all sharers of the block. Used for evictions or Inv/FetchInv requests from lower level caches
  */
-void MESIController::invalidateAllSharers(CacheLine * cacheLine, string rqstr, bool replay) {
-    set<std::string> * sharers = cacheLine->getSharers();
+void MESIController::invalidateAllSharers(CacheLine * cacheLine, EndpointID rqstr, bool replay) {
+    SharerList sharers = cacheLine->getSharers();
     uint64_t deliveryTime = 0;
-    for (set<std::string>::iterator it = sharers->begin(); it != sharers->end(); it++) {
+    for (SharerIterator it = sharers.begin(); it != sharers.end(); it++) {
         MemEvent * inv = new MemEvent(parent, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Command::Inv);
-        inv->setDst(*it);
-        inv->setRqstr(rqstr);
+        inv->setDstID(*it);
+        inv->setRqstrID(rqstr);
         inv->setSize(cacheLine->getSize());
     
         uint64_t baseTime = timestamp_ > cacheLine->getTimestamp() ? timestamp_ : cacheLine->getTimestamp();
@@ -1846,7 +1846,7 @@ void MESIController::invalidateAllSharers(CacheLine * cacheLine, string rqstr, b
 
         if (is_debug_addr(cacheLine->getBaseAddr())) {
             debug->debug(_L7_,"Sending inv: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-                    cacheLine->getBaseAddr(), (*it).c_str(), deliveryTime);
+                    cacheLine->getBaseAddr(), EndpointRegistry::getName(*it).c_str(), deliveryTime);
         }
     }
     if (deliveryTime != 0) cacheLine->setTimestamp(deliveryTime);
@@ -1857,16 +1857,16 @@ void MESIController::invalidateAllSharers(CacheLine * cacheLine, string rqstr, b
  *  Send an Inv to all sharers unless the cache requesting exclusive permission is a sharer; then send Inv to all sharers except requestor. 
  *  Used for GetX/GetSX requests.
  */
-bool MESIController::invalidateSharersExceptRequestor(CacheLine * cacheLine, string rqstr, string origRqstr, bool replay) {
+bool MESIController::invalidateSharersExceptRequestor(CacheLine * cacheLine, EndpointID rqstr, EndpointID origRqstr, bool replay) {
     bool sentInv = false;
-    set<std::string> * sharers = cacheLine->getSharers();
+    SharerList sharers = cacheLine->getSharers();
     uint64_t deliveryTime = 0;
-    for (set<std::string>::iterator it = sharers->begin(); it != sharers->end(); it++) {
+    for (SharerIterator it = sharers.begin(); it != sharers.end(); it++) {
         if (*it == rqstr) continue;
 
         MemEvent * inv = new MemEvent(parent, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Command::Inv);
-        inv->setDst(*it);
-        inv->setRqstr(origRqstr);
+        inv->setDstID(*it);
+        inv->setRqstrID(origRqstr);
         inv->setSize(cacheLine->getSize());
 
         uint64_t baseTime = timestamp_ > cacheLine->getTimestamp() ? timestamp_ : cacheLine->getTimestamp();
@@ -1879,7 +1879,7 @@ bool MESIController::invalidateSharersExceptRequestor(CacheLine * cacheLine, str
         
         if (is_debug_addr(cacheLine->getBaseAddr())) {
             debug->debug(_L7_,"Sending inv: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-                    cacheLine->getBaseAddr(), (*it).c_str(), deliveryTime);
+                    cacheLine->getBaseAddr(), EndpointRegistry::getName(*it).c_str(), deliveryTime);
         }
     }
     if (deliveryTime != 0) cacheLine->setTimestamp(deliveryTime);
@@ -1890,10 +1890,10 @@ bool MESIController::invalidateSharersExceptRequestor(CacheLine * cacheLine, str
 /**
  *  Send FetchInv to owner of a block
  */
-void MESIController::sendFetchInv(CacheLine * cacheLine, string rqstr, bool replay) {
+void MESIController::sendFetchInv(CacheLine * cacheLine, EndpointID rqstr, bool replay) {
     MemEvent * fetch = new MemEvent(parent, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Command::FetchInv);
-    fetch->setDst(cacheLine->getOwner());
-    fetch->setRqstr(rqstr);
+    fetch->setDstID(cacheLine->getOwner());
+    fetch->setRqstrID(rqstr);
     fetch->setSize(cacheLine->getSize());
     
     uint64_t baseTime = timestamp_ > cacheLine->getTimestamp() ? timestamp_ : cacheLine->getTimestamp();
@@ -1904,7 +1904,7 @@ void MESIController::sendFetchInv(CacheLine * cacheLine, string rqstr, bool repl
    
     if (is_debug_addr(cacheLine->getBaseAddr())) {
         debug->debug(_L7_, "Sending FetchInv: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-                cacheLine->getBaseAddr(), cacheLine->getOwner().c_str(), deliveryTime);
+                cacheLine->getBaseAddr(), EndpointRegistry::getName(cacheLine->getOwner()).c_str(), deliveryTime);
     }
 }
 
@@ -1912,10 +1912,10 @@ void MESIController::sendFetchInv(CacheLine * cacheLine, string rqstr, bool repl
 /** 
  *  Send FetchInv to owner of a block
  */
-void MESIController::sendFetchInvX(CacheLine * cacheLine, string rqstr, bool replay) {
+void MESIController::sendFetchInvX(CacheLine * cacheLine, EndpointID rqstr, bool replay) {
     MemEvent * fetch = new MemEvent(parent, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Command::FetchInvX);
-    fetch->setDst(cacheLine->getOwner());
-    fetch->setRqstr(rqstr);
+    fetch->setDstID(cacheLine->getOwner());
+    fetch->setRqstrID(rqstr);
     fetch->setSize(cacheLine->getSize());
 
     uint64_t baseTime = timestamp_ > cacheLine->getTimestamp() ? timestamp_ : cacheLine->getTimestamp();
@@ -1926,7 +1926,7 @@ void MESIController::sendFetchInvX(CacheLine * cacheLine, string rqstr, bool rep
     
     if (is_debug_addr(cacheLine->getBaseAddr())) {
         debug->debug(_L7_, "Sending FetchInvX: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-                cacheLine->getBaseAddr(), cacheLine->getOwner().c_str(), deliveryTime);
+                cacheLine->getBaseAddr(), EndpointRegistry::getName(cacheLine->getOwner()).c_str(), deliveryTime);
     }
 }
 
@@ -1934,10 +1934,10 @@ void MESIController::sendFetchInvX(CacheLine * cacheLine, string rqstr, bool rep
 /**
  *  Send ForceInv to block owner
  */
-void MESIController::sendForceInv(CacheLine * cacheLine, string rqstr, bool replay) {
+void MESIController::sendForceInv(CacheLine * cacheLine, EndpointID rqstr, bool replay) {
     MemEvent * inv = new MemEvent(parent, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Command::ForceInv);
-    inv->setDst(cacheLine->getOwner());
-    inv->setRqstr(rqstr);
+    inv->setDstID(cacheLine->getOwner());
+    inv->setRqstrID(rqstr);
     inv->setSize(cacheLine->getSize());
 
     uint64_t baseTime = timestamp_ > cacheLine->getTimestamp() ? timestamp_ : cacheLine->getTimestamp();
@@ -1948,7 +1948,7 @@ void MESIController::sendForceInv(CacheLine * cacheLine, string rqstr, bool repl
     
     if (is_debug_addr(cacheLine->getBaseAddr())) {
         debug->debug(_L7_, "Sending ForceInv: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-                cacheLine->getBaseAddr(), cacheLine->getOwner().c_str(), deliveryTime);
+                cacheLine->getBaseAddr(), EndpointRegistry::getName(cacheLine->getOwner()).c_str(), deliveryTime);
     }
 }
 
@@ -1959,8 +1959,8 @@ void MESIController::sendForceInv(CacheLine * cacheLine, string rqstr, bool repl
  */
 void MESIController::forwardMessageUp(MemEvent* event) {
     MemEvent * forwardEvent = new MemEvent(*event);
-    forwardEvent->setSrc(parent->getName());
-    forwardEvent->setDst(getSrc());
+    forwardEvent->setSrcID(parentID_);
+    forwardEvent->setDstID(getSrcID());
     
     uint64_t deliveryTime = timestamp_ + tagLatency_;
     Response fwdReq = {forwardEvent, deliveryTime, packetHeaderBytes + forwardEvent->getPayloadSize()};
@@ -2050,8 +2050,8 @@ void MESIController::sendWriteback(Command cmd, CacheLine* cacheLine, bool dirty
  */
 void MESIController::sendWritebackAck(MemEvent * event) {
     MemEvent * ack = new MemEvent(parent, event->getBaseAddr(), event->getBaseAddr(), Command::AckPut);
-    ack->setDst(event->getSrc());
-    ack->setRqstr(event->getSrc());
+    ack->setDstID(event->getSrcID());
+    ack->setRqstrID(event->getSrcID());
     ack->setSize(event->getSize());
 
     uint64_t deliveryTime = timestamp_ + tagLatency_;
@@ -2114,7 +2114,7 @@ void MESIController::forwardFlushLine(Addr baseAddr, string origRqstr, CacheLine
 void MESIController::sendFlushResponse(MemEvent * requestEvent, bool success) {
     MemEvent * flushResponse = requestEvent->makeResponse();
     flushResponse->setSuccess(success);
-    flushResponse->setDst(requestEvent->getSrc());
+    flushResponse->setDstID(requestEvent->getSrcID());
 
     uint64_t deliveryTime = timestamp_ + mshrLatency_;
     Response resp = {flushResponse, deliveryTime, packetHeaderBytes};
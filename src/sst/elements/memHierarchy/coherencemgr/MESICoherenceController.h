@@ -751,18 +751,18 @@ private:
     void sendAckInv(MemEvent * event);
 
     /** Fetch data from owner and invalidate their copy of the line */
-    void sendFetchInv(CacheLine * cacheLine, string rqstr, bool replay);
+    void sendFetchInv(CacheLine * cacheLine, EndpointID rqstr, bool replay);
     
     /** Fetch data from owner and downgrade owner to sharer */
-    void sendFetchInvX(CacheLine * cacheLine, string rqstr, bool replay);
+    void sendFetchInvX(CacheLine * cacheLine, EndpointID rqstr, bool replay);
 
     /** Force invalidation of line from owner, do not request data */
-    void sendForceInv(CacheLine * cacheLine, string rqstr, bool replay);
+    void sendForceInv(CacheLine * cacheLine, EndpointID rqstr, bool replay);
     /** Invalidate all sharers of a block. Used for invalidations and evictions */
-    void invalidateAllSharers(CacheLine * cacheLine, string rqstr, bool replay);
+    void invalidateAllSharers(CacheLine * cacheLine, EndpointID rqstr, bool replay);
     
     /** Invalidate all sharers of a block except the requestor (rqstr). Used for upgrade requests. */
-    bool invalidateSharersExceptRequestor(CacheLine * cacheLine, string rqstr, string origRqstr, bool replay);
+    bool invalidateSharersExceptRequestor(CacheLine * cacheLine, EndpointID rqstr, EndpointID origRqstr, bool replay);
     
     /** Send a flush response */
     void sendFlushResponse(MemEvent * reqEent, bool success);
@@ -60,7 +60,7 @@ CacheAction MESIInternalDirectory::handleEviction(CacheLine* replacementLine, st
     bool collision = (waitingEvent != NULL && (waitingEvent->getCmd() == Command::PutS || waitingEvent->getCmd() == Command::PutE || waitingEvent->getCmd() == Command::PutM));
     if (collision) {    // Note that 'collision' and 'fromDataCache' cannot both be true, don't need to handle that case
         if (state == E && waitingEvent->getDirty()) replacementLine->setState(M);
-        if (replacementLine->isSharer(waitingEvent->getSrc())) replacementLine->removeSharer(waitingEvent->getSrc());
+        if (replacementLine->isSharer(waitingEvent->getSrcID())) replacementLine->removeSharer(waitingEvent->getSrcID());
         else if (replacementLine->ownerExists()) replacementLine->clearOwner();
         mshr_->setDataBuffer(waitingEvent->getBaseAddr(), waitingEvent->getPayload());
         mshr_->removeFront(waitingEvent->getBaseAddr());
@@ -71,8 +71,8 @@ CacheAction MESIInternalDirectory::handleEviction(CacheLine* replacementLine, st
             return DONE;
         case S:
             if (replacementLine->numSharers() > 0 && !fromDataCache) {
-                if (isCached || collision) invalidateAllSharers(replacementLine, parent->getName(), false);
-                else invalidateAllSharersAndFetch(replacementLine, parent->getName(), false);    // Fetch needed for PutS
+                if (isCached || collision) invalidateAllSharers(replacementLine, parentID_, false);
+                else invalidateAllSharersAndFetch(replacementLine, parentID_, false);    // Fetch needed for PutS
                 replacementLine->setState(SI);
                 return STALL;
             }
@@ -85,12 +85,12 @@ CacheAction MESIInternalDirectory::handleEviction(CacheLine* replacementLine, st
             return DONE;
         case E:
             if (replacementLine->numSharers() > 0 && !fromDataCache) { // May or may not be cached
-                if (isCached || collision) invalidateAllSharers(replacementLine, parent->getName(), false);
-                else invalidateAllSharersAndFetch(replacementLine, parent->getName(), false);
+                if (isCached || collision) invalidateAllSharers(replacementLine, parentID_, false);
+                else invalidateAllSharersAndFetch(replacementLine, parentID_, false);
                 replacementLine->setState(EI);
                 return STALL;
             } else if (replacementLine->ownerExists() && !fromDataCache) { // Not cached
-                sendFetchInv(replacementLine, parent->getName(), false);
+                sendFetchInv(replacementLine, parentID_, false);
                 mshr_->incrementAcksNeeded(wbBaseAddr);
                 replacementLine->setState(EI);
                 return STALL;
@@ -106,12 +106,12 @@ CacheAction MESIInternalDirectory::handleEviction(CacheLine* replacementLine, st
             }
         case M:
             if (replacementLine->numSharers() > 0 && !fromDataCache) {
-                if (isCached || collision) invalidateAllSharers(replacementLine, parent->getName(), false);
-                else invalidateAllSharersAndFetch(replacementLine, parent->getName(), false);
+                if (isCached || collision) invalidateAllSharers(replacementLine, parentID_, false);
+                else invalidateAllSharersAndFetch(replacementLine, parentID_, false);
                 replacementLine->setState(MI);
                 return STALL;
             } else if (replacementLine->ownerExists() && !fromDataCache) {
-                sendFetchInv(replacementLine, parent->getName(), false);
+                sendFetchInv(replacementLine, parentID_, false);
                 mshr_->incrementAcksNeeded(wbBaseAddr);
                 replacementLine->setState(MI);
                 return STALL;
@@ -277,16 +277,16 @@ bool MESIInternalDirectory::isRetryNeeded(MemEvent * event, CacheLine * dirLine)
             return true;
         case Command::FetchInvX:
             if (state == I) return false;
-            if (dirLine->getOwner() != event->getDst()) return false;
+            if (dirLine->getOwner() != event->getDstID()) return false;
             return true;
         case Command::FetchInv:
             if (state == I) return false;
-            if ((dirLine->getOwner() != event->getDst()) && !dirLine->isSharer(event->getDst())) return false;
+            if ((dirLine->getOwner() != event->getDstID()) && !dirLine->isSharer(event->getDstID())) return false;
             return true;
         case Command::Fetch:
         case Command::Inv:
             if (state == I) return false;
-            if (!dirLine->isSharer(event->getDst())) return false;
+            if (!dirLine->isSharer(event->getDstID())) return false;
             return true;
         default:
             debug->fatal(CALL_INFO, -1, "%s (dir), Error: Received NACK for unrecognized event: %s. Addr = 0x%" PRIx64 ", Src = %s. Time = %" PRIu64 "ns\n",
@@ -309,7 +309,7 @@ int MESIInternalDirectory::isCoherenceMiss(MemEvent* event, CacheLine* cacheLine
     if (cmd == Command::GetSX) cmd = Command::GetX;  // for our purposes these are equal
 
     if (state == I) return 1;
-    if (event->isPrefetch() && event->getRqstr() == parent->getName()) return 0;
+    if (event->isPrefetch() && event->getRqstrID() == parentID_) return 0;
     if (state == S && lastLevel_) state = M;
     switch (state) {
         case S:
@@ -320,7 +320,7 @@ int MESIInternalDirectory::isCoherenceMiss(MemEvent* event, CacheLine* cacheLine
             if (cacheLine->ownerExists()) return 3;
             if (cmd == Command::GetS) return 0; 
             if (cmd == Command::GetX) {
-                if (cacheLine->isShareless() || (cacheLine->isSharer(event->getSrc()) && cacheLine->numSharers() == 1)) return 0; // Hit
+                if (cacheLine->isShareless() || (cacheLine->isSharer(event->getSrcID()) && cacheLine->numSharers() == 1)) return 0; // Hit
             }
             return 3;
         case IS:
@@ -351,7 +351,7 @@ int MESIInternalDirectory::isCoherenceMiss(MemEvent* event, CacheLine* cacheLine
 CacheAction MESIInternalDirectory::handleGetSRequest(MemEvent* event, CacheLine* dirLine, bool replay) {
     State state = dirLine->getState();
     
-    bool shouldRespond = !(event->isPrefetch() && (event->getRqstr() == parent->getName()));
+    bool shouldRespond = !(event->isPrefetch() && (event->getRqstrID() == parentID_));
     recordStateEventCount(event->getCmd(), state);    
     bool isCached = dirLine->getDataLine() != NULL;
     uint64_t sendTime = 0;
@@ -366,12 +366,12 @@ CacheAction MESIInternalDirectory::handleGetSRequest(MemEvent* event, CacheLine*
             notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
             if (!shouldRespond) return DONE;
             if (isCached) {
-                dirLine->addSharer(event->getSrc());
+                dirLine->addSharer(event->getSrcID());
                 sendTime = sendResponseUp(event, dirLine->getDataLine()->getData(), replay, dirLine->getTimestamp());
                 dirLine->setTimestamp(sendTime);
                 return DONE;
             } 
-            sendFetch(dirLine, event->getRqstr(), replay);
+            sendFetch(dirLine, event->getRqstrID(), replay);
             mshr_->incrementAcksNeeded(event->getBaseAddr());
             dirLine->setState(S_D);     // Fetch in progress, block incoming invalidates/fetches/etc.
             return STALL;
@@ -380,7 +380,7 @@ CacheAction MESIInternalDirectory::handleGetSRequest(MemEvent* event, CacheLine*
             notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
             if (!shouldRespond) return DONE;
             if (dirLine->ownerExists()) {
-                sendFetchInvX(dirLine, event->getRqstr(), replay);
+                sendFetchInvX(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 if (state == E) dirLine->setState(E_InvX);
                 else dirLine->setState(M_InvX);
@@ -388,16 +388,16 @@ CacheAction MESIInternalDirectory::handleGetSRequest(MemEvent* event, CacheLine*
             } else if (isCached) {
                 if (protocol_ && dirLine->numSharers() == 0) {
                     sendTime = sendResponseUp(event, Command::GetXResp, dirLine->getDataLine()->getData(), replay, dirLine->getTimestamp());
-                    dirLine->setOwner(event->getSrc());
+                    dirLine->setOwner(event->getSrcID());
                     dirLine->setTimestamp(sendTime);
                 } else {
                     sendTime = sendResponseUp(event, dirLine->getDataLine()->getData(), replay, dirLine->getTimestamp());
-                    dirLine->addSharer(event->getSrc());
+                    dirLine->addSharer(event->getSrcID());
                     dirLine->setTimestamp(sendTime);
                 }
                 return DONE;
             } else {
-                sendFetch(dirLine, event->getRqstr(), replay);
+                sendFetch(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 if (state == E) dirLine->setState(E_D);
                 else dirLine->setState(M_D);
@@ -443,7 +443,7 @@ CacheAction MESIInternalDirectory::handleGetXRequest(MemEvent* event, CacheLine*
         case S:
             notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
             sendTime = forwardMessage(event, dirLine->getBaseAddr(), lineSize_, dirLine->getTimestamp(), &event->getPayload());
-            if (invalidateSharersExceptRequestor(dirLine, event->getSrc(), event->getRqstr(), replay, false)) {
+            if (invalidateSharersExceptRequestor(dirLine, event->getSrcID(), event->getRqstrID(), replay, false)) {
                 dirLine->setState(SM_Inv);
             } else {
                 dirLine->setState(SM);
@@ -455,18 +455,18 @@ CacheAction MESIInternalDirectory::handleGetXRequest(MemEvent* event, CacheLine*
         case M:
             notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
 
-            if (invalidateSharersExceptRequestor(dirLine, event->getSrc(), event->getRqstr(), replay, !isCached)) {
+            if (invalidateSharersExceptRequestor(dirLine, event->getSrcID(), event->getRqstrID(), replay, !isCached)) {
                 dirLine->setState(M_Inv);
                 return STALL;
             }
             if (dirLine->ownerExists()) {
-                sendFetchInv(dirLine, event->getRqstr(), replay);
+                sendFetchInv(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 dirLine->setState(M_Inv);
                 return STALL;
             }
-            dirLine->setOwner(event->getSrc());
-            if (dirLine->isSharer(event->getSrc())) dirLine->removeSharer(event->getSrc());
+            dirLine->setOwner(event->getSrcID());
+            if (dirLine->isSharer(event->getSrcID())) dirLine->removeSharer(event->getSrcID());
             if (isCached) sendTime = sendResponseUp(event, dirLine->getDataLine()->getData(), replay, dirLine->getTimestamp());  // is an upgrade request, requestor has data already
             else sendTime = sendResponseUp(event, NULL, replay, dirLine->getTimestamp());
             dirLine->setTimestamp(sendTime);
@@ -490,13 +490,13 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
     recordStateEventCount(event->getCmd(), state);
 
     if (state == S_D || state == E_D || state == SM_D || state == M_D) {
-        if (*(dirLine->getSharers()->begin()) == event->getSrc()) {    // Put raced with Fetch
+        if (*(dirLine->getSharers().begin()) == event->getSrcID()) {    // Put raced with Fetch
             mshr_->decrementAcksNeeded(event->getBaseAddr());
         }
     } else if (mshr_->getAcksNeeded(event->getBaseAddr()) > 0) mshr_->decrementAcksNeeded(event->getBaseAddr());
 
-    if (dirLine->isSharer(event->getSrc())) {
-        dirLine->removeSharer(event->getSrc());
+    if (dirLine->isSharer(event->getSrcID())) {
+        dirLine->removeSharer(event->getSrcID());
     }
     // Set data, either to cache or to MSHR
     if (dirLine->getDataLine() != NULL) {
@@ -554,7 +554,7 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
                 }
             } else if (reqEvent->getCmd() == Command::GetS) {    // GetS
                 notifyListenerOfAccess(reqEvent, NotifyAccessType::READ, NotifyResultType::HIT);
-                dirLine->addSharer(reqEvent->getSrc());
+                dirLine->addSharer(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, &event->getPayload(), true, dirLine->getTimestamp());
                 dirLine->setTimestamp(sendTime);
                 if (is_debug_event(event)) printData(&event->getPayload(), false);
@@ -581,11 +581,11 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
             } else if (reqEvent->getCmd() == Command::GetS) {
                 notifyListenerOfAccess(reqEvent, NotifyAccessType::READ, NotifyResultType::HIT);
                 if (dirLine->numSharers() == 0) {
-                    dirLine->setOwner(reqEvent->getSrc());
+                    dirLine->setOwner(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, Command::GetXResp, &event->getPayload(), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
                 } else {
-                    dirLine->addSharer(reqEvent->getSrc());
+                    dirLine->addSharer(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, &event->getPayload(), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
                 }
@@ -615,8 +615,8 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
                 dirLine->setState(I);
             } else {
                 notifyListenerOfAccess(reqEvent, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                dirLine->setOwner(reqEvent->getSrc());
-                if (dirLine->isSharer(reqEvent->getSrc())) dirLine->removeSharer(reqEvent->getSrc());
+                dirLine->setOwner(reqEvent->getSrcID());
+                if (dirLine->isSharer(reqEvent->getSrcID())) dirLine->removeSharer(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, &event->getPayload(), true, dirLine->getTimestamp());
                 dirLine->setTimestamp(sendTime);
                 if (is_debug_event(reqEvent)) printData(&event->getPayload(), false);
@@ -635,11 +635,11 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
             } else if (reqEvent->getCmd() == Command::GetS) {
                 notifyListenerOfAccess(reqEvent, NotifyAccessType::READ, NotifyResultType::HIT);
                 if (dirLine->numSharers() == 0) {
-                    dirLine->setOwner(reqEvent->getSrc());
+                    dirLine->setOwner(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, Command::GetXResp, &event->getPayload(), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
                 } else {
-                    dirLine->addSharer(reqEvent->getSrc());
+                    dirLine->addSharer(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, &event->getPayload(), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
                 }
@@ -652,14 +652,14 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
         case SM_Inv:
             if (reqEvent->getCmd() == Command::Inv) {    // Completed Inv so handle
                 if (dirLine->numSharers() > 0) {
-                    invalidateAllSharers(dirLine, event->getRqstr(), true);
+                    invalidateAllSharers(dirLine, event->getRqstrID(), true);
                     return IGNORE;
                 }
                 sendAckInv(reqEvent);
                 dirLine->setState(IM);
             } else if (reqEvent->getCmd() == Command::FetchInv) {
                 if (dirLine->numSharers() > 0) {
-                    invalidateAllSharers(dirLine, event->getRqstr(), true);
+                    invalidateAllSharers(dirLine, event->getRqstrID(), true);
                     return IGNORE;
                 }
                 sendResponseDownFromMSHR(event, false);
@@ -733,11 +733,11 @@ CacheAction MESIInternalDirectory::handlePutMRequest(MemEvent * event, CacheLine
                 if (protocol_) {
                     sendTime = sendResponseUp(reqEvent, Command::GetXResp, &event->getPayload(), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
-                    dirLine->setOwner(reqEvent->getSrc());
+                    dirLine->setOwner(reqEvent->getSrcID());
                 } else {
                     sendTime = sendResponseUp(reqEvent, &event->getPayload(), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
-                    dirLine->addSharer(reqEvent->getSrc());
+                    dirLine->addSharer(reqEvent->getSrcID());
                 }
                 if (is_debug_event(event)) printData(&event->getPayload(), false);
                 if (event->getDirty()) dirLine->setState(M);
@@ -761,11 +761,11 @@ CacheAction MESIInternalDirectory::handlePutMRequest(MemEvent * event, CacheLine
                 if (protocol_) {
                     sendTime = sendResponseUp(reqEvent, Command::GetXResp, &event->getPayload(), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
-                    dirLine->setOwner(reqEvent->getSrc());
+                    dirLine->setOwner(reqEvent->getSrcID());
                 } else {
                     sendTime = sendResponseUp(reqEvent, &event->getPayload(), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
-                    dirLine->addSharer(reqEvent->getSrc());
+                    dirLine->addSharer(reqEvent->getSrcID());
                 }
                 if (is_debug_event(event)) printData(&event->getPayload(), false);
             }
@@ -779,7 +779,7 @@ CacheAction MESIInternalDirectory::handlePutMRequest(MemEvent * event, CacheLine
                 dirLine->setState(M);
                 sendTime = sendResponseUp(reqEvent, &event->getPayload(), true, dirLine->getTimestamp());
                 dirLine->setTimestamp(sendTime);
-                dirLine->setOwner(reqEvent->getSrc());
+                dirLine->setOwner(reqEvent->getSrcID());
                 if (is_debug_event(event)) printData(&event->getPayload(), false);
             } else { /* Cmd == Fetch */
                 sendResponseDownFromMSHR(event, (dirLine->getState() == M_Inv));
@@ -817,15 +817,15 @@ CacheAction MESIInternalDirectory::handleFlushLineRequest(MemEvent * event, Cach
             break;
         case E:
         case M:
-            if (dirLine->getOwner() == event->getSrc()) {
+            if (dirLine->getOwner() == event->getSrcID()) {
                 dirLine->clearOwner();
-                dirLine->addSharer(event->getSrc());
+                dirLine->addSharer(event->getSrcID());
                 if (event->getDirty()) {
                     dirLine->setState(M);
                 }
             }
             if (dirLine->ownerExists()) {
-                sendFetchInvX(dirLine, event->getRqstr(), replay);
+                sendFetchInvX(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 state == E ? dirLine->setState(E_InvX) : dirLine->setState(M_InvX);
                 return STALL;
@@ -849,9 +849,9 @@ CacheAction MESIInternalDirectory::handleFlushLineRequest(MemEvent * event, Cach
         case EI:
         case M_Inv:
         case E_Inv:
-            if (dirLine->getOwner() == event->getSrc()) {
+            if (dirLine->getOwner() == event->getSrcID()) {
                 dirLine->clearOwner();
-                dirLine->addSharer(event->getSrc()); // Other cache will treat FetchInv as Inv
+                dirLine->addSharer(event->getSrcID()); // Other cache will treat FetchInv as Inv
             }
             if (event->getDirty()) {
                 if (state == EI) dirLine->setState(MI);
@@ -860,9 +860,9 @@ CacheAction MESIInternalDirectory::handleFlushLineRequest(MemEvent * event, Cach
             return STALL;
         case M_InvX:
         case E_InvX:
-            if (dirLine->getOwner() == event->getSrc()) {
+            if (dirLine->getOwner() == event->getSrcID()) {
                 dirLine->clearOwner();
-                dirLine->addSharer(event->getSrc());
+                dirLine->addSharer(event->getSrcID());
                 mshr_->decrementAcksNeeded(event->getBaseAddr());
                 if (event->getDirty()) {
                     dirLine->setState(M_InvX);
@@ -881,7 +881,7 @@ CacheAction MESIInternalDirectory::handleFlushLineRequest(MemEvent * event, Cach
                     return handleFetchInv(reqEvent, dirLine, true, NULL);
                 } else {
                     notifyListenerOfAccess(reqEvent, NotifyAccessType::READ, NotifyResultType::HIT);
-                    dirLine->addSharer(reqEvent->getSrc());
+                    dirLine->addSharer(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, (isCached ? dirLine->getDataLine()->getData() : mshr_->getDataBuffer(event->getBaseAddr())), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
                     dirLine->setState(NextState[state]);
@@ -920,7 +920,7 @@ CacheAction MESIInternalDirectory::handleFlushLineInvRequest(MemEvent * event, C
 
     // Apply incoming flush -> remove if owner
     if (state == M || state == E) {
-        if (dirLine->getOwner() == event->getSrc()) {
+        if (dirLine->getOwner() == event->getSrcID()) {
             dirLine->clearOwner();
             if (event->getDirty()) {
                 dirLine->setState(M);
@@ -936,24 +936,24 @@ CacheAction MESIInternalDirectory::handleFlushLineInvRequest(MemEvent * event, C
             if (reqEvent != NULL) return STALL;
             break;
         case S:
-            if (dirLine->isSharer(event->getSrc())) dirLine->removeSharer(event->getSrc());
+            if (dirLine->isSharer(event->getSrcID())) dirLine->removeSharer(event->getSrcID());
             if (dirLine->numSharers() > 0) {
-                invalidateAllSharers(dirLine, event->getRqstr(), replay);
+                invalidateAllSharers(dirLine, event->getRqstrID(), replay);
                 dirLine->setState(S_Inv);
                 return STALL;
             }
             break;
         case E:
         case M:
-            if (dirLine->isSharer(event->getSrc())) dirLine->removeSharer(event->getSrc());
+            if (dirLine->isSharer(event->getSrcID())) dirLine->removeSharer(event->getSrcID());
             if (dirLine->ownerExists()) {
-                sendFetchInv(dirLine, event->getRqstr(), replay);
+                sendFetchInv(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 state == E ? dirLine->setState(E_Inv) : dirLine->setState(M_Inv);
                 return STALL;
             }
             if (dirLine->numSharers() > 0) {
-                invalidateAllSharers(dirLine, event->getRqstr(), replay);
+                invalidateAllSharers(dirLine, event->getRqstrID(), replay);
                 state == E ? dirLine->setState(E_Inv) : dirLine->setState(M_Inv);
                 return STALL;
             }
@@ -963,7 +963,7 @@ CacheAction MESIInternalDirectory::handleFlushLineInvRequest(MemEvent * event, C
         case SM:
             return STALL; // Wait for the Get* request to finish
         case SM_D:
-            if (*(dirLine->getSharers()->begin()) == event->getSrc()) { // Flush raced with Fetch
+            if (*(dirLine->getSharers().begin()) == event->getSrcID()) { // Flush raced with Fetch
                 mshr_->decrementAcksNeeded(event->getBaseAddr());
             }
             if (mshr_->getAcksNeeded(event->getBaseAddr()) == 0) {
@@ -978,11 +978,11 @@ CacheAction MESIInternalDirectory::handleFlushLineInvRequest(MemEvent * event, C
         case S_D:
         case E_D:
         case M_D:
-            if (*(dirLine->getSharers()->begin()) == event->getSrc()) {
+            if (*(dirLine->getSharers().begin()) == event->getSrcID()) {
                 mshr_->decrementAcksNeeded(event->getBaseAddr()); 
             }
-            if (dirLine->isSharer(event->getSrc())) {
-                dirLine->removeSharer(event->getSrc());
+            if (dirLine->isSharer(event->getSrcID())) {
+                dirLine->removeSharer(event->getSrcID());
             }
             if (mshr_->getAcksNeeded(event->getBaseAddr()) == 0) {
                 dirLine->setState(NextState[state]);
@@ -998,11 +998,11 @@ CacheAction MESIInternalDirectory::handleFlushLineInvRequest(MemEvent * event, C
                 } else if (reqEvent->getCmd() == Command::GetS) {
                     notifyListenerOfAccess(reqEvent, NotifyAccessType::READ, NotifyResultType::HIT);
                     if (dirLine->numSharers() > 0 || state == S_D) {
-                        dirLine->addSharer(reqEvent->getSrc());
+                        dirLine->addSharer(reqEvent->getSrcID());
                         sendTime = sendResponseUp(reqEvent, &event->getPayload(), true, dirLine->getTimestamp());
                         dirLine->setTimestamp(sendTime);
                     } else {
-                        dirLine->setOwner(reqEvent->getSrc());
+                        dirLine->setOwner(reqEvent->getSrcID());
                         sendTime = sendResponseUp(reqEvent, Command::GetXResp, &event->getPayload(), true, dirLine->getTimestamp());
                         dirLine->setTimestamp(sendTime);
                     }
@@ -1015,8 +1015,8 @@ CacheAction MESIInternalDirectory::handleFlushLineInvRequest(MemEvent * event, C
             }
             return STALL;
         case S_Inv:
-            if (dirLine->isSharer(event->getSrc())) {
-                dirLine->removeSharer(event->getSrc());
+            if (dirLine->isSharer(event->getSrcID())) {
+                dirLine->removeSharer(event->getSrcID());
                 mshr_->decrementAcksNeeded(event->getBaseAddr());
             }
             reqEventAction = (mshr_->getAcksNeeded(event->getBaseAddr()) == 0) ? DONE : STALL;
@@ -1035,14 +1035,14 @@ CacheAction MESIInternalDirectory::handleFlushLineInvRequest(MemEvent * event, C
             }
             return reqEventAction;
         case SM_Inv:
-            if (dirLine->isSharer(event->getSrc())) {
-                dirLine->removeSharer(event->getSrc());
+            if (dirLine->isSharer(event->getSrcID())) {
+                dirLine->removeSharer(event->getSrcID());
                 mshr_->decrementAcksNeeded(event->getBaseAddr());
             }
             if (mshr_->getAcksNeeded(event->getBaseAddr()) == 0) {
                 if (reqEvent->getCmd() == Command::Inv) {
                     if (dirLine->numSharers() > 0) {  // May not have invalidated GetX requestor -> cannot also be the FlushLine requestor since that one is in I and blocked on flush
-                        invalidateAllSharers(dirLine, reqEvent->getRqstr(), true);
+                        invalidateAllSharers(dirLine, reqEvent->getRqstrID(), true);
                         return STALL;
                     } else {
                         sendAckInv(reqEvent);
@@ -1058,11 +1058,11 @@ CacheAction MESIInternalDirectory::handleFlushLineInvRequest(MemEvent * event, C
             }
             return STALL;
         case MI:
-            if (dirLine->getOwner() == event->getSrc()) {
+            if (dirLine->getOwner() == event->getSrcID()) {
                 dirLine->clearOwner();
                 mshr_->decrementAcksNeeded(event->getBaseAddr());
-            } else if (dirLine->isSharer(event->getSrc())) {
-                dirLine->removeSharer(event->getSrc());
+            } else if (dirLine->isSharer(event->getSrcID())) {
+                dirLine->removeSharer(event->getSrcID());
                 mshr_->decrementAcksNeeded(event->getBaseAddr());
             }
             if (mshr_->getAcksNeeded(event->getBaseAddr()) == 0) {
@@ -1073,11 +1073,11 @@ CacheAction MESIInternalDirectory::handleFlushLineInvRequest(MemEvent * event, C
                 return DONE;
             } else return STALL;
         case EI:
-            if (dirLine->getOwner() == event->getSrc()) {
+            if (dirLine->getOwner() == event->getSrcID()) {
                 dirLine->clearOwner();
                 mshr_->decrementAcksNeeded(event->getBaseAddr());
-            } else if (dirLine->isSharer(event->getSrc())) {
-                dirLine->removeSharer(event->getSrc());
+            } else if (dirLine->isSharer(event->getSrcID())) {
+                dirLine->removeSharer(event->getSrcID());
                 mshr_->decrementAcksNeeded(event->getBaseAddr());
             }
             if (event->getDirty()) dirLine->setState(MI);
@@ -1091,8 +1091,8 @@ CacheAction MESIInternalDirectory::handleFlushLineInvRequest(MemEvent * event, C
                 return DONE;
             } else return STALL;
         case SI:
-            if (dirLine->isSharer(event->getSrc())) {
-                dirLine->removeSharer(event->getSrc());
+            if (dirLine->isSharer(event->getSrcID())) {
+                dirLine->removeSharer(event->getSrcID());
                 mshr_->decrementAcksNeeded(event->getBaseAddr());
             }
             if (mshr_->getAcksNeeded(event->getBaseAddr()) == 0) {
@@ -1103,10 +1103,10 @@ CacheAction MESIInternalDirectory::handleFlushLineInvRequest(MemEvent * event, C
                 return DONE;
             } else return STALL;
         case M_Inv:
-            if (dirLine->isSharer(event->getSrc())) {
-                dirLine->removeSharer(event->getSrc());
+            if (dirLine->isSharer(event->getSrcID())) {
+                dirLine->removeSharer(event->getSrcID());
                 mshr_->decrementAcksNeeded(event->getBaseAddr());
-            } else if (dirLine->getOwner() == event->getSrc()) {
+            } else if (dirLine->getOwner() == event->getSrcID()) {
                 dirLine->clearOwner();
                 mshr_->decrementAcksNeeded(event->getBaseAddr());
             }
@@ -1116,8 +1116,8 @@ CacheAction MESIInternalDirectory::handleFlushLineInvRequest(MemEvent * event, C
                     dirLine->setState(I);
                     return DONE;
                 } else if (reqEvent->getCmd() == Command::GetX || reqEvent->getCmd() == Command::GetSX) {
-                    dirLine->setOwner(reqEvent->getSrc());
-                    if (dirLine->isSharer(reqEvent->getSrc())) dirLine->removeSharer(reqEvent->getSrc());
+                    dirLine->setOwner(reqEvent->getSrcID());
+                    if (dirLine->isSharer(reqEvent->getSrcID())) dirLine->removeSharer(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, (isCached ? dirLine->getDataLine()->getData() : mshr_->getDataBuffer(event->getBaseAddr())), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
                     dirLine->setState(M);
@@ -1129,10 +1129,10 @@ CacheAction MESIInternalDirectory::handleFlushLineInvRequest(MemEvent * event, C
                 }
             } else return STALL;
         case E_Inv:
-            if (dirLine->isSharer(event->getSrc())) {
-                dirLine->removeSharer(event->getSrc());
+            if (dirLine->isSharer(event->getSrcID())) {
+                dirLine->removeSharer(event->getSrcID());
                 mshr_->decrementAcksNeeded(event->getBaseAddr());
-            } else if (dirLine->getOwner() == event->getSrc()) {
+            } else if (dirLine->getOwner() == event->getSrcID()) {
                 dirLine->clearOwner();
                 mshr_->decrementAcksNeeded(event->getBaseAddr());
             }
@@ -1150,7 +1150,7 @@ CacheAction MESIInternalDirectory::handleFlushLineInvRequest(MemEvent * event, C
             } else return STALL;
         case M_InvX:
         case E_InvX:
-            if (dirLine->getOwner() == event->getSrc()) {
+            if (dirLine->getOwner() == event->getSrcID()) {
                 mshr_->decrementAcksNeeded(event->getBaseAddr());
                 dirLine->clearOwner();
             }
@@ -1169,11 +1169,11 @@ CacheAction MESIInternalDirectory::handleFlushLineInvRequest(MemEvent * event, C
                     if (protocol_) {
                         sendTime = sendResponseUp(reqEvent, Command::GetXResp, &event->getPayload(), true, dirLine->getTimestamp());
                         dirLine->setTimestamp(sendTime);
-                        dirLine->addSharer(reqEvent->getSrc());
+                        dirLine->addSharer(reqEvent->getSrcID());
                     } else {
                         sendTime = sendResponseUp(reqEvent, &event->getPayload(), true, dirLine->getTimestamp());
                         dirLine->setTimestamp(sendTime);
-                        dirLine->addSharer(reqEvent->getSrc());
+                        dirLine->addSharer(reqEvent->getSrcID());
                     }
                     if (is_debug_event(event)) printData(&event->getPayload(), false);
                 }
@@ -1208,12 +1208,12 @@ CacheAction MESIInternalDirectory::handleInv(MemEvent* event, CacheLine* dirLine
         case S_B:
         case S:
             if (dirLine->numSharers() > 0) {
-                invalidateAllSharers(dirLine, event->getRqstr(), replay);
+                invalidateAllSharers(dirLine, event->getRqstrID(), replay);
                 state == S_B ? dirLine->setState(SB_Inv) : dirLine->setState(S_Inv);
                 // Resolve races with waiting PutS requests
                 while (collisionEvent != NULL) {
                     if (collisionEvent->getCmd() == Command::PutS) {
-                        dirLine->removeSharer(collisionEvent->getSrc());
+                        dirLine->removeSharer(collisionEvent->getSrcID());
                         mshr_->decrementAcksNeeded(event->getBaseAddr());
                         mshr_->removeElement(event->getBaseAddr(), collisionEvent);   
                         delete collisionEvent;
@@ -1228,11 +1228,11 @@ CacheAction MESIInternalDirectory::handleInv(MemEvent* event, CacheLine* dirLine
             return DONE;
         case SM:
             if (dirLine->numSharers() > 0) {
-                invalidateAllSharers(dirLine, event->getRqstr(), replay);
+                invalidateAllSharers(dirLine, event->getRqstrID(), replay);
                 dirLine->setState(SM_Inv);
                 while (collisionEvent != NULL) {
                     if (collisionEvent->getCmd() == Command::PutS) {
-                        dirLine->removeSharer(collisionEvent->getSrc());
+                        dirLine->removeSharer(collisionEvent->getSrcID());
                         mshr_->decrementAcksNeeded(event->getBaseAddr());
                         mshr_->removeFront(event->getBaseAddr());   // We've sent an inv to them so no need for AckPut
                         delete collisionEvent;
@@ -1272,7 +1272,7 @@ CacheAction MESIInternalDirectory::handleForceInv(MemEvent * event, CacheLine *
     
     /* Handle mshr collisions with replacements - treat as having already occured, however AckPut needs to get returned */
     while (collisionEvent && collisionEvent->isWriteback()) {
-        if (dirLine->isSharer(collisionEvent->getSrc())) dirLine->removeSharer(collisionEvent->getSrc());
+        if (dirLine->isSharer(collisionEvent->getSrcID())) dirLine->removeSharer(collisionEvent->getSrcID());
         if (dirLine->ownerExists()) dirLine->clearOwner();
         sendWritebackAck(collisionEvent);
         mshr_->removeFront(dirLine->getBaseAddr());
@@ -1292,7 +1292,7 @@ CacheAction MESIInternalDirectory::handleForceInv(MemEvent * event, CacheLine *
         case S_B:
         case SM:
             if (dirLine->numSharers() > 0) {
-                invalidateAllSharers(dirLine, event->getRqstr(), replay);
+                invalidateAllSharers(dirLine, event->getRqstrID(), replay);
                 if (state == S) dirLine->setState(S_Inv);
                 else if (state == S_B) dirLine->setState(SB_Inv);
                 else dirLine->setState(SM_Inv);
@@ -1306,13 +1306,13 @@ CacheAction MESIInternalDirectory::handleForceInv(MemEvent * event, CacheLine *
         case E:
         case M:
             if (dirLine->ownerExists()) {
-                sendForceInv(dirLine, event->getRqstr(), replay);
+                sendForceInv(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 state == E ? dirLine->setState(E_Inv) : dirLine->setState(M_Inv);
                 return STALL;
             }
             if (dirLine->numSharers() > 0) {
-                invalidateAllSharers(dirLine, event->getRqstr(), replay);
+                invalidateAllSharers(dirLine, event->getRqstrID(), replay);
                 state == E ? dirLine->setState(E_Inv) : dirLine->setState(M_Inv);
                 return STALL;
             }
@@ -1373,7 +1373,7 @@ CacheAction MESIInternalDirectory::handleFetch(MemEvent * event, CacheLine * dir
                 sendResponseDown(event, dirLine, &collisionEvent->getPayload(), false, replay);
                 return DONE;
             }
-            sendFetch(dirLine, event->getRqstr(), replay);
+            sendFetch(dirLine, event->getRqstrID(), replay);
             mshr_->incrementAcksNeeded(event->getBaseAddr());
             if (state == S) dirLine->setState(S_D);
             else dirLine->setState(SM_D);
@@ -1405,7 +1405,7 @@ CacheAction MESIInternalDirectory::handleFetchInv(MemEvent * event, CacheLine *
     // If colliding event is a replacement, treat the replacement as if it had aleady occured/raced with an earlier FetchInv
     if (collisionEvent && collisionEvent->isWriteback()) {
         collision = true;
-        if (dirLine->isSharer(collisionEvent->getSrc())) dirLine->removeSharer(collisionEvent->getSrc());
+        if (dirLine->isSharer(collisionEvent->getSrcID())) dirLine->removeSharer(collisionEvent->getSrcID());
         if (dirLine->ownerExists()) dirLine->clearOwner();
         mshr_->setDataBuffer(collisionEvent->getBaseAddr(), collisionEvent->getPayload());
         if (state == E && collisionEvent->getDirty()) dirLine->setState(M);
@@ -1423,8 +1423,8 @@ CacheAction MESIInternalDirectory::handleFetchInv(MemEvent * event, CacheLine *
             return IGNORE;
         case S:
             if (dirLine->numSharers() > 0) {
-                if (isCached || collision) invalidateAllSharers(dirLine, event->getRqstr(), replay);
-                else invalidateAllSharersAndFetch(dirLine, event->getRqstr(), replay);
+                if (isCached || collision) invalidateAllSharers(dirLine, event->getRqstrID(), replay);
+                else invalidateAllSharersAndFetch(dirLine, event->getRqstrID(), replay);
                 dirLine->setState(S_Inv);
                 return STALL;
             }
@@ -1435,8 +1435,8 @@ CacheAction MESIInternalDirectory::handleFetchInv(MemEvent * event, CacheLine *
             return DONE;
         case SM:
             if (dirLine->numSharers() > 0) {
-                if (isCached || collision) invalidateAllSharers(dirLine, event->getRqstr(), replay);
-                else invalidateAllSharersAndFetch(dirLine, event->getRqstr(), replay);
+                if (isCached || collision) invalidateAllSharers(dirLine, event->getRqstrID(), replay);
+                else invalidateAllSharersAndFetch(dirLine, event->getRqstrID(), replay);
                 dirLine->setState(SM_Inv);
                 return STALL;
             }
@@ -1447,7 +1447,7 @@ CacheAction MESIInternalDirectory::handleFetchInv(MemEvent * event, CacheLine *
             return DONE;
         case S_B:
             if (dirLine->numSharers() > 0) {
-                invalidateAllSharers(dirLine, event->getRqstr(), replay);
+                invalidateAllSharers(dirLine, event->getRqstrID(), replay);
                 dirLine->setState(SB_Inv);
                 return STALL;
             }
@@ -1456,14 +1456,14 @@ CacheAction MESIInternalDirectory::handleFetchInv(MemEvent * event, CacheLine *
             return DONE;
         case E:
             if (dirLine->ownerExists()) {
-                sendFetchInv(dirLine, event->getRqstr(), replay);
+                sendFetchInv(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 dirLine->setState(E_Inv);
                 return STALL;
             }
             if (dirLine->numSharers() > 0) {
-                if (isCached || collision) invalidateAllSharers(dirLine, event->getRqstr(), replay);
-                else invalidateAllSharersAndFetch(dirLine, event->getRqstr(), replay);
+                if (isCached || collision) invalidateAllSharers(dirLine, event->getRqstrID(), replay);
+                else invalidateAllSharersAndFetch(dirLine, event->getRqstrID(), replay);
                 dirLine->setState(E_Inv);
                 return STALL;
             }
@@ -1474,14 +1474,14 @@ CacheAction MESIInternalDirectory::handleFetchInv(MemEvent * event, CacheLine *
             return DONE;
         case M:
             if (dirLine->ownerExists()) {
-                sendFetchInv(dirLine, event->getRqstr(), replay);
+                sendFetchInv(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 dirLine->setState(M_Inv);
                 return STALL;
             }
             if (dirLine->numSharers() > 0) {
-                if (isCached || collision) invalidateAllSharers(dirLine, event->getRqstr(), replay);
-                else invalidateAllSharersAndFetch(dirLine, event->getRqstr(), replay);
+                if (isCached || collision) invalidateAllSharers(dirLine, event->getRqstrID(), replay);
+                else invalidateAllSharersAndFetch(dirLine, event->getRqstrID(), replay);
                 dirLine->setState(M_Inv);
                 return STALL;
             }
@@ -1541,7 +1541,7 @@ CacheAction MESIInternalDirectory::handleFetchInvX(MemEvent * event, CacheLine *
             if (collision) {
                 if (dirLine->ownerExists()) {
                     dirLine->clearOwner();
-                    dirLine->addSharer(collisionEvent->getSrc());
+                    dirLine->addSharer(collisionEvent->getSrcID());
                     collisionEvent->setCmd(Command::PutS);   // TODO there's probably a cleaner way to do this...and a safer/better way!
                 }
                 dirLine->setState(S);
@@ -1549,7 +1549,7 @@ CacheAction MESIInternalDirectory::handleFetchInvX(MemEvent * event, CacheLine *
                 return DONE;
             }
             if (dirLine->ownerExists()) {
-                sendFetchInvX(dirLine, event->getRqstr(), replay);
+                sendFetchInvX(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 dirLine->setState(E_InvX);
                 return STALL;
@@ -1560,7 +1560,7 @@ CacheAction MESIInternalDirectory::handleFetchInvX(MemEvent * event, CacheLine *
                 return DONE;
             }
             // Otherwise shared and not cached
-            sendFetch(dirLine, event->getRqstr(), replay);
+            sendFetch(dirLine, event->getRqstrID(), replay);
             mshr_->incrementAcksNeeded(event->getBaseAddr());
             dirLine->setState(E_InvX);
             return STALL;
@@ -1568,7 +1568,7 @@ CacheAction MESIInternalDirectory::handleFetchInvX(MemEvent * event, CacheLine *
            if (collision) {
                 if (dirLine->ownerExists()) {
                     dirLine->clearOwner();
-                    dirLine->addSharer(collisionEvent->getSrc());
+                    dirLine->addSharer(collisionEvent->getSrcID());
                     collisionEvent->setCmd(Command::PutS);   // TODO there's probably a cleaner way to do this...and a safer/better way!
                 }
                 dirLine->setState(S);
@@ -1576,7 +1576,7 @@ CacheAction MESIInternalDirectory::handleFetchInvX(MemEvent * event, CacheLine *
                 return DONE;
             }
             if (dirLine->ownerExists()) {
-                sendFetchInvX(dirLine, event->getRqstr(), replay);
+                sendFetchInvX(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 dirLine->setState(M_InvX);
                 return STALL;
@@ -1587,7 +1587,7 @@ CacheAction MESIInternalDirectory::handleFetchInvX(MemEvent * event, CacheLine *
                 return DONE;
             }
             // Otherwise shared and not cached
-            sendFetch(dirLine, event->getRqstr(), replay);
+            sendFetch(dirLine, event->getRqstrID(), replay);
             mshr_->incrementAcksNeeded(event->getBaseAddr());
             dirLine->setState(M_InvX);
             return STALL;
@@ -1622,7 +1622,7 @@ CacheAction MESIInternalDirectory::handleDataResponse(MemEvent* responseEvent, C
     
     origRequest->setMemFlags(responseEvent->getMemFlags());
 
-    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstr() == parent->getName()));
+    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstrID() == parentID_));
     bool isCached = dirLine->getDataLine() != NULL;
     uint64_t sendTime = 0;
     switch (state) {
@@ -1633,10 +1633,10 @@ CacheAction MESIInternalDirectory::handleDataResponse(MemEvent* responseEvent, C
             if (isCached) dirLine->getDataLine()->setData(responseEvent->getPayload(), 0);
             if (!shouldRespond) return DONE;
             if (dirLine->getState() == E) {
-                dirLine->setOwner(origRequest->getSrc());
+                dirLine->setOwner(origRequest->getSrcID());
                 sendTime = sendResponseUp(origRequest, Command::GetXResp, &responseEvent->getPayload(), true, dirLine->getTimestamp());
             } else {
-                dirLine->addSharer(origRequest->getSrc());
+                dirLine->addSharer(origRequest->getSrcID());
                 sendTime = sendResponseUp(origRequest, &responseEvent->getPayload(), true, dirLine->getTimestamp());
             }
             dirLine->setTimestamp(sendTime);
@@ -1646,8 +1646,8 @@ CacheAction MESIInternalDirectory::handleDataResponse(MemEvent* responseEvent, C
             if (isCached) dirLine->getDataLine()->setData(responseEvent->getPayload(), 0);
         case SM:
             dirLine->setState(M);
-            dirLine->setOwner(origRequest->getSrc());
-            if (dirLine->isSharer(origRequest->getSrc())) dirLine->removeSharer(origRequest->getSrc());
+            dirLine->setOwner(origRequest->getSrcID());
+            if (dirLine->isSharer(origRequest->getSrcID())) dirLine->removeSharer(origRequest->getSrcID());
             notifyListenerOfAccess(origRequest, NotifyAccessType::WRITE, NotifyResultType::HIT);
             sendTime = sendResponseUp(origRequest, (isCached ? dirLine->getDataLine()->getData() : &responseEvent->getPayload()), true, dirLine->getTimestamp());
             dirLine->setTimestamp(sendTime);
@@ -1691,7 +1691,7 @@ CacheAction MESIInternalDirectory::handleFetchResp(MemEvent * responseEvent, Cac
                 sendResponseDownFromMSHR(responseEvent, (state == M));
             } else if (reqEvent->getCmd() == Command::GetS) {    // GetS
                 notifyListenerOfAccess(reqEvent, NotifyAccessType::READ, NotifyResultType::HIT);
-                dirLine->addSharer(reqEvent->getSrc());
+                dirLine->addSharer(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, &responseEvent->getPayload(), true, dirLine->getTimestamp());
                 dirLine->setTimestamp(sendTime);
                 if (is_debug_event(responseEvent)) printData(&responseEvent->getPayload(), false);
@@ -1701,7 +1701,7 @@ CacheAction MESIInternalDirectory::handleFetchResp(MemEvent * responseEvent, Cac
             }
             break;
         case SI:
-            dirLine->removeSharer(responseEvent->getSrc());
+            dirLine->removeSharer(responseEvent->getSrcID());
             mshr_->setDataBuffer(responseEvent->getBaseAddr(), responseEvent->getPayload());
             if (action == DONE) {
                 sendWritebackFromMSHR(Command::PutS, dirLine, reqEvent->getRqstr(), &responseEvent->getPayload());
@@ -1712,8 +1712,8 @@ CacheAction MESIInternalDirectory::handleFetchResp(MemEvent * responseEvent, Cac
         case EI:
             if (responseEvent->getDirty()) dirLine->setState(MI);
         case MI:
-            if (dirLine->getOwner() == responseEvent->getSrc()) dirLine->clearOwner();
-            if (dirLine->isSharer(responseEvent->getSrc())) dirLine->removeSharer(responseEvent->getSrc());
+            if (dirLine->getOwner() == responseEvent->getSrcID()) dirLine->clearOwner();
+            if (dirLine->isSharer(responseEvent->getSrcID())) dirLine->removeSharer(responseEvent->getSrcID());
             if (action == DONE) {
                 sendWritebackFromMSHR(((dirLine->getState() == EI) ? Command::PutE : Command::PutM), dirLine, parent->getName(), &responseEvent->getPayload());
                 if (expectWritebackAck_) mshr_->insertWriteback(dirLine->getBaseAddr());
@@ -1722,9 +1722,9 @@ CacheAction MESIInternalDirectory::handleFetchResp(MemEvent * responseEvent, Cac
             break;
         case E_InvX:    // FetchXResp for a GetS, FetchInvX, or FlushLine
         case M_InvX:    // FetchXResp for a GetS, FetchInvX, or FlushLine
-            if (dirLine->getOwner() == responseEvent->getSrc()) {
+            if (dirLine->getOwner() == responseEvent->getSrcID()) {
                 dirLine->clearOwner();
-                dirLine->addSharer(responseEvent->getSrc());
+                dirLine->addSharer(responseEvent->getSrcID());
             }
             if (!isCached) mshr_->setDataBuffer(responseEvent->getBaseAddr(), responseEvent->getPayload());
             if (reqEvent->getCmd() == Command::FetchInvX) {
@@ -1732,7 +1732,7 @@ CacheAction MESIInternalDirectory::handleFetchResp(MemEvent * responseEvent, Cac
                 dirLine->setState(S);
             } else if (reqEvent->getCmd() == Command::FetchInv) {    // External FetchInv raced with our FlushLine, handle it first
                 if (dirLine->numSharers() > 0) {
-                    invalidateAllSharers(dirLine, reqEvent->getRqstr(), true);
+                    invalidateAllSharers(dirLine, reqEvent->getRqstrID(), true);
                     (state == M_InvX || responseEvent->getDirty())?  dirLine->setState(M_Inv) : dirLine->setState(E_Inv);
                     return STALL;
                 }
@@ -1743,7 +1743,7 @@ CacheAction MESIInternalDirectory::handleFetchResp(MemEvent * responseEvent, Cac
                 action = handleFlushLineRequest(reqEvent, dirLine, NULL, true);
             } else {
                 notifyListenerOfAccess(reqEvent, NotifyAccessType::READ, NotifyResultType::HIT);
-                dirLine->addSharer(reqEvent->getSrc());
+                dirLine->addSharer(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, &responseEvent->getPayload(), true, dirLine->getTimestamp());
                 dirLine->setTimestamp(sendTime);
                 if (is_debug_event(responseEvent)) printData(&responseEvent->getPayload(), false);
@@ -1753,16 +1753,16 @@ CacheAction MESIInternalDirectory::handleFetchResp(MemEvent * responseEvent, Cac
             break;
         case E_Inv: // FetchResp for FetchInv/flush, may also be waiting for acks
         case M_Inv: // FetchResp for FetchInv/flush or GetX, may also be waiting for acks
-            if (dirLine->isSharer(responseEvent->getSrc())) dirLine->removeSharer(responseEvent->getSrc());
-            if (dirLine->getOwner() == responseEvent->getSrc()) dirLine->clearOwner();
+            if (dirLine->isSharer(responseEvent->getSrcID())) dirLine->removeSharer(responseEvent->getSrcID());
+            if (dirLine->getOwner() == responseEvent->getSrcID()) dirLine->clearOwner();
             if (action != DONE) {
                 if (responseEvent->getDirty()) dirLine->setState(M_Inv);
                 mshr_->setDataBuffer(responseEvent->getBaseAddr(), responseEvent->getPayload());
             } else {
                 if (reqEvent->getCmd() == Command::GetX || reqEvent->getCmd() == Command::GetSX) {
                     notifyListenerOfAccess(reqEvent, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                    if (dirLine->isSharer(reqEvent->getSrc())) dirLine->removeSharer(reqEvent->getSrc());
-                    dirLine->setOwner(reqEvent->getSrc());
+                    if (dirLine->isSharer(reqEvent->getSrcID())) dirLine->removeSharer(reqEvent->getSrcID());
+                    dirLine->setOwner(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, &responseEvent->getPayload(), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
                     dirLine->setState(M);
@@ -1786,7 +1786,7 @@ CacheAction MESIInternalDirectory::handleFetchResp(MemEvent * responseEvent, Cac
             break;
         case S_Inv:     // Received a FetchInv in S state
         case SM_Inv:    // Received a FetchInv in SM state
-            if (dirLine->isSharer(responseEvent->getSrc())) dirLine->removeSharer(responseEvent->getSrc());
+            if (dirLine->isSharer(responseEvent->getSrcID())) dirLine->removeSharer(responseEvent->getSrcID());
             if (action != DONE) {
                 mshr_->setDataBuffer(responseEvent->getBaseAddr(), responseEvent->getPayload());
             } else {
@@ -1808,8 +1808,8 @@ CacheAction MESIInternalDirectory::handleAckInv(MemEvent * ack, CacheLine * dirL
     State state = dirLine->getState();
     recordStateEventCount(ack->getCmd(), state);
 
-    if (dirLine->isSharer(ack->getSrc())) {
-        dirLine->removeSharer(ack->getSrc());
+    if (dirLine->isSharer(ack->getSrcID())) {
+        dirLine->removeSharer(ack->getSrcID());
     }
     if (is_debug_event(ack)) debug->debug(_L6_, "Received AckInv for 0x%" PRIx64 ", acks needed: %d\n", ack->getBaseAddr(), mshr_->getAcksNeeded(ack->getBaseAddr()));
     if (mshr_->getAcksNeeded(ack->getBaseAddr()) > 0) mshr_->decrementAcksNeeded(ack->getBaseAddr());
@@ -1839,8 +1839,8 @@ CacheAction MESIInternalDirectory::handleAckInv(MemEvent * ack, CacheLine * dirL
                     dirLine->setState(I);
                 } else {
                     notifyListenerOfAccess(reqEvent, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                    dirLine->setOwner(reqEvent->getSrc());
-                    if (dirLine->isSharer(reqEvent->getSrc())) dirLine->removeSharer(reqEvent->getSrc());
+                    dirLine->setOwner(reqEvent->getSrcID());
+                    if (dirLine->isSharer(reqEvent->getSrcID())) dirLine->removeSharer(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, data, true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
                     if (is_debug_event(reqEvent)) printData(data, false);
@@ -1853,7 +1853,7 @@ CacheAction MESIInternalDirectory::handleAckInv(MemEvent * ack, CacheLine * dirL
             if (action == DONE) {
                 if (reqEvent->getCmd() == Command::Inv || reqEvent->getCmd() == Command::ForceInv) {    // Completed Inv so handle
                     if (dirLine->numSharers() > 0) {
-                        invalidateAllSharers(dirLine, reqEvent->getRqstr(), true);
+                        invalidateAllSharers(dirLine, reqEvent->getRqstrID(), true);
                         return STALL;
                     }
                     sendAckInv(reqEvent);
@@ -1870,7 +1870,7 @@ CacheAction MESIInternalDirectory::handleAckInv(MemEvent * ack, CacheLine * dirL
         case SB_Inv:
             if (action == DONE) {
                 if (dirLine->numSharers() > 0) {
-                    invalidateAllSharers(dirLine, reqEvent->getRqstr(), true);
+                    invalidateAllSharers(dirLine, reqEvent->getRqstrID(), true);
                     return IGNORE;
                 }
                 sendAckInv(reqEvent);
@@ -1910,16 +1910,16 @@ CacheAction MESIInternalDirectory::handleAckInv(MemEvent * ack, CacheLine * dirL
  *---------------------------------------------------------------------------------------------------------------------*/
 
 
-void MESIInternalDirectory::invalidateAllSharers(CacheLine * dirLine, string rqstr, bool replay) {
-    set<std::string> * sharers = dirLine->getSharers();
+void MESIInternalDirectory::invalidateAllSharers(CacheLine * dirLine, EndpointID rqstr, bool replay) {
+    SharerList sharers = dirLine->getSharers();
     
     uint64_t baseTime = (timestamp_ > dirLine->getTimestamp()) ? timestamp_ : dirLine->getTimestamp();
     uint64_t deliveryTime = (replay) ? baseTime + mshrLatency_ : baseTime + tagLatency_;
     bool invSent = false;
-    for (set<std::string>::iterator it = sharers->begin(); it != sharers->end(); it++) {
+    for (SharerIterator it = sharers.begin(); it != sharers.end(); it++) {
         MemEvent * inv = new MemEvent(parent, dirLine->getBaseAddr(), dirLine->getBaseAddr(), Command::Inv);
-        inv->setDst(*it);
-        inv->setRqstr(rqstr);
+        inv->setDstID(*it);
+        inv->setRqstrID(rqstr);
     
         Response resp = {inv, deliveryTime, packetHeaderBytes};
         addToOutgoingQueueUp(resp);
@@ -1928,30 +1928,30 @@ void MESIInternalDirectory::invalidateAllSharers(CacheLine * dirLine, string rqs
         invSent = true;
         if (is_debug_addr(dirLine->getBaseAddr())) {
             debug->debug(_L7_,"Sending inv: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-                dirLine->getBaseAddr(), (*it).c_str(), deliveryTime);
+                dirLine->getBaseAddr(), EndpointRegistry::getName(*it).c_str(), deliveryTime);
         }
     }
     if (invSent) dirLine->setTimestamp(deliveryTime);
 }
 
 
-void MESIInternalDirectory::invalidateAllSharersAndFetch(CacheLine * cacheLine, string rqstr, bool replay) {
-    set<std::string> * sharers = cacheLine->getSharers();
+void MESIInternalDirectory::invalidateAllSharersAndFetch(CacheLine * cacheLine, EndpointID rqstr, bool replay) {
+    SharerList sharers = cacheLine->getSharers();
     bool fetched = false;
     
     uint64_t baseTime = (timestamp_ > cacheLine->getTimestamp()) ? timestamp_ : cacheLine->getTimestamp();
     uint64_t deliveryTime = (replay) ? timestamp_ + mshrLatency_ : timestamp_ + tagLatency_;
     bool invSent = false;
 
-    for (set<std::string>::iterator it = sharers->begin(); it != sharers->end(); it++) {
+    for (SharerIterator it = sharers.begin(); it != sharers.end(); it++) {
         MemEvent * inv;
         if (fetched) inv = new MemEvent(parent, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Command::Inv);
         else {
             inv = new MemEvent(parent, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Command::FetchInv);
             fetched = true;
         }
-        inv->setDst(*it);
-        inv->setRqstr(rqstr);
+        inv->setDstID(*it);
+        inv->setRqstrID(rqstr);
         inv->setSize(cacheLine->getSize());
     
         Response resp = {inv, deliveryTime, packetHeaderBytes};
@@ -1962,7 +1962,7 @@ void MESIInternalDirectory::invalidateAllSharersAndFetch(CacheLine * cacheLine,
 
         if (is_debug_addr(cacheLine->getBaseAddr())) {
             debug->debug(_L7_,"Sending inv: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-                cacheLine->getBaseAddr(), (*it).c_str(), deliveryTime);
+                cacheLine->getBaseAddr(), EndpointRegistry::getName(*it).c_str(), deliveryTime);
         }
     }
     
@@ -1974,15 +1974,15 @@ void MESIInternalDirectory::invalidateAllSharersAndFetch(CacheLine * cacheLine,
  * If checkFetch is true -> block is not cached
  * Then, if requestor is not already a sharer, we need data!
  */
-bool MESIInternalDirectory::invalidateSharersExceptRequestor(CacheLine * cacheLine, string rqstr, string origRqstr, bool replay, bool uncached) {
+bool MESIInternalDirectory::invalidateSharersExceptRequestor(CacheLine * cacheLine, EndpointID rqstr, EndpointID origRqstr, bool replay, bool uncached) {
     bool sentInv = false;
-    set<std::string> * sharers = cacheLine->getSharers();
-    bool needFetch = uncached && (sharers->find(rqstr) == sharers->end());
+    SharerList sharers = cacheLine->getSharers();
+    bool needFetch = uncached && !cacheLine->isSharer(rqstr);
     
     uint64_t baseTime = (timestamp_ > cacheLine->getTimestamp()) ? timestamp_ : cacheLine->getTimestamp();
     uint64_t deliveryTime = (replay) ? baseTime + mshrLatency_ : baseTime + tagLatency_;
     
-    for (set<std::string>::iterator it = sharers->begin(); it != sharers->end(); it++) {
+    for (SharerIterator it = sharers.begin(); it != sharers.end(); it++) {
         if (*it == rqstr) continue;
         MemEvent * inv;
         if (needFetch) {
@@ -1991,8 +1991,8 @@ bool MESIInternalDirectory::invalidateSharersExceptRequestor(CacheLine * cacheLi
         } else {
             inv = new MemEvent(parent, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Command::Inv);
         }
-        inv->setDst(*it);
-        inv->setRqstr(origRqstr);
+        inv->setDstID(*it);
+        inv->setRqstrID(origRqstr);
         inv->setSize(cacheLine->getSize());
 
         Response resp = {inv, deliveryTime, packetHeaderBytes};
@@ -2004,7 +2004,7 @@ bool MESIInternalDirectory::invalidateSharersExceptRequestor(CacheLine * cacheLi
         
         if (is_debug_addr(cacheLine->getBaseAddr())) {
             debug->debug(_L7_,"Sending inv: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-                cacheLine->getBaseAddr(), (*it).c_str(), deliveryTime);
+                cacheLine->getBaseAddr(), EndpointRegistry::getName(*it).c_str(), deliveryTime);
         }
     }
     if (sentInv) cacheLine->setTimestamp(deliveryTime);
@@ -2012,11 +2012,11 @@ bool MESIInternalDirectory::invalidateSharersExceptRequestor(CacheLine * cacheLi
 }
 
 
-void MESIInternalDirectory::sendFetchInv(CacheLine * cacheLine, string rqstr, bool replay) {
+void MESIInternalDirectory::sendFetchInv(CacheLine * cacheLine, EndpointID rqstr, bool replay) {
     MemEvent * fetch = new MemEvent(parent, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Command::FetchInv);
-    if (!(cacheLine->getOwner()).empty()) fetch->setDst(cacheLine->getOwner());
-    else fetch->setDst(*(cacheLine->getSharers()->begin()));
-    fetch->setRqstr(rqstr);
+    if (cacheLine->ownerExists()) fetch->setDstID(cacheLine->getOwner());
+    else fetch->setDstID(*(cacheLine->getSharers().begin()));
+    fetch->setRqstrID(rqstr);
     fetch->setSize(cacheLine->getSize());
     
     uint64_t baseTime = (timestamp_ > cacheLine->getTimestamp()) ? timestamp_ : cacheLine->getTimestamp();
@@ -2027,15 +2027,15 @@ void MESIInternalDirectory::sendFetchInv(CacheLine * cacheLine, string rqstr, bo
    
     if (is_debug_addr(cacheLine->getBaseAddr())) {
         debug->debug(_L7_, "Sending FetchInv: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-            cacheLine->getBaseAddr(), cacheLine->getOwner().c_str(), deliveryTime);
+            cacheLine->getBaseAddr(), EndpointRegistry::getName(cacheLine->getOwner()).c_str(), deliveryTime);
     }
 }
 
 
-void MESIInternalDirectory::sendFetchInvX(CacheLine * cacheLine, string rqstr, bool replay) {
+void MESIInternalDirectory::sendFetchInvX(CacheLine * cacheLine, EndpointID rqstr, bool replay) {
     MemEvent * fetch = new MemEvent(parent, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Command::FetchInvX);
-    fetch->setDst(cacheLine->getOwner());
-    fetch->setRqstr(rqstr);
+    fetch->setDstID(cacheLine->getOwner());
+    fetch->setRqstrID(rqstr);
     fetch->setSize(cacheLine->getSize());
     
     uint64_t baseTime = (timestamp_ > cacheLine->getTimestamp()) ? timestamp_ : cacheLine->getTimestamp();
@@ -2046,15 +2046,15 @@ void MESIInternalDirectory::sendFetchInvX(CacheLine * cacheLine, string rqstr, b
     
     if (is_debug_addr(cacheLine->getBaseAddr())) {
         debug->debug(_L7_, "Sending FetchInvX: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-            cacheLine->getBaseAddr(), cacheLine->getOwner().c_str(), deliveryTime);
+            cacheLine->getBaseAddr(), EndpointRegistry::getName(cacheLine->getOwner()).c_str(), deliveryTime);
     }
 }
 
 
-void MESIInternalDirectory::sendFetch(CacheLine * cacheLine, string rqstr, bool replay) {
+void MESIInternalDirectory::sendFetch(CacheLine * cacheLine, EndpointID rqstr, bool replay) {
     MemEvent * fetch = new MemEvent(parent, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Command::Fetch);
-    fetch->setDst(*((cacheLine->getSharers())->begin()));
-    fetch->setRqstr(rqstr);
+    fetch->setDstID(*(cacheLine->getSharers().begin()));
+    fetch->setRqstrID(rqstr);
     
     uint64_t baseTime = (timestamp_ > cacheLine->getTimestamp()) ? timestamp_ : cacheLine->getTimestamp();
     uint64_t deliveryTime = baseTime + tagLatency_;
@@ -2064,15 +2064,15 @@ void MESIInternalDirectory::sendFetch(CacheLine * cacheLine, string rqstr, bool
     
     if (is_debug_addr(cacheLine->getBaseAddr())) {
         debug->debug(_L7_, "Sending Fetch: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-            cacheLine->getBaseAddr(), cacheLine->getOwner().c_str(), deliveryTime);
+            cacheLine->getBaseAddr(), EndpointRegistry::getName(cacheLine->getOwner()).c_str(), deliveryTime);
     }
 }
 
 
-void MESIInternalDirectory::sendForceInv(CacheLine * cacheLine, string rqstr, bool replay) {
+void MESIInternalDirectory::sendForceInv(CacheLine * cacheLine, EndpointID rqstr, bool replay) {
     MemEvent * inv = new MemEvent(parent, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Command::ForceInv);
-    inv->setDst(cacheLine->getOwner());
-    inv->setRqstr(rqstr);
+    inv->setDstID(cacheLine->getOwner());
+    inv->setRqstrID(rqstr);
     inv->setSize(cacheLine->getSize());
 
     uint64_t baseTime = timestamp_ > cacheLine->getTimestamp() ? timestamp_ : cacheLine->getTimestamp();
@@ -2083,7 +2083,7 @@ void MESIInternalDirectory::sendForceInv(CacheLine * cacheLine, string rqstr, bo
     
     if (is_debug_addr(cacheLine->getBaseAddr())) {
         debug->debug(_L7_, "Sending ForceInv: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-            cacheLine->getBaseAddr(), cacheLine->getOwner().c_str(), deliveryTime);
+            cacheLine->getBaseAddr(), EndpointRegistry::getName(cacheLine->getOwner()).c_str(), deliveryTime);
     }
 }
 
@@ -2143,8 +2143,8 @@ void MESIInternalDirectory::sendAckInv(MemEvent * event) {
 
 void MESIInternalDirectory::sendWritebackAck(MemEvent * event) {
     MemEvent * ack = new MemEvent(parent, event->getBaseAddr(), event->getBaseAddr(), Command::AckPut);
-    ack->setDst(event->getSrc());
-    ack->setRqstr(event->getSrc());
+    ack->setDstID(event->getSrcID());
+    ack->setRqstrID(event->getSrcID());
     ack->setSize(event->getSize());
 
     uint64_t deliveryTime = timestamp_ + tagLatency_;
@@ -2191,7 +2191,7 @@ void MESIInternalDirectory::sendWritebackFromMSHR(Command cmd, CacheLine * dirLi
 void MESIInternalDirectory::sendFlushResponse(MemEvent * requestEvent, bool success) {
     MemEvent * flushResponse = requestEvent->makeResponse();
     flushResponse->setSuccess(success);
-    flushResponse->setDst(requestEvent->getSrc());
+    flushResponse->setDstID(requestEvent->getSrcID());
 
     uint64_t deliveryTime = timestamp_ + mshrLatency_;
     Response resp = {flushResponse, deliveryTime, packetHeaderBytes};
@@ -2208,7 +2208,7 @@ void MESIInternalDirectory::sendFlushResponse(MemEvent * requestEvent, bool succ
 void MESIInternalDirectory::forwardFlushLine(MemEvent * origFlush, CacheLine * dirLine, bool dirty, Command cmd) {
     MemEvent * flush = new MemEvent(parent, origFlush->getBaseAddr(), origFlush->getBaseAddr(), cmd);
     flush->setDst(getDestination(origFlush->getBaseAddr()));
-    flush->setRqstr(origFlush->getRqstr());
+    flush->setRqstrID(origFlush->getRqstrID());
     flush->setSize(lineSize_);
     uint64_t latency = tagLatency_;
     if (dirty) flush->setDirty(true);
@@ -809,16 +809,16 @@ private:
     void sendAckInv(MemEvent * event);
 
     /** Fetch data from owner and invalidate their copy of the line */
-    void sendFetchInv(CacheLine * dirLine, string rqstr, bool replay);
+    void sendFetchInv(CacheLine * dirLine, EndpointID rqstr, bool replay);
     
     /** Fetch data from owner and downgrade owner to sharer */
-    void sendFetchInvX(CacheLine * dirLine, string rqstr, bool replay);
+    void sendFetchInvX(CacheLine * dirLine, EndpointID rqstr, bool replay);
 
     /** Fetch data from sharer */
-    void sendFetch(CacheLine * dirLine, string rqstr, bool replay);
+    void sendFetch(CacheLine * dirLine, EndpointID rqstr, bool replay);
 
     /** Send ForceInv to owner */
-    void sendForceInv(CacheLine * dirLine, string rqstr, bool replay);
+    void sendForceInv(CacheLine * dirLine, EndpointID rqstr, bool replay);
 
     /** Send a flush response */
     void sendFlushResponse(MemEvent * reqEvent, bool success);
@@ -827,13 +827,13 @@ private:
     void forwardFlushLine(MemEvent * origFlush, CacheLine * dirLine, bool dirty, Command cmd);
 
     /** Invalidate all sharers of a block. Used for invalidations and evictions */
-    void invalidateAllSharers(CacheLine * dirLine, string rqstr, bool replay);
+    void invalidateAllSharers(CacheLine * dirLine, EndpointID rqstr, bool replay);
     
     /** Invalidate all sharers of a block and fetch block from one of them. Used for invalidations and evictions */
-    void invalidateAllSharersAndFetch(CacheLine * dirLine, string rqstr, bool replay);
+    void invalidateAllSharersAndFetch(CacheLine * dirLine, EndpointID rqstr, bool replay);
     
     /** Invalidate all sharers of a block except the requestor (rqstr). If requestor is not a sharer, may fetch data from a sharer. Used for upgrade requests. */
-    bool invalidateSharersExceptRequestor(CacheLine * dirLine, string rqstr, string origRqstr, bool replay, bool checkFetch);
+    bool invalidateSharersExceptRequestor(CacheLine * dirLine, EndpointID rqstr, EndpointID origRqstr, bool replay, bool checkFetch);
 
 
 /* Miscellaneous */
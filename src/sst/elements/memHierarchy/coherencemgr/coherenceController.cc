@@ -38,6 +38,8 @@ CoherenceController::CoherenceController(Component * comp, Params &params) : Sub
     /* Debug stream */
     debug = new Output("--->  ", params.find<int>("debug_level", 1), 0, (Output::output_location_t)params.find<int>("debug", SST::Output::NONE));
 
+    parentID_ = EndpointRegistry::intern(parent->getName());
+
     bool found;
 
     /* Get latency parameters */
@@ -123,7 +125,7 @@ uint64_t CoherenceController::sendResponseUp(MemEvent * event, vector<uint8_t>*
 /* Send response towards the CPU. L1s need to implement their own to split out the requested block */
 uint64_t CoherenceController::sendResponseUp(MemEvent * event, Command cmd, vector<uint8_t>* data, bool dirty, bool replay, uint64_t baseTime, bool atomic) {
     MemEvent * responseEvent = event->makeResponse(cmd);
-    responseEvent->setDst(event->getSrc());
+    responseEvent->setDstID(event->getSrcID());
     responseEvent->setSize(event->getSize());
     if (data != NULL) responseEvent->setPayload(*data);
     responseEvent->setDirty(dirty);
@@ -172,8 +174,8 @@ uint64_t CoherenceController::forwardMessage(MemEvent * event, Addr baseAddr, un
     
     if (data == NULL) forwardEvent->setPayload(0, NULL);
     
-    forwardEvent->setSrc(parent->getName());
-    forwardEvent->setDst(linkDown_->findTargetDestination(baseAddr));
+    forwardEvent->setSrcID(parentID_);
+    forwardEvent->setDstID(linkDown_->findTargetDestinationID(baseAddr));
     forwardEvent->setSize(requestSize);
 
     if (data != NULL) forwardEvent->setPayload(*data);
@@ -195,8 +197,8 @@ uint64_t CoherenceController::forwardMessage(MemEvent * event, Addr baseAddr, un
 }
 
 uint64_t CoherenceController::forwardTowardsMem(MemEventBase * event) {
-    event->setSrc(parent->getName());
-    event->setDst(linkDown_->findTargetDestination(event->getRoutingAddress()));
+    event->setSrcID(parentID_);
+    event->setDstID(linkDown_->findTargetDestinationID(event->getRoutingAddress()));
 
     Response fwdReq = {event, timestamp_ + 1, packetHeaderBytes + event->getPayloadSize()};
     addToOutgoingQueue(fwdReq);
@@ -204,8 +206,12 @@ uint64_t CoherenceController::forwardTowardsMem(MemEventBase * event) {
 }
 
 uint64_t CoherenceController::forwardTowardsCPU(MemEventBase * event, std::string dst) {
-    event->setSrc(parent->getName());
-    event->setDst(dst);
+    return forwardTowardsCPU(event, EndpointRegistry::intern(dst));
+}
+
+uint64_t CoherenceController::forwardTowardsCPU(MemEventBase * event, EndpointID dst) {
+    event->setSrcID(parentID_);
+    event->setDstID(dst);
 
     Response fwdReq = {event, timestamp_ + 1, packetHeaderBytes + event->getPayloadSize()};
     addToOutgoingQueueUp(fwdReq);
@@ -216,6 +222,10 @@ std::string CoherenceController::getSrc() {
     return linkUp_->getSources()->begin()->name;
 }
 
+EndpointID CoherenceController::getSrcID() {
+    return EndpointRegistry::intern(linkUp_->getSources()->begin()->name);
+}
+
 /**************************************/
 /******* Manage outgoing events *******/
 /**************************************/
@@ -240,7 +250,7 @@ bool CoherenceController::sendOutgoingCommands(SimTime_t curTime) {
             }
         }
         
-        outgoingEvent->setDst(linkDown_->findTargetDestination(outgoingEvent->getRoutingAddress()));
+        outgoingEvent->setDstID(linkDown_->findTargetDestinationID(outgoingEvent->getRoutingAddress()));
 
         if (is_debug_event(outgoingEvent)) {
             debug->debug(_L4_,"SEND (%s). time: (%" PRIu64 ", %" PRIu64 ") event: (%s)\n",
@@ -37,6 +37,8 @@ class CoherenceController : public SST::SubComponent {
 
 public:
     typedef CacheArray::CacheLine CacheLine;
+    typedef CacheArray::SharerList SharerList;
+    typedef CacheArray::SharerIterator SharerIterator;
 
     /***** Constructor & destructor *****/
     CoherenceController(Component * comp, Params &params);
@@ -93,10 +95,14 @@ public:
 
     /* Forward a generic message towards CPU */
     uint64_t forwardTowardsCPU(MemEventBase * event, std::string dst);
+    uint64_t forwardTowardsCPU(MemEventBase * event, EndpointID dst);
 
     /* Return the name of the source for this cache */
     std::string getSrc();
     
+    /* Return the interned name of the source for this cache */
+    EndpointID getSrcID();
+    
     /* Return the destination for a given address - for sliced/distributed caches */
     std::string getDestination(Addr addr) { return linkDown_->findTargetDestination(addr); }
     
@@ -166,6 +172,7 @@ protected:
 
     /* General parameters and structures */
     unsigned int lineSize_;
+    EndpointID parentID_;     // Interned name of the cache that owns this controller
 
     /* Throughput control TODO move these to a port manager */
     uint64_t maxBytesUp;
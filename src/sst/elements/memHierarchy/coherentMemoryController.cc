@@ -340,7 +340,7 @@ void CoherentMemController::handleFetchResp(MemEvent * ev) {
     // Write dirty data if needed
     if (ev->getDirty()) {
         MemEvent * write = new MemEvent(this, ev->getAddr(), baseAddr, Command::PutM, ev->getPayload());
-        write->setRqstr(ev->getRqstr());
+        write->setRqstrID(ev->getRqstrID());
         ev->setFlag(MemEvent::F_NORESPONSE);
 
         entry->writebacks.insert(write->getID());
@@ -433,8 +433,8 @@ bool CoherentMemController::doShootdown(Addr addr, MemEventBase * ev) {
     if (cacheStatus_.at(addr/lineSize_) == true) {
         Addr globalAddr = translateToGlobal(addr);
         MemEvent * inv = new MemEvent(this, globalAddr, globalAddr, Command::FetchInv, lineSize_);
-        inv->setRqstr(ev->getRqstr());
-        inv->setDst(ev->getSrc());
+        inv->setRqstrID(ev->getRqstrID());
+        inv->setDstID(ev->getSrcID());
 
         msgQueue_.insert(std::make_pair(timestamp_, inv)); /* Send on next clock. TODO timing needed? */
         return true;
@@ -77,6 +77,8 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     
     entryCacheMaxSize = params.find<size_t>("entry_cache_size", 32768);
     entryCacheSize = 0;
+    entryCacheHead = nullptr;
+    entryCacheTail = nullptr;
     std::string net_bw = params.find<std::string>("network_bw", "80GiB/s");
 
     // These are technically nic params and we're borrowing them
@@ -197,6 +199,8 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
             memLink = NULL;
 
         }
+    memoryID = EndpointRegistry::intern(memoryName);
+    nameID = EndpointRegistry::intern(getName());
 
     free(node_buffer1);
     free(node_buffer2);
@@ -243,6 +247,11 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     stat_GetSRespSent               = registerStatistic<uint64_t>("responses_sent_GetSResp");
     stat_GetXRespSent               = registerStatistic<uint64_t>("responses_sent_GetXResp");
     stat_MSHROccupancy              = registerStatistic<uint64_t>("MSHR_occupancy");
+    stat_MSHRProbeLength            = registerStatistic<uint64_t>("MSHR_probe_length");
+    mshr->setProbeLengthStatistic(stat_MSHRProbeLength);
+    stat_EventPoolAllocations       = registerStatistic<uint64_t>("EventPool_allocations");
+    stat_EventPoolHeapAllocations   = registerStatistic<uint64_t>("EventPool_heap_allocations");
+    stat_EventPoolReleases          = registerStatistic<uint64_t>("EventPool_releases");
     stat_NoncacheReceived           = registerStatistic<uint64_t>("requests_received_noncacheable");
     stat_CustomReceived             = registerStatistic<uint64_t>("requests_received_custom");
 
@@ -251,10 +260,7 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
 
 
 DirectoryController::~DirectoryController(){
-    for(std::unordered_map<Addr, DirEntry*>::iterator i = directory.begin(); i != directory.end() ; ++i){
-        delete i->second;
-    }
-    directory.clear();
+    directory.clear();  // Entries are freed with entryPool
     
     while(workQueue.size()){
         MemEvent *front = workQueue.front();
@@ -266,6 +272,7 @@ DirectoryController::~DirectoryController(){
 
 
 void DirectoryController::handlePacket(SST::Event *event){
+    MemEventPoolScope<Statistic<uint64_t> > poolScope(stat_EventPoolAllocations, stat_EventPoolHeapAllocations, stat_EventPoolReleases);
     MemEventBase *evb = static_cast<MemEventBase*>(event);
     evb->setDeliveryTime(getCurrentSimTimeNano());
      
@@ -424,6 +431,7 @@ inline void DirectoryController::profileResponseRecv(MemEvent * event) {
  *  Called each cycle. Handle any waiting events in the queue.
  */
 bool DirectoryController::clock(SST::Cycle_t cycle){
+    MemEventPoolScope<Statistic<uint64_t> > poolScope(stat_EventPoolAllocations, stat_EventPoolHeapAllocations, stat_EventPoolReleases);
     timestamp++;
     stat_MSHROccupancy->addData(mshr->getSize());
 
@@ -538,15 +546,15 @@ void DirectoryController::processPacket(MemEvent * ev, bool replay) {
 
 void DirectoryController::handleNoncacheableRequest(MemEventBase * ev) {
     if (!(ev->queryFlag(MemEventBase::F_NORESPONSE))) {
-        noncacheMemReqs[ev->getID()] = ev->getSrc();
+        noncacheMemReqs[ev->getID()] = ev->getSrcID();
     }
     stat_NoncacheReceived->addData(1);
 
     if (ev->getCmd() == Command::CustomReq)
         stat_CustomReceived->addData(1);
 
-    ev->setSrc(getName());
-    ev->setDst(memoryName);
+    ev->setSrcID(nameID);
+    ev->setDstID(memoryID);
         
     sendEventToMem(ev);
     return;
@@ -558,8 +566,8 @@ void DirectoryController::handleNoncacheableResponse(MemEventBase * ev) {
         dbg.fatal(CALL_INFO, -1, "%s, Error: Received a noncacheable response that does not match a pending request. Event: %s\n. Time: %" PRIu64 "ns\n", 
                 getName().c_str(), ev->getVerboseString().c_str(), getCurrentSimTimeNano());
     }
-    ev->setDst(noncacheMemReqs[ev->getID()]);
-    ev->setSrc(getName());
+    ev->setDstID(noncacheMemReqs[ev->getID()]);
+    ev->setSrcID(nameID);
 
     noncacheMemReqs.erase(ev->getID());
 
@@ -653,14 +661,14 @@ void DirectoryController::handleGetX(MemEvent * ev, bool replay) {
             issueMemoryRequest(ev, entry);
             break;
         case S:
-            if (entry->getSharerCount() == 1 && entry->isSharer(node_id(ev->getSrc()))) {   // Special case: upgrade
+            if (entry->getSharerCount() == 1 && entry->isSharer(node_id(ev->getSrcID()))) {   // Special case: upgrade
                 mshr->removeFront(ev->getBaseAddr());
                 
                 if (is_debug_event(ev)) dbg.debug(_L10_, "\t%s\tMSHR remove event <%s, %" PRIx64 ">\n", getName().c_str(), CommandString[(int)ev->getCmd()], ev->getBaseAddr());
                 
                 entry->setState(M);
-                entry->removeSharer(node_name_to_id(ev->getSrc()));
-                entry->setOwner(node_name_to_id(ev->getSrc()));
+                entry->removeSharer(node_name_to_id(ev->getSrcID()));
+                entry->setOwner(node_name_to_id(ev->getSrcID()));
                 respEv = ev->makeResponse();
                 respEv->setSize(cacheLineSize);
                 profileResponseSent(respEv);
@@ -694,7 +702,7 @@ void DirectoryController::handleGetX(MemEvent * ev, bool replay) {
 void DirectoryController::handlePutS(MemEvent * ev) {
     DirEntry * entry = getDirEntry(ev->getBaseAddr());
 
-    entry->removeSharer(node_name_to_id(ev->getSrc()));
+    entry->removeSharer(node_name_to_id(ev->getSrcID()));
     if (mshr->elementIsHit(ev->getBaseAddr(), ev)) mshr->removeElement(ev->getBaseAddr(), ev);
     
     State state = entry->getState();
@@ -738,7 +746,7 @@ void DirectoryController::handlePutE(MemEvent * ev) {
     DirEntry * entry = getDirEntry(ev->getBaseAddr());
     
     /* Error checking */
-    if (!((uint32_t)entry->getOwner() == node_name_to_id(ev->getSrc()))) {
+    if (!((uint32_t)entry->getOwner() == node_name_to_id(ev->getSrcID()))) {
 	dbg.fatal(CALL_INFO, -1, "%s, Error: received PutE from a node who does not own the block. Event = %s. Time = %" PRIu64 "ns\n",
                 getName().c_str(), ev->getVerboseString().c_str(), getCurrentSimTimeNano());
     }
@@ -801,7 +809,7 @@ void DirectoryController::handlePutM(MemEvent * ev) {
     DirEntry * entry = getDirEntry(ev->getBaseAddr());
     
     /* Error checking */
-    if (!((uint32_t)entry->getOwner() == node_name_to_id(ev->getSrc()))) {
+    if (!((uint32_t)entry->getOwner() == node_name_to_id(ev->getSrcID()))) {
 	dbg.fatal(CALL_INFO, -1, "%s, Error: received PutM from a node who does not own the block. Addr = 0x%" PRIx64 ", Cmd = %s, Src = %s. Time = %" PRIu64 "ns\n",
                 getName().c_str(), ev->getBaseAddr(), CommandString[(int)ev->getCmd()], ev->getSrc().c_str(), getCurrentSimTimeNano());
     }
@@ -870,7 +878,7 @@ void DirectoryController::handleFlushLine(MemEvent * ev) {
     bool inMSHR = mshr->elementIsHit(ev->getBaseAddr(), ev);
     bool mshrConflict = !inMSHR && mshr->isHit(ev->getBaseAddr());
 
-    int srcID = node_id(ev->getSrc());
+    int srcID = node_id(ev->getSrcID());
     State state = entry->getState();
 
     switch(state) {
@@ -975,7 +983,7 @@ void DirectoryController::handleFlushLineInv(MemEvent * ev) {
     bool inMSHR = mshr->elementIsHit(ev->getBaseAddr(), ev);
     bool mshrConflict = !inMSHR && mshr->isHit(ev->getBaseAddr());
 
-    int srcID = node_id(ev->getSrc());
+    int srcID = node_id(ev->getSrcID());
     State state = entry->getState();
 
     switch (state) {
@@ -1075,7 +1083,7 @@ void DirectoryController::handleFetchResp(MemEvent * ev, bool keepEvent) {
     if (is_debug_event(ev)) dbg.debug(_L4_, "Finishing Fetch for reqEv = %s.\n", reqEv->getBriefString().c_str());
     
     /* Error checking */
-    if (!((uint32_t)entry->getOwner() == node_name_to_id(ev->getSrc()))) {
+    if (!((uint32_t)entry->getOwner() == node_name_to_id(ev->getSrcID()))) {
 	dbg.fatal(CALL_INFO, -1, "%s, Error: received FetchResp from a node who does not own the block. Addr = 0x%" PRIx64 ", Cmd = %s, Src = %s. Time = %" PRIu64 "ns, %" PRIu64 " cycles\n",
                 getName().c_str(), ev->getBaseAddr(), CommandString[(int)ev->getCmd()], ev->getSrc().c_str(), getCurrentSimTimeNano(), timestamp);
     }
@@ -1094,7 +1102,7 @@ void DirectoryController::handleFetchResp(MemEvent * ev, bool keepEvent) {
         case M_Inv:
             if (reqEv->getCmd() != Command::FetchInv && reqEv->getCmd() != Command::ForceInv) { // GetX request, not back invalidation
                 writebackData(ev, Command::PutM);
-                entry->setOwner(node_id(reqEv->getSrc()));
+                entry->setOwner(node_id(reqEv->getSrcID()));
                 entry->setState(M);
             } else entry->setState(I);
             respEv = reqEv->makeResponse();
@@ -1107,11 +1115,11 @@ void DirectoryController::handleFetchResp(MemEvent * ev, bool keepEvent) {
             }
             writebackData(ev, Command::PutM);
             if (protocol == CoherenceProtocol::MESI && entry->getSharerCount() == 0) {
-                entry->setOwner(node_id(reqEv->getSrc()));
+                entry->setOwner(node_id(reqEv->getSrcID()));
                 respEv = reqEv->makeResponse(Command::GetXResp);
                 entry->setState(M);
             } else {
-                entry->addSharer(node_id(reqEv->getSrc()));
+                entry->addSharer(node_id(reqEv->getSrcID()));
                 respEv = reqEv->makeResponse();
                 entry->setState(S);
             }
@@ -1143,7 +1151,7 @@ void DirectoryController::handleFetchXResp(MemEvent * ev, bool keepEvent) {
     MemEvent * reqEv = mshr->removeFront(ev->getBaseAddr());
     
     /* Error checking */
-    if (!((uint32_t)entry->getOwner() == node_name_to_id(ev->getSrc()))) {
+    if (!((uint32_t)entry->getOwner() == node_name_to_id(ev->getSrcID()))) {
 	dbg.fatal(CALL_INFO, -1, "%s, Error: received FetchResp from a node who does not own the block. Event = %s. Time = %" PRIu64 "ns, %" PRIu64 " cycles\n",
                 getName().c_str(), ev->getVerboseString().c_str(), getCurrentSimTimeNano(), timestamp );
     }
@@ -1153,12 +1161,12 @@ void DirectoryController::handleFetchXResp(MemEvent * ev, bool keepEvent) {
 
     /* Clear previous owner state and writeback block. */
     entry->clearOwner();
-    entry->addSharer(node_name_to_id(ev->getSrc()));
+    entry->addSharer(node_name_to_id(ev->getSrcID()));
     entry->setState(S);
     if (ev->getDirty()) writebackData(ev, Command::PutM);
 
     MemEvent * respEv = reqEv->makeResponse(); 
-    entry->addSharer(node_id(reqEv->getSrc()));
+    entry->addSharer(node_id(reqEv->getSrcID()));
     
     respEv->setPayload(ev->getPayload());
     profileResponseSent(respEv);
@@ -1177,9 +1185,9 @@ void DirectoryController::handleFetchXResp(MemEvent * ev, bool keepEvent) {
 void DirectoryController::handleAckInv(MemEvent * ev) {
     DirEntry * entry = getDirEntry(ev->getBaseAddr());
 
-    if (entry->isSharer(node_id(ev->getSrc())))
-        entry->removeSharer(node_name_to_id(ev->getSrc()));
-    if ((uint32_t)entry->getOwner() == node_name_to_id(ev->getSrc()))
+    if (entry->isSharer(node_id(ev->getSrcID())))
+        entry->removeSharer(node_name_to_id(ev->getSrcID()));
+    if ((uint32_t)entry->getOwner() == node_name_to_id(ev->getSrcID()))
         entry->clearOwner();
     
     if (mshr->elementIsHit(ev->getBaseAddr(), ev)) mshr->removeElement(ev->getBaseAddr(), ev);
@@ -1269,7 +1277,7 @@ void DirectoryController::handleBackInv(MemEvent* ev) {
         case IS:
         case IM:
             respEv = ev->makeResponse(Command::AckInv);
-            respEv->setDst(memoryName);
+            respEv->setDstID(memoryID);
             memMsgQueue.insert(std::make_pair(timestamp + accessLatency, respEv));
             if (mshr->elementIsHit(ev->getBaseAddr(), ev)) mshr->removeElement(ev->getBaseAddr(), ev);
             if (!noreplay) replayWaitingEvents(entry->getBaseAddr());
@@ -1328,6 +1336,7 @@ void DirectoryController::handleNACK(MemEvent * ev) {
 
 /* Memory response handler - calls handler for each event from memory */
 void DirectoryController::handleMemoryResponse(SST::Event *event){
+    MemEventPoolScope<Statistic<uint64_t> > poolScope(stat_EventPoolAllocations, stat_EventPoolHeapAllocations, stat_EventPoolReleases);
     MemEvent *ev = static_cast<MemEvent*>(event);
     
     if (is_debug_event(ev)) {
@@ -1341,8 +1350,8 @@ void DirectoryController::handleMemoryResponse(SST::Event *event){
     
     if (ev->queryFlag(MemEvent::F_NONCACHEABLE)) {
         if (noncacheMemReqs.find(ev->getResponseToID()) != noncacheMemReqs.end()) {
-            ev->setDst(noncacheMemReqs[ev->getResponseToID()]);
-            ev->setSrc(getName());
+            ev->setDstID(noncacheMemReqs[ev->getResponseToID()]);
+            ev->setSrcID(nameID);
             
             noncacheMemReqs.erase(ev->getResponseToID());
             profileResponseSent(ev);
@@ -1399,18 +1408,18 @@ void DirectoryController::handleDataResponse(MemEvent * ev) {
             if (protocol == CoherenceProtocol::MESI && entry->getSharerCount() == 0) {
                 respEv = reqEv->makeResponse(Command::GetXResp);
                 entry->setState(M);
-                entry->setOwner(node_id(reqEv->getSrc()));
+                entry->setOwner(node_id(reqEv->getSrcID()));
             } else {
                 respEv = reqEv->makeResponse();
                 entry->setState(S);
-                entry->addSharer(node_id(reqEv->getSrc()));
+                entry->addSharer(node_id(reqEv->getSrcID()));
             }
             break;
         case IM:
         case SM:
             respEv = reqEv->makeResponse();
             entry->setState(M);
-            entry->setOwner(node_id(reqEv->getSrc()));
+            entry->setOwner(node_id(reqEv->getSrcID()));
             entry->clearSharers();  // Case SM: new owner was a sharer
             break;
         default:
@@ -1443,8 +1452,8 @@ void DirectoryController::handleFlushLineResponse(MemEvent * ev) {
     reqEv->setMemFlags(ev->getMemFlags()); // Copy anything back up that needs to be
     
     MemEvent * me = reqEv->makeResponse();
-    me->setDst(reqEv->getSrc());
-    me->setRqstr(reqEv->getRqstr());
+    me->setDstID(reqEv->getSrcID());
+    me->setRqstrID(reqEv->getRqstrID());
     me->setSuccess(ev->queryFlag(MemEvent::F_SUCCESS));
     me->setMemFlags(reqEv->getMemFlags());
 
@@ -1492,13 +1501,11 @@ void DirectoryController::handleDirEntryMemoryResponse(MemEvent * ev) {
 
 
 void DirectoryController::issueInvalidates(MemEvent * ev, DirEntry * entry, Command cmd) {
-    uint32_t rqst_id = node_id(ev->getSrc());
-    for (uint32_t i = 0; i < numTargets; i++) {
+    int rqst_id = node_id(ev->getSrcID());
+    for (int i = entry->nextSharer(0); i != -1; i = entry->nextSharer(i + 1)) {
         if (i == rqst_id) continue;
-        if (entry->isSharer(i)) {
-            sendInvalidate(i, ev, entry, cmd);
-            entry->incrementWaitingAcks();
-        }
+        sendInvalidate(i, ev, entry, cmd);
+        entry->incrementWaitingAcks();
     }
     entry->lastRequest = DirEntry::NO_LAST_REQUEST;
     
@@ -1508,7 +1515,7 @@ void DirectoryController::issueInvalidates(MemEvent * ev, DirEntry * entry, Comm
 /* Send Fetch to owner */
 void DirectoryController::issueFetch(MemEvent * ev, DirEntry * entry, Command cmd) {
     MemEvent * fetch = new MemEvent(this, ev->getAddr(), ev->getBaseAddr(), cmd, cacheLineSize);
-    fetch->setDst(nodeid_to_name[entry->getOwner()]);
+    fetch->setDstID(nodeid_to_name[entry->getOwner()]);
     entry->lastRequest = fetch->getID();
     profileRequestSent(fetch);
     sendEventToCaches(fetch, timestamp + accessLatency);
@@ -1517,8 +1524,8 @@ void DirectoryController::issueFetch(MemEvent * ev, DirEntry * entry, Command cm
 /* Send Get* request to memory */
 void DirectoryController::issueMemoryRequest(MemEvent * ev, DirEntry * entry) {
     MemEvent *reqEv         = new MemEvent(*ev);
-    reqEv->setSrc(getName());
-    reqEv->setDst(memoryName);
+    reqEv->setSrcID(nameID);
+    reqEv->setDstID(memoryID);
     memReqs[reqEv->getID()] = ev->getBaseAddr();
     profileRequestSent(reqEv);
     
@@ -1567,7 +1574,7 @@ void DirectoryController::getDirEntryFromMemory(DirEntry * entry) {
     MemEvent *me         = new MemEvent(this, entryAddr, entryAddr, Command::GetS, cacheLineSize);
     me->setAddrGlobal(false);
     me->setSize(entrySize);
-    me->setDst(memoryName);
+    me->setDstID(memoryID);
     dirEntryMiss[me->getID()] = entry->getBaseAddr();
     profileRequestSent(me);
     
@@ -1613,8 +1620,8 @@ void DirectoryController::printStatus(Output &statusOut) {
     }
 
     statusOut.output("  Directory entries:\n");
-    for (std::unordered_map<Addr, DirEntry*>::iterator it = directory.begin(); it != directory.end(); it++) {
-        statusOut.output("    0x%" PRIx64 " %s\n", it->first, it->second->getString().c_str());
+    for (AddrHashMap<DirEntry*>::iterator it = directory.begin(); it != directory.end(); ++it) {
+        statusOut.output("    0x%" PRIx64 " %s\n", it.key(), it.value()->getString().c_str());
     }
     statusOut.output("End MemHierarchy::DirectoryController\n\n");
 }
@@ -1625,15 +1632,14 @@ void DirectoryController::emergencyShutdown() {
 
 
 DirectoryController::DirEntry* DirectoryController::getDirEntry(Addr baseAddr){
-    std::unordered_map<Addr,DirEntry*>::iterator i = directory.find(baseAddr);
+    DirEntry ** slot = directory.find(baseAddr);
     DirEntry *entry;
-    if (directory.end() == i) {
-        entry = new DirEntry(baseAddr, numTargets, &dbg);
-        entry->cacheIter = entryCache.end();
-        directory[baseAddr] = entry;
+    if (slot == nullptr) {
+        entry = entryPool.allocate(baseAddr, &dbg);
+        directory.insert(baseAddr, entry);
         entry->setCached(true);   // TODO fix this so new entries go to memory if we're caching, little bit o cheatin here
     } else {
-        entry = i->second;
+        entry = *slot;
     }
     return entry;
 }
@@ -1641,10 +1647,10 @@ DirectoryController::DirEntry* DirectoryController::getDirEntry(Addr baseAddr){
 
 void DirectoryController::sendInvalidate(int target, MemEvent * reqEv, DirEntry* entry, Command cmd){
     MemEvent *me = new MemEvent(this, entry->getBaseAddr(), entry->getBaseAddr(), cmd, cacheLineSize);
-    me->setDst(nodeid_to_name[target]);
-    me->setRqstr(reqEv->getRqstr());
+    me->setDstID(nodeid_to_name[target]);
+    me->setRqstrID(reqEv->getRqstrID());
     
-    if (is_debug_event(reqEv)) dbg.debug(_L4_, "Sending Invalidate.  Dst: %s\n", nodeid_to_name[target].c_str());
+    if (is_debug_event(reqEv)) dbg.debug(_L4_, "Sending Invalidate.  Dst: %s\n", EndpointRegistry::getName(nodeid_to_name[target]).c_str());
     profileRequestSent(me);
     
     uint64_t deliveryTime = timestamp + accessLatency;
@@ -1653,8 +1659,8 @@ void DirectoryController::sendInvalidate(int target, MemEvent * reqEv, DirEntry*
 
 void DirectoryController::sendAckPut(MemEvent * event) {
     MemEvent * me = event->makeResponse(Command::AckPut);
-    me->setDst(event->getSrc());
-    me->setRqstr(event->getRqstr());
+    me->setDstID(event->getSrcID());
+    me->setRqstrID(event->getRqstrID());
     me->setPayload(0, nullptr);
     me->setSize(cacheLineSize);
 
@@ -1668,7 +1674,7 @@ void DirectoryController::sendAckPut(MemEvent * event) {
 
 void DirectoryController::forwardFlushRequest(MemEvent * event) {
     MemEvent *reqEv     = new MemEvent(this, event->getAddr(), event->getBaseAddr(), Command::FlushLine, cacheLineSize);
-    reqEv->setRqstr(event->getRqstr());
+    reqEv->setRqstrID(event->getRqstrID());
     reqEv->setVirtualAddress(event->getVirtualAddress());
     reqEv->setInstructionPointer(event->getInstructionPointer());
     reqEv->setMemFlags(event->getMemFlags());
@@ -1677,7 +1683,7 @@ void DirectoryController::forwardFlushRequest(MemEvent * event) {
     
 
     uint64_t deliveryTime = timestamp + accessLatency;
-    reqEv->setDst(memoryName);
+    reqEv->setDstID(memoryID);
 
     memMsgQueue.insert(std::make_pair(deliveryTime, reqEv));
     
@@ -1687,9 +1693,9 @@ void DirectoryController::forwardFlushRequest(MemEvent * event) {
     }
 }
 
-uint32_t DirectoryController::node_id(const std::string &name){
+uint32_t DirectoryController::node_id(EndpointID name){
 	uint32_t id;
-	std::map<std::string, uint32_t>::iterator i = node_lookup.find(name);
+	std::unordered_map<EndpointID, uint32_t>::iterator i = node_lookup.find(name);
 	if(node_lookup.end() == i){
 		node_lookup[name] = id = targetCount++;
         nodeid_to_name.resize(targetCount);
@@ -1702,12 +1708,12 @@ uint32_t DirectoryController::node_id(const std::string &name){
 
 
 
-uint32_t DirectoryController::node_name_to_id(const std::string &name){
-    std::map<std::string, uint32_t>::iterator i = node_lookup.find(name);
+uint32_t DirectoryController::node_name_to_id(EndpointID name){
+    std::unordered_map<EndpointID, uint32_t>::iterator i = node_lookup.find(name);
 
     if(node_lookup.end() == i) {
 	dbg.fatal(CALL_INFO, -1, "%s, Error: Attempt to lookup node ID but name not found: %s. Time = %" PRIu64 "ns\n", 
-                getName().c_str(), name.c_str(), getCurrentSimTimeNano());
+                getName().c_str(), EndpointRegistry::getName(name).c_str(), getCurrentSimTimeNano());
     }
 
     uint32_t id = i->second;
@@ -1719,10 +1725,8 @@ void DirectoryController::updateCache(DirEntry *entry){
         sendEntryToMemory(entry);
     } else {
         /* Find if we're in the cache */
-        if(entry->cacheIter != entryCache.end()){
-            entryCache.erase(entry->cacheIter);
-            --entryCacheSize;
-            entry->cacheIter = entryCache.end();
+        if(entry->inEntryCache){
+            entryCacheRemove(entry);
         }
 
         /* Find out if we're no longer cached, and just remove */
@@ -1730,23 +1734,19 @@ void DirectoryController::updateCache(DirEntry *entry){
             if (is_debug_addr(entry->getBaseAddr())) dbg.debug(_L10_, "Entry for 0x%" PRIx64 " has no references - purging\n", entry->getBaseAddr());
             
             directory.erase(entry->getBaseAddr());
-            delete entry;
+            entryPool.release(entry);
             return;
         } else {
-            entryCache.push_front(entry);
-            entry->cacheIter = entryCache.begin();
-            ++entryCacheSize;
+            entryCachePushFront(entry);
 
             while(entryCacheSize > entryCacheMaxSize){
-                DirEntry *oldEntry = entryCache.back();
+                DirEntry *oldEntry = entryCacheTail;
                 // If the oldest entry is still in progress, everything is in progress
                 if(mshr->isHit(oldEntry->getBaseAddr())) break;
 
                 if (is_debug_addr(entry->getBaseAddr())) dbg.debug(_L10_, "entryCache too large.  Evicting entry for 0x%" PRIx64 "\n", oldEntry->getBaseAddr());
                 
-                entryCache.pop_back();
-                --entryCacheSize;
-                oldEntry->cacheIter = entryCache.end();
+                entryCacheRemove(oldEntry);
                 oldEntry->setCached(false);
                 sendEntryToMemory(oldEntry);
             }
@@ -1756,6 +1756,27 @@ void DirectoryController::updateCache(DirEntry *entry){
 
 
 
+void DirectoryController::entryCachePushFront(DirEntry *entry){
+    entry->lruPrev = nullptr;
+    entry->lruNext = entryCacheHead;
+    if (entryCacheHead) entryCacheHead->lruPrev = entry;
+    else entryCacheTail = entry;
+    entryCacheHead = entry;
+    entry->inEntryCache = true;
+    ++entryCacheSize;
+}
+
+void DirectoryController::entryCacheRemove(DirEntry *entry){
+    if (entry->lruPrev) entry->lruPrev->lruNext = entry->lruNext;
+    else entryCacheHead = entry->lruNext;
+    if (entry->lruNext) entry->lruNext->lruPrev = entry->lruPrev;
+    else entryCacheTail = entry->lruPrev;
+    entry->lruPrev = nullptr;
+    entry->lruNext = nullptr;
+    entry->inEntryCache = false;
+    --entryCacheSize;
+}
+
 void DirectoryController::sendEntryToMemory(DirEntry *entry){
     Addr entryAddr = 0; // Always use local address 0 for directory entries
     MemEvent *me   = new MemEvent(this, entryAddr, entryAddr, Command::PutE, cacheLineSize); // MemController discards PutE's without writeback so this is safe
@@ -1763,7 +1784,7 @@ void DirectoryController::sendEntryToMemory(DirEntry *entry){
     profileRequestSent(me);
 
     uint64_t deliveryTime = timestamp + accessLatency;
-    me->setDst(memoryName);
+    me->setDstID(memoryID);
 
     memMsgQueue.insert(std::make_pair(deliveryTime, me));
 }
@@ -1780,7 +1801,7 @@ MemEvent::id_type DirectoryController::writebackData(MemEvent *data_event, Comma
 
     ev->setSize(data_event->getPayload().size());
     ev->setPayload(data_event->getPayload());
-    ev->setDst(memoryName);
+    ev->setDstID(memoryID);
     profileRequestSent(ev);
     
     /* We will get a response if this is a flush request or if we are talking to an endpoint that sends WB Acks */
@@ -1877,7 +1898,7 @@ const char* DirectoryController::printDirectoryEntryStatus(Addr baseAddr){
         if(0 == refs) sprintf(dirEntStatus, "[Noncacheable]");
         else if(entry->isDirty()){
             uint32_t owner = entry->findOwner();
-            sprintf(dirEntStatus, "[owned by %s]", nodeid_to_name[owner].c_str());
+            sprintf(dirEntStatus, "[owned by %s]", EndpointRegistry::getName(nodeid_to_name[owner]).c_str());
         }
         else sprintf(dirEntStatus, "[Shared by %u]", refs);
 
@@ -1900,7 +1921,7 @@ void DirectoryController::init(unsigned int phase) {
         // Push our region to memory (backward compatibility)
         if (!memLink) {
             MemEventInitRegion * reg = new MemEventInitRegion(getName(), network->getRegion(), true);
-            reg->setDst(memoryName);
+            reg->setDstID(memoryID);
             network->sendInitData(reg);
         } else {
             MemEventInitRegion * reg = new MemEventInitRegion(getName(), memLink->getRegion(), true);
@@ -1935,7 +1956,7 @@ void DirectoryController::init(unsigned int phase) {
             dbg.debug(_L10_, "Found Init Info for address 0x%" PRIx64 "\n", ev->getAddr());
             if (isRequestAddressValid(ev->getAddr())){
                 dbg.debug(_L10_, "Sending Init Data for address 0x%" PRIx64 " to memory\n", ev->getAddr());
-                ev->setDst(memoryName);
+                ev->setDstID(memoryID);
                 if (memLink) {
                     memLink->sendInitData(ev);
                 } else {
@@ -1978,5 +1999,6 @@ void DirectoryController::setup(void){
     if(0 == numTargets) dbg.fatal(CALL_INFO,-1,"%s, Error: Did not find any caches during init\n",getName().c_str());
 
     entrySize = (numTargets+1)/8 +1;
+    entryPool.setSharerCount(numTargets);
 }
 
@@ -37,6 +37,7 @@
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/mshr.h"
+#include "sst/elements/memHierarchy/addrHashMap.h"
 
 using namespace std;
 
@@ -111,7 +112,11 @@ public:
             {"responses_sent_NACK",             "Number of NACK responses sent to LLCs",                                            "responses",    1},
             {"responses_sent_GetSResp",         "Number of GetSResp (data response to GetS or GetSX) responses sent to LLCs",       "responses",    1},
             {"responses_sent_GetXResp",         "Number of GetXResp (data response to GetX) responses sent to LLCs",                "responses",    1},
-            {"MSHR_occupancy",                  "Number of events in MSHR each cycle",                                  "events",       1} )
+            {"MSHR_occupancy",                  "Number of events in MSHR each cycle",                                  "events",       1},
+            {"MSHR_probe_length",               "Number of MSHR table slots examined per MSHR lookup",                  "count",        10},
+            {"EventPool_allocations",           "Number of memory events allocated while this directory was handling events", "events", 10},
+            {"EventPool_heap_allocations",      "Number of memory event allocations that could not be satisfied from the event pool", "events", 10},
+            {"EventPool_releases",              "Number of memory events freed back to the event pool while this directory was handling events", "events", 10} )
 
 /* Begin class definition */
 private:
@@ -189,23 +194,30 @@ private:
     Statistic<uint64_t> * stat_GetSRespSent;
     Statistic<uint64_t> * stat_GetXRespSent;
     Statistic<uint64_t> * stat_MSHROccupancy;
+    Statistic<uint64_t> * stat_MSHRProbeLength;
+    Statistic<uint64_t> * stat_EventPoolAllocations;
+    Statistic<uint64_t> * stat_EventPoolHeapAllocations;
+    Statistic<uint64_t> * stat_EventPoolReleases;
 
     /* Directory structures */
-    std::list<DirEntry*>                    entryCache;
-    std::unordered_map<Addr,DirEntry*>      directory;
-    std::map<std::string,uint32_t>          node_lookup;
-    std::vector<std::string>                nodeid_to_name;
+    DirEntry *                              entryCacheHead; // Most recently used cached entry
+    DirEntry *                              entryCacheTail; // Least recently used cached entry
+    AddrHashMap<DirEntry*>                  directory;
+    std::unordered_map<EndpointID,uint32_t> node_lookup;
+    std::vector<EndpointID>                 nodeid_to_name;
     
     /* Queue of packets to work on */
     std::list<MemEvent*>                    workQueue;
     std::map<MemEvent::id_type, Addr>       memReqs;
     std::map<MemEvent::id_type, Addr>       dirEntryMiss;
-    std::map<MemEvent::id_type, std::string> noncacheMemReqs;
+    std::map<MemEvent::id_type, EndpointID> noncacheMemReqs;
 
     /* Network connections */
     MemLink*    memLink;
     MemNIC*     network;
     string      memoryName; // if connected to mem via network, this should be the name of the memory we own - param is memory_name
+    EndpointID  memoryID;   // interned memoryName
+    EndpointID  nameID;     // interned getName()
     
     std::multimap<uint64_t,MemEventBase*>   netMsgQueue;
     std::multimap<uint64_t,MemEventBase*>   memMsgQueue;
@@ -288,16 +300,20 @@ private:
     void mshrNACKRequest(MemEvent * event, bool toMem = false);
 
     /** Find link id by name.  Create map entry if not found */
-    uint32_t node_id(const std::string &name);
+    uint32_t node_id(EndpointID name);
     
     /** Find link id by name. */
-    uint32_t node_name_to_id(const std::string &name);
+    uint32_t node_name_to_id(EndpointID name);
 
     /** Determines if directory controller has exceeded the max number of entries.  If so it 'deletes' entry (not really) 
         and sends the entry to main memory.  In reality the entry is always kept in DirController but this writeback 
         of entries is done to get performance stimation */
     void updateCache(DirEntry *entry);
 
+    /** Entry cache LRU list maintenance. Front is most recently used */
+    void entryCachePushFront(DirEntry *entry);
+    void entryCacheRemove(DirEntry *entry);
+
     /** Profile request and delete it */
     void postRequestProcessing(MemEvent * ev, DirEntry * entry, bool stable);
 
@@ -346,18 +362,25 @@ private:
         Addr                baseAddr;       // block address
         State               state;          // state
         MemEvent::id_type   lastRequest;    // ID of message we're wanting a response to  - used to track whether a NACK needs to be retried
-        std::list<DirEntry*>::iterator cacheIter;
-	std::vector<bool>   sharers;        // set of sharers for block
+        DirEntry *          lruPrev;        // Neighbors in the entry cache LRU list
+        DirEntry *          lruNext;
+        bool                inEntryCache;   // whether entry is on the entry cache LRU list
+        uint64_t *          sharers;        // set of sharers for block, one bit per node, owned by DirEntryPool
+        uint32_t            sharerWords;    // length of sharers in words
         int                 owner;          // owner of block
         Output * dbg;
 	
-        DirEntry(Addr bsAddr, uint32_t bitlength, Output * d){
+        DirEntry() : sharers(nullptr), sharerWords(0), dbg(nullptr) {}
+
+        void init(Addr bsAddr, Output * d) {
             clearEntry();
             baseAddr     = bsAddr;
-            sharers.resize(bitlength);
             dbg          = d;
             state        = I;
             cached       = false;
+            lruPrev      = nullptr;
+            lruNext      = nullptr;
+            inEntryCache = false;
         }
 
         void clearEntry(){
@@ -374,12 +397,10 @@ private:
             str << "State: " << StateString[state];
             str << " Sharers: [";
             bool first = true;
-            for (int i = 0; i < sharers.size(); i++) {
-                if (sharers[i]) {
-                    if (!first) str << ",";
-                    str << i;
-                    first = false;
-                }
+            for (int i = nextSharer(0); i != -1; i = nextSharer(i + 1)) {
+                if (!first) str << ",";
+                str << i;
+                first = false;
             }
             str << "] Owner: " << owner;
             str << " Cached: " << (cached ? "y" : "n");
@@ -405,30 +426,41 @@ private:
         
         uint32_t getSharerCount(void) {
             uint32_t count = 0;
-            for (uint32_t i = 0; i < sharers.size(); i++) {
-                if (sharers[i]) count++;
-            }
+            for (uint32_t i = 0; i < sharerWords; i++)
+                count += __builtin_popcountll(sharers[i]);
             return count;
         }
 
         void clearSharers(void){
-            for (uint32_t i = 0; i < sharers.size(); i++)
-                sharers[i] = false;
+            for (uint32_t i = 0; i < sharerWords; i++)
+                sharers[i] = 0;
         }
         
         void addSharer(int id){
-            sharers[id]= true;
+            sharers[id >> 6] |= (1ULL << (id & 63));
         }
         
         bool isSharer(int id) {
-            return sharers[id];
+            return sharers[id >> 6] & (1ULL << (id & 63));
         }
 
         void removeSharer(int id){
-            if (!sharers[id]) {
+            if (!isSharer(id)) {
                 dbg->fatal(CALL_INFO,-1,"Removing a sharer which does not exist\n");
             }
-            sharers[id]= false;
+            sharers[id >> 6] &= ~(1ULL << (id & 63));
+        }
+
+        /** Return the lowest sharer id >= 'from' or -1 if there is none */
+        int nextSharer(int from) {
+            uint32_t word = from >> 6;
+            if (word >= sharerWords) return -1;
+            uint64_t bits = sharers[word] & (~0ULL << (from & 63));
+            while (!bits) {
+                if (++word >= sharerWords) return -1;
+                bits = sharers[word];
+            }
+            return (word << 6) + __builtin_ctzll(bits);
         }
         
         int getOwner(void) {
@@ -464,6 +496,73 @@ private:
         }
     };
 
+    /* 
+     * Slab allocator for directory entries
+     * Entries and their sharer bitsets are carved out of large blocks and recycled 
+     * through a free list instead of being individually allocated, since directories
+     * for large shared-memory systems can hold millions of entries.
+     */
+    class DirEntryPool {
+    public:
+        DirEntryPool() : sharerWords_(1) {}
+        
+        ~DirEntryPool() {
+            for (size_t i = 0; i < slabs_.size(); i++) {
+                delete [] slabs_[i].entries;
+                delete [] slabs_[i].sharers;
+            }
+        }
+
+        /** Set the sharer bitset width. Must be called before the first allocation */
+        void setSharerCount(uint32_t numSharers) {
+            sharerWords_ = (numSharers + 63) / 64;
+            if (sharerWords_ == 0) sharerWords_ = 1;
+        }
+
+        DirEntry * allocate(Addr baseAddr, Output * dbg) {
+            if (freeList_.empty()) grow();
+            DirEntry * entry = freeList_.back();
+            freeList_.pop_back();
+            entry->init(baseAddr, dbg);
+            return entry;
+        }
+
+        void release(DirEntry * entry) {
+            freeList_.push_back(entry);
+        }
+
+        /** Number of entries currently handed out */
+        size_t inUse() { return slabs_.size() * kSlabSize - freeList_.size(); }
+
+    private:
+        static const size_t kSlabSize = 1024;
+
+        struct Slab {
+            DirEntry *  entries;
+            uint64_t *  sharers;
+        };
+
+        void grow() {
+            Slab slab;
+            slab.entries = new DirEntry[kSlabSize];
+            slab.sharers = new uint64_t[kSlabSize * sharerWords_];
+            for (size_t i = 0; i < kSlabSize; i++) {
+                slab.entries[i].sharers = slab.sharers + i * sharerWords_;
+                slab.entries[i].sharerWords = sharerWords_;
+            }
+            slabs_.push_back(slab);
+            /* Hand out in address order */
+            for (size_t i = kSlabSize; i > 0; i--)
+                freeList_.push_back(&slab.entries[i - 1]);
+        }
+
+        uint32_t                sharerWords_;
+        std::vector<Slab>       slabs_;
+        std::vector<DirEntry*>  freeList_;
+    };
+
+    DirEntryPool    entryPool;
+
 public:
     DirectoryController(ComponentId_t id, Params &params);
     ~DirectoryController();
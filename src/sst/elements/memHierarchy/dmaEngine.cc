@@ -161,7 +161,7 @@ void DMAEngine::startRequest(Request *req)
         MemEvent *ev = new MemEvent(this, ptr, ptr, GetS);
         ev->setSize(blocksize);
         ev->setFlag(MemEvent::F_NONCACHEABLE);
-        ev->setDst(networkLink->findTargetDestination(ptr));
+        ev->setDstID(networkLink->findTargetDestinationID(ptr));
         req->loadKeys.insert(ev->getID());
         networkLink->send(ev);
         ptr += blocksize;
@@ -184,7 +184,7 @@ void DMAEngine::processPacket(Request *req, MemEventBase *ev)
         MemEvent *storeEV = new MemEvent(this, (req->getDst() + offset), (req->getDst() + offset), GetX);
         storeEV->setFlag(MemEvent::F_NONCACHEABLE);
         storeEV->setPayload(ev->getPayload());
-        storeEV->setDst(networkLink->findTargetDestination(req->getDst() + offset));
+        storeEV->setDstID(networkLink->findTargetDestinationID(req->getDst() + offset));
         req->storeKeys.insert(storeEV->getID());
         networkLink->send(storeEV);
     } else if ( ev->getCmd() == GetXResp ) {
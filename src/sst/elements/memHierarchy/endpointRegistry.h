@@ -0,0 +1,145 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_ENDPOINTREGISTRY_H
+#define MEMHIERARCHY_ENDPOINTREGISTRY_H
+
+#include <string>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+
+#include <sst/core/output.h>
+
+#include "sst/elements/memHierarchy/memTypes.h"
+
+namespace SST { namespace MemHierarchy {
+
+/* Compact handle for a named memHierarchy endpoint (cache, directory, memory, ...) */
+typedef uint32_t EndpointID;
+
+/*
+ * Process-wide name <-> EndpointID registry
+ *
+ * Components intern their names while they are constructed/initialized and
+ * events carry the resulting ID instead of a string. Names are only looked up
+ * for debug output, statistics, and serialization. IDs are local to a process,
+ * so events that cross ranks serialize the name and re-intern it on arrival.
+ *
+ * Names are stored in fixed-size chunks that never move once allocated, so
+ * getName() needs no lock and the returned reference stays valid for the
+ * rest of the simulation.
+ */
+class EndpointRegistry {
+public:
+    static const EndpointID NO_ENDPOINT = 0;    /* Always maps to NONE */
+    static const EndpointID EMPTY_ENDPOINT = 1; /* Always maps to "" */
+
+    /* Return the ID for 'name', registering it if needed */
+    static EndpointID intern(const std::string &name) {
+        /* Most calls re-intern a long-lived name (e.g., a component's own name), so
+         * remember recent (address -> ID) pairs per thread and validate by comparing
+         * contents, which avoids taking the lock on the common path */
+        struct RecentEntry { const std::string * name; EndpointID id; };
+        static thread_local RecentEntry recent[kRecentSize] = {};
+
+        RecentEntry &entry = recent[(reinterpret_cast<uintptr_t>(&name) >> 4) & (kRecentSize - 1)];
+        if (entry.name == &name && getName(entry.id) == name)
+            return entry.id;
+
+        EndpointID id = internSlow(name);
+        entry.name = &name;
+        entry.id = id;
+        return id;
+    }
+
+    /* Return the name an ID was interned from */
+    static const std::string& getName(EndpointID id) {
+        return instance().chunks[id >> kChunkBits].load(std::memory_order_acquire)[id & kChunkMask];
+    }
+
+    /* Number of names registered so far */
+    static size_t size() {
+        Registry &reg = instance();
+        std::lock_guard<std::mutex> lock(reg.lock);
+        return reg.count;
+    }
+
+private:
+    static const uint32_t kChunkBits = 10;
+    static const uint32_t kChunkSize = 1 << kChunkBits;
+    static const uint32_t kChunkMask = kChunkSize - 1;
+    static const uint32_t kMaxChunks = 1024;    /* Up to 1M distinct endpoint names */
+    static const uint32_t kRecentSize = 16;     /* Must be a power of two */
+
+    struct Registry {
+        std::mutex lock;
+        std::unordered_map<std::string, EndpointID> ids;
+        std::atomic<std::string*> chunks[kMaxChunks];
+        EndpointID count;
+
+        Registry() : count(0) {
+            for (uint32_t i = 0; i < kMaxChunks; i++)
+                chunks[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        ~Registry() {
+            for (uint32_t i = 0; i < kMaxChunks; i++)
+                delete [] chunks[i].load(std::memory_order_relaxed);
+        }
+    };
+
+    static Registry& instance() {
+        static Registry reg;
+        static bool initialized = (internLocked(reg, NONE), internLocked(reg, ""), true); /* NO_ENDPOINT, EMPTY_ENDPOINT */
+        (void) initialized;
+        return reg;
+    }
+
+    static EndpointID internSlow(const std::string &name) {
+        Registry &reg = instance();
+        std::lock_guard<std::mutex> lock(reg.lock);
+        return internLocked(reg, name);
+    }
+
+    static EndpointID internLocked(Registry &reg, const std::string &name) {
+        std::unordered_map<std::string, EndpointID>::iterator it = reg.ids.find(name);
+        if (it != reg.ids.end())
+            return it->second;
+
+        EndpointID id = reg.count;
+        uint32_t chunk = id >> kChunkBits;
+        if (chunk >= kMaxChunks) {
+            Output::getDefaultObject().fatal(CALL_INFO, -1, "MemHierarchy::EndpointRegistry, Error: too many endpoint names registered (limit is %" PRIu32 "), cannot add '%s'\n",
+                    kMaxChunks * kChunkSize, name.c_str());
+        }
+
+        std::string * names = reg.chunks[chunk].load(std::memory_order_relaxed);
+        if (names == nullptr) {
+            names = new std::string[kChunkSize];
+            reg.chunks[chunk].store(names, std::memory_order_release);
+        }
+        names[id & kChunkMask] = name;
+        std::atomic_thread_fence(std::memory_order_release);
+
+        reg.ids.insert(std::make_pair(name, id));
+        reg.count++;
+        return id;
+    }
+};
+
+}}
+
+#endif /* MEMHIERARCHY_ENDPOINTREGISTRY_H */
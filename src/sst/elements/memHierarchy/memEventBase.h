@@ -22,6 +22,8 @@
 
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/endpointRegistry.h"
+#include "sst/elements/memHierarchy/memEventPool.h"
 
 namespace SST { namespace MemHierarchy {
 
@@ -44,8 +46,19 @@ public:
     static const uint32_t F_NORESPONSE      = 0x00010000;
 
 
+    /** All memHierarchy events are recycled through per-thread free lists */
+    static void* operator new(size_t size) { return MemEventPool::allocate(size); }
+    static void operator delete(void * ptr, size_t size) { MemEventPool::release(ptr, size); }
+
     /** Creates a new MemEventBase */
-    MemEventBase(std::string src, Command cmd) : SST::Event() {
+    MemEventBase(const std::string& src, Command cmd) : SST::Event() {
+        setDefaults();
+        cmd_ = cmd;
+        src_ = EndpointRegistry::intern(src);
+    }
+
+    /** Creates a new MemEventBase from an already-interned source */
+    MemEventBase(EndpointID src, Command cmd) : SST::Event() {
         setDefaults();
         cmd_ = cmd;
         src_ = src;
@@ -54,9 +67,9 @@ public:
     virtual void setDefaults() {
         eventID_        = generateUniqueId();  // Defined in SST::Event
         responseToID_   = NO_ID;
-        dst_            = NONE;
-        src_            = NONE;
-        rqstr_          = NONE;
+        dst_            = EndpointRegistry::NO_ENDPOINT;
+        src_            = EndpointRegistry::NO_ENDPOINT;
+        rqstr_          = EndpointRegistry::NO_ENDPOINT;
         cmd_            = Command::NULLCMD;
         flags_          = 0;
         memFlags_       = 0;
@@ -90,19 +103,31 @@ public:
     void setCmd(Command newcmd) { cmd_ = newcmd; }
     
     /** @return the source string - who sent this MemEvent */
-    const std::string& getSrc(void) const { return src_; }
+    const std::string& getSrc(void) const { return EndpointRegistry::getName(src_); }
     /** Sets the source string - who sent this MemEvent */
-    void setSrc(const std::string& src) { src_ = src; }
+    void setSrc(const std::string& src) { src_ = EndpointRegistry::intern(src); }
+    /** @return the source ID - who sent this MemEvent */
+    EndpointID getSrcID(void) const { return src_; }
+    /** Sets the source ID - who sent this MemEvent */
+    void setSrcID(EndpointID src) { src_ = src; }
     
     /** @return the destination string - who receives this MemEvent */
-    const std::string& getDst(void) const { return dst_; }
+    const std::string& getDst(void) const { return EndpointRegistry::getName(dst_); }
     /** Sets the destination string - who received this MemEvent */
-    void setDst(const std::string& dst) { dst_ = dst; }
+    void setDst(const std::string& dst) { dst_ = EndpointRegistry::intern(dst); }
+    /** @return the destination ID - who receives this MemEvent */
+    EndpointID getDstID(void) const { return dst_; }
+    /** Sets the destination ID - who receives this MemEvent */
+    void setDstID(EndpointID dst) { dst_ = dst; }
     
     /** @return the requestor string - whose original request caused this MemEvent */
-    const std::string& getRqstr(void) const { return rqstr_; }
+    const std::string& getRqstr(void) const { return EndpointRegistry::getName(rqstr_); }
     /** Sets the requestor string - whose original request caused this MemEvent */
-    void setRqstr(const std::string& rqstr) { rqstr_ = rqstr; }
+    void setRqstr(const std::string& rqstr) { rqstr_ = EndpointRegistry::intern(rqstr); }
+    /** @return the requestor ID - whose original request caused this MemEvent */
+    EndpointID getRqstrID(void) const { return rqstr_; }
+    /** Sets the requestor ID - whose original request caused this MemEvent */
+    void setRqstrID(EndpointID rqstr) { rqstr_ = rqstr; }
 
     /** @returns the state of all flags */
     uint32_t getFlags(void) const { return flags_; }
@@ -171,7 +196,7 @@ public:
         std::string cmdStr(CommandString[(int)cmd_]);
         std::ostringstream str;
         str << " Flags: " << getFlagString() << " MemFlags: 0x" << std::hex << memFlags_;
-        return idstring.str() + " Cmd: " + cmdStr + " Src: " + src_ + " Dst: " + dst_ + " Rqstr: " + rqstr_ + str.str();
+        return idstring.str() + " Cmd: " + cmdStr + " Src: " + getSrc() + " Dst: " + getDst() + " Rqstr: " + getRqstr() + str.str();
     }
 
     /** Get brief print of the event */
@@ -182,7 +207,7 @@ public:
         if (BasicCommandClassArr[(int)cmd_] == BasicCommandClass::Response) {
             idstring << " RespID: <" << responseToID_.first << "," << responseToID_.second << ">";
         }
-        return idstring.str() + " Cmd: " + cmdStr + " Src: " + src_ + " Dst: " + dst_;
+        return idstring.str() + " Cmd: " + cmdStr + " Src: " + getSrc() + " Dst: " + getDst();
     }
 
     virtual bool doDebug(std::set<Addr> &UNUSED(addr)) {
@@ -204,9 +229,9 @@ public:
 protected:
     id_type         eventID_;           // Unique ID for this event
     id_type         responseToID_;      // For responses, holds the ID to which this event matches
-    string          src_;               // Source ID
-    string          dst_;               // Destination ID
-    string          rqstr_;             // Cache that originated this request
+    EndpointID      src_;               // Source ID
+    EndpointID      dst_;               // Destination ID
+    EndpointID      rqstr_;             // Cache that originated this request
     Command         cmd_;               // Command
     uint32_t        flags_;
     uint32_t        memFlags_;
@@ -218,9 +243,21 @@ public:
         Event::serialize_order(ser);
         ser & eventID_;
         ser & responseToID_;
-        ser & src_;
-        ser & dst_;
-        ser & rqstr_;
+        // Endpoint IDs are only valid within a process, so ship the names
+        std::string src, dst, rqstr;
+        if (ser.mode() != SST::Core::Serialization::serializer::UNPACK) {
+            src = getSrc();
+            dst = getDst();
+            rqstr = getRqstr();
+        }
+        ser & src;
+        ser & dst;
+        ser & rqstr;
+        if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+            src_ = EndpointRegistry::intern(src);
+            dst_ = EndpointRegistry::intern(dst);
+            rqstr_ = EndpointRegistry::intern(rqstr);
+        }
         ser & cmd_;
         ser & flags_;
         ser & memFlags_;
@@ -0,0 +1,162 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_MEMEVENTPOOL_H
+#define MEMHIERARCHY_MEMEVENTPOOL_H
+
+#include <new>
+#include <cstddef>
+#include <cstdint>
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Per-thread free lists for memHierarchy events
+ *
+ * MemEventBase overrides operator new/delete to allocate from here, so every
+ * event type (MemEvent, MoveEvent, CustomCmdEvent, init events, ...) is
+ * recycled when the component that consumes it deletes it. Blocks are binned by
+ * size. An event freed on a different thread than the one that allocated it
+ * just joins the freeing thread's list, so no locking is needed. Once a
+ * thread's pool has been destroyed (thread exit, static destruction) its
+ * events go straight to the heap.
+ */
+class MemEventPool {
+public:
+    struct Counters {
+        uint64_t allocations;       // Total allocations
+        uint64_t heapAllocations;   // Allocations that missed the free lists
+        uint64_t releases;          // Total frees
+    };
+
+    static void* allocate(size_t size) {
+        size_t bin = binOf(size);
+        if (destroyed()) return ::operator new(bin < kNumBins ? (bin + 1) * kGranularity : size);
+
+        ThreadPool &pool = local();
+        pool.counters.allocations++;
+        if (bin < kNumBins && pool.bins[bin].head) {
+            Block * block = pool.bins[bin].head;
+            pool.bins[bin].head = block->next;
+            pool.bins[bin].length--;
+            return block;
+        }
+        pool.counters.heapAllocations++;
+        return ::operator new(bin < kNumBins ? (bin + 1) * kGranularity : size);
+    }
+
+    static void release(void * ptr, size_t size) {
+        if (ptr == nullptr) return;
+        if (destroyed()) {
+            ::operator delete(ptr);
+            return;
+        }
+
+        ThreadPool &pool = local();
+        pool.counters.releases++;
+        size_t bin = binOf(size);
+        if (bin < kNumBins && pool.bins[bin].length < kMaxBinLength) {
+            Block * block = static_cast<Block*>(ptr);
+            block->next = pool.bins[bin].head;
+            pool.bins[bin].head = block;
+            pool.bins[bin].length++;
+            return;
+        }
+        ::operator delete(ptr);
+    }
+
+    /** Allocation counters for the calling thread */
+    static const Counters& getCounters() {
+        static const Counters none = { 0, 0, 0 };
+        return destroyed() ? none : local().counters;
+    }
+
+private:
+    static const size_t kGranularity    = 16;
+    static const size_t kNumBins        = 32;       // Pool events up to 512B, larger ones go straight to the heap
+    static const size_t kMaxBinLength   = 16384;    // Cap on idle blocks per bin per thread
+
+    struct Block { Block * next; };
+
+    struct Bin {
+        Block * head;
+        size_t  length;
+    };
+
+    struct ThreadPool {
+        Bin         bins[kNumBins];
+        Counters    counters;
+
+        ThreadPool() {
+            for (size_t i = 0; i < kNumBins; i++) {
+                bins[i].head = nullptr;
+                bins[i].length = 0;
+            }
+            counters.allocations = counters.heapAllocations = counters.releases = 0;
+        }
+
+        ~ThreadPool() {
+            destroyed() = true;
+            for (size_t i = 0; i < kNumBins; i++) {
+                while (bins[i].head) {
+                    Block * block = bins[i].head;
+                    bins[i].head = block->next;
+                    ::operator delete(block);
+                }
+            }
+        }
+    };
+
+    static size_t binOf(size_t size) { return (size == 0) ? 0 : (size - 1) / kGranularity; }
+
+    /* Trivially destructible, so it can still be read after the pool itself is gone */
+    static bool& destroyed() {
+        static thread_local bool flag = false;
+        return flag;
+    }
+
+    static ThreadPool& local() {
+        static thread_local ThreadPool pool;
+        return pool;
+    }
+};
+
+/*
+ * Attributes the pool activity that happens while it is in scope (e.g., during
+ * a clock tick or event handler) to a component's statistics
+ */
+template<typename StatType>
+class MemEventPoolScope {
+public:
+    MemEventPoolScope(StatType * allocations, StatType * heapAllocations, StatType * releases) :
+        allocations_(allocations), heapAllocations_(heapAllocations), releases_(releases), start_(MemEventPool::getCounters()) { }
+
+    ~MemEventPoolScope() {
+        const MemEventPool::Counters &end = MemEventPool::getCounters();
+        if (end.allocations != start_.allocations) allocations_->addData(end.allocations - start_.allocations);
+        if (end.heapAllocations != start_.heapAllocations) heapAllocations_->addData(end.heapAllocations - start_.heapAllocations);
+        if (end.releases != start_.releases) releases_->addData(end.releases - start_.releases);
+    }
+
+private:
+    StatType *              allocations_;
+    StatType *              heapAllocations_;
+    StatType *              releases_;
+    MemEventPool::Counters  start_;
+};
+
+}}
+
+#endif /* MEMHIERARCHY_MEMEVENTPOOL_H */
@@ -31,7 +31,7 @@ MemHierarchyInterface::MemHierarchyInterface(SST::Component *comp, Params &param
     SimpleMem(comp, params), owner_(comp), recvHandler_(NULL), link_(NULL)
 { 
     output.init("", 1, 0, Output::STDOUT);
-    rqstr_ = "";
+    rqstr_ = EndpointRegistry::EMPTY_ENDPOINT;
 }
 
 
@@ -54,7 +54,7 @@ void MemHierarchyInterface::init(unsigned int phase) {
         MemEventInit * memEvent = dynamic_cast<MemEventInit*>(ev);
         if (memEvent) {
             if (memEvent->getCmd() == Command::NULLCMD) {
-                rqstr_ = memEvent->getSrc();
+                rqstr_ = memEvent->getSrcID();
                 if (memEvent->getInitCmd() == MemEventInit::InitCommand::Coherence) {
                     MemEventInitCoherence * memEventC = static_cast<MemEventInitCoherence*>(memEvent);
                     baseAddrMask_ = ~(memEventC->getLineSize() - 1);
@@ -114,8 +114,8 @@ MemEventBase* MemHierarchyInterface::createMemEvent(SimpleMem::Request *req) con
     
     MemEvent *me = new MemEvent(owner_, req->addrs[0], baseAddr, cmd);
     
-    me->setRqstr(rqstr_);
-    me->setDst(rqstr_);
+    me->setRqstrID(rqstr_);
+    me->setDstID(rqstr_);
     me->setSize(req->size);
 
     if (SimpleMem::Request::Write == req->cmd)  {
@@ -153,8 +153,8 @@ MemEventBase* MemHierarchyInterface::createMemEvent(SimpleMem::Request *req) con
 MemEventBase* MemHierarchyInterface::createCustomEvent(SimpleMem::Request * req) const {
     Addr baseAddr = (req->addrs[0]) & baseAddrMask_;
     CustomCmdEvent * cme = new CustomCmdEvent(getName().c_str(), req->addrs[0], baseAddr, Command::CustomReq, req->getCustomOpc(), req->size);
-    cme->setRqstr(rqstr_);
-    cme->setDst(rqstr_);
+    cme->setRqstrID(rqstr_);
+    cme->setDstID(rqstr_);
 
     if(req->flags & SimpleMem::Request::F_NONCACHEABLE)
         cme->setFlag(MemEvent::F_NONCACHEABLE);
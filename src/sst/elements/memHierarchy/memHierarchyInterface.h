@@ -71,7 +71,7 @@ protected:
     Component*  owner_;
     Output      output;
     Addr        baseAddrMask_;
-    std::string rqstr_;
+    EndpointID  rqstr_;
     std::map<MemEventBase::id_type, Interfaces::SimpleMem::Request*> requests_;
     SST::Link*  link_;
 
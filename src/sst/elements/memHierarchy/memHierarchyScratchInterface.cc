@@ -31,6 +31,7 @@ MemHierarchyScratchInterface::MemHierarchyScratchInterface(SST::Component *comp,
     SimpleMem(comp, params), owner_(comp), recvHandler_(NULL), link_(NULL)
 { 
     output.init("", 1, 0, Output::STDOUT); 
+    rqstr_ = EndpointRegistry::EMPTY_ENDPOINT;
 
     bool found;
     UnitAlgebra size = UnitAlgebra(params.find<std::string>("scratchpad_size", "0B", found));
@@ -54,7 +55,7 @@ void MemHierarchyScratchInterface::init(unsigned int phase) {
             if (memEvent->getInitCmd() == MemEventInit::InitCommand::Coherence) {
                 MemEventInitCoherence * memEventC = static_cast<MemEventInitCoherence*>(memEvent);
                 baseAddrMask_ = ~(memEventC->getLineSize() - 1);
-                rqstr_ = memEventC->getSrc();
+                rqstr_ = memEventC->getSrcID();
                 allNoncache_ = (Endpoint::Scratchpad == memEventC->getType());
             }
         }
@@ -113,9 +114,9 @@ MemEvent * MemHierarchyScratchInterface::createMemEvent(SimpleMem::Request * req
     }
 
     me->setSize(req->size);
-    me->setRqstr(rqstr_);
-    me->setSrc(rqstr_);
-    me->setDst(rqstr_);
+    me->setRqstrID(rqstr_);
+    me->setSrcID(rqstr_);
+    me->setDstID(rqstr_);
 
     if (SimpleMem::Request::Write == req->cmd) {
         if (req->data.size() == 0) req->data.resize(req->size, 0);
@@ -144,9 +145,9 @@ MoveEvent* MemHierarchyScratchInterface::createMoveEvent(SimpleMem::Request *req
         me->setSrcBaseAddr(req->addrs[1] & baseAddrMask_);
     }
 
-    me->setRqstr(rqstr_);
-    me->setSrc(rqstr_);
-    me->setDst(rqstr_);
+    me->setRqstrID(rqstr_);
+    me->setSrcID(rqstr_);
+    me->setDstID(rqstr_);
     me->setSize(req->size);
 
     me->setDstVirtualAddress(req->getVirtualAddress());
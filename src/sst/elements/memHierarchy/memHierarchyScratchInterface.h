@@ -83,7 +83,7 @@ private:
     SST::Link*      link_;
     std::map<SST::Event::id_type, Interfaces::SimpleMem::Request*> requests_;
     Addr baseAddrMask_;
-    std::string rqstr_;
+    EndpointID rqstr_;
     Addr remoteMemStart_;
     bool allNoncache_;
 };
@@ -31,6 +31,7 @@
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/addrDecoder.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -73,7 +74,7 @@ public:
     };
     
     /* Constructor */
-    MemLinkBase(Component * comp, Params &params) : SubComponent(comp) {
+    MemLinkBase(Component * comp, Params &params) : SubComponent(comp), destDecoderStale(true) {
         /* Create debug output */
         int debugLevel = params.find<int>("debug_level", 0);
         int debugLoc = params.find<int>("debug", 0);
@@ -164,16 +165,29 @@ public:
 
     /* Functions for managing communication according to address */
     virtual std::string findTargetDestination(Addr addr) {
-    	for (std::set<EndpointInfo>::const_iterator it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
-            if (it->region.contains(addr)) return it->name;
+        return EndpointRegistry::getName(findTargetDestinationID(addr));
+    }
+
+    /* Destination for 'addr'. The destination set is compiled into an AddrDecoder the first time it is needed after a change.
+     * A network link turns the destination into a network address when it sends, see lookupNetworkAddress(). */
+    EndpointID findTargetDestinationID(Addr addr) {
+        if (destDecoderStale) {
+            destDecoder.clear();
+            for (std::set<EndpointInfo>::const_iterator it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
+                destDecoder.add(it->region, EndpointRegistry::intern(it->name));
+            }
+            destDecoder.compile();
+            destDecoderStale = false;
         }
 
+        EndpointID target = destDecoder.find(addr);
+        if (target != EndpointRegistry::NO_ENDPOINT) return target;
+
         if(sharedMemEnabled) {
             if(localMemSize) {
         	Addr tempAddr = addr & (localMemSize-1);
-                for (std::set<EndpointInfo>::const_iterator it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
-        	    if(it->region.contains(tempAddr)) return it->name;
-        	}
+                target = destDecoder.find(tempAddr);
+                if (target != EndpointRegistry::NO_ENDPOINT) return target;
             }
 	}
 
@@ -185,20 +199,21 @@ public:
             error << it->name << " " << it->region.toString() << endl;
         }
         dbg.fatal(CALL_INFO, -1, "%s", error.str().c_str());
-        return "";
+        return EndpointRegistry::NO_ENDPOINT;
     }
 
     virtual bool isRequestAddressValid(Addr addr) { return info.region.contains(addr); }
 
     /* Functions for managing source/destination information */
     std::set<EndpointInfo> * getSources() { return &sourceEndpointInfo; }
-    std::set<EndpointInfo> * getDests() { return &destEndpointInfo; }
+    std::set<EndpointInfo> * getDests() { destDecoderStale = true; return &destEndpointInfo; }
     
     void setSources(std::set<EndpointInfo>& srcs) { sourceEndpointInfo = srcs; }
-    void setDests(std::set<EndpointInfo>& dsts) { destEndpointInfo = dsts; }
+    void setDests(std::set<EndpointInfo>& dsts) { destEndpointInfo = dsts; destDecoderStale = true; }
     
     void addSource(EndpointInfo info) { sourceEndpointInfo.insert(info); }
     void addDest(EndpointInfo dstInfo) {
+        destDecoderStale = true;
     	if(sharedMemEnabled) {
     		if (info.node == dstInfo.node || dstInfo.node == 9999) // node 9999 is treated as shared memory components
     			destEndpointInfo.insert(dstInfo);
@@ -238,6 +253,8 @@ protected:
     // Data structures
     std::set<EndpointInfo> sourceEndpointInfo;  // endpoint info for each source network endpoint
     std::set<EndpointInfo> destEndpointInfo;    // endpoint info for each destination network endpoint
+    AddrDecoder destDecoder;                    // destEndpointInfo compiled for address lookups
+    bool destDecoderStale;                      // destEndpointInfo changed since destDecoder was compiled
     std::queue<MemEventInit*> initReceiveQ;     // queue for messages received during init
 };
 
@@ -36,6 +36,8 @@ using namespace SST::Interfaces;
 /*** MemNICBase implementation ************************************/
 /******************************************************************/
 
+const uint64_t MemNICBase::NO_NETWORK_ADDRESS;
+
 MemNICBase::MemNICBase(Component * parent, Params &params) : MemLinkBase(parent, params) {
     // Get source/destination parameters
     // Each NIC has a group ID and talks to those with IDs in sources and destinations
@@ -68,6 +70,7 @@ MemNICBase::MemNICBase(Component * parent, Params &params) : MemLinkBase(parent,
         destIDs.insert(info.id + 1);
 
     initMsgSent = false;
+    nameID = EndpointRegistry::intern(getName());
 
     dbg.debug(_L10_, "%s memNICBase info is: Name: %s, group: %" PRIu32 "\n",
             getName().c_str(), info.name.c_str(), info.id);
@@ -106,7 +109,9 @@ void MemNICBase::nicInit(SST::Interfaces::SimpleNetwork * linkcontrol, unsigned
         InitMemRtrEvent * imre = dynamic_cast<InitMemRtrEvent*>(payload);
         if (imre) {
             // Record name->address map for all other endpoints
-            networkAddressMap.insert(std::make_pair(imre->info.name, imre->info.addr));
+            EndpointID id = EndpointRegistry::intern(imre->info.name);
+            if (id >= networkAddresses.size()) networkAddresses.resize(id + 1, NO_NETWORK_ADDRESS);
+            if (networkAddresses[id] == NO_NETWORK_ADDRESS) networkAddresses[id] = imre->info.addr;
             
             dbg.debug(_L10_, "%s (memNICBase) received imre. Name: %s, Addr: %" PRIu64 ", ID: %" PRIu32 ", start: %" PRIu64 ", end: %" PRIu64 ", size: %" PRIu64 ", step: %" PRIu64 "\n",
                     getName().c_str(), imre->info.name.c_str(), imre->info.addr, imre->info.id, imre->info.region.start, imre->info.region.end, imre->info.region.interleaveSize, imre->info.region.interleaveStep);
@@ -134,7 +139,7 @@ void MemNICBase::nicInit(SST::Interfaces::SimpleNetwork * linkcontrol, unsigned
              *      src is a src/dst?
              */
             if (ev->getInitCmd() == MemEventInit::InitCommand::Region) {
-                if (ev->getDst() == getName()) {
+                if (ev->getDstID() == nameID) {
                     MemEventInitRegion * rEv = static_cast<MemEventInitRegion*>(ev);
                     if (rEv->getSetRegion() && acceptRegion) {
                         info.region = rEv->getRegion();
@@ -145,7 +150,7 @@ void MemNICBase::nicInit(SST::Interfaces::SimpleNetwork * linkcontrol, unsigned
                 delete mre;
             } else if (
                     (ev->getCmd() == Command::NULLCMD && (isSource(mre->event->getSrc()) || isDest(mre->event->getSrc()))) 
-                    || ev->getDst() == getName()) {
+                    || ev->getDstID() == nameID) {
                 dbg.debug(_L10_, "\tInserting in initQueue\n");
                 initQueue.push(mre);
             }
@@ -175,11 +180,14 @@ MemEventInit * MemNICBase::recvInitData() {
 
 /* Translate destination string to network address */
 uint64_t MemNICBase::lookupNetworkAddress(const std::string & dst) const {
-    std::unordered_map<std::string,uint64_t>::const_iterator it = networkAddressMap.find(dst);
-    if (it == networkAddressMap.end()) {
-        dbg.fatal(CALL_INFO, -1, "%s (MemNICBase), Network address for destination '%s' not found in networkAddressMap.\n", getName().c_str(), dst.c_str());
+    return lookupNetworkAddress(EndpointRegistry::intern(dst));
+}
+
+uint64_t MemNICBase::lookupNetworkAddress(EndpointID dst) const {
+    if (!hasNetworkAddress(dst)) {
+        dbg.fatal(CALL_INFO, -1, "%s (MemNICBase), Network address for destination '%s' not found in networkAddresses.\n", getName().c_str(), EndpointRegistry::getName(dst).c_str());
     }
-    return it->second;
+    return networkAddresses[dst];
 }
 
 
@@ -216,10 +224,25 @@ MemNIC::MemNIC(Component * parent, Params &params) : MemNICBase(parent, params)
 
     packetHeaderBytes = packetSize.getRoundedValue();
 
+    useDestQueues = params.find<bool>("destination_queues", false);
+
     // Set link control to call recvNotify on event receive
     link_control->setNotifyOnReceive(new SimpleNetwork::Handler<MemNIC>(this, &MemNIC::recvNotify));
 }
 
+MemNIC::~MemNIC() {
+    while (!sendQueue.empty()) {
+        delete sendQueue.front();
+        sendQueue.pop();
+    }
+    for (size_t i = 0; i < destQueues.size(); i++) {
+        while (!destQueues[i].empty()) {
+            delete destQueues[i].front();
+            destQueues[i].pop();
+        }
+    }
+}
+
 void MemNIC::init(unsigned int phase) {
     link_control->init(phase);  // This MUST be called before anything else
     MemNICBase::nicInit(link_control, phase);
@@ -227,34 +250,60 @@ void MemNIC::init(unsigned int phase) {
 
 /* 
  * Called by parent on a clock 
- * Returns whether anything sent this cycle
+ * Sends as many queued packets as the link will take
+ * Returns whether the send queues were empty
  */
 bool MemNIC::clock() {
-    if (sendQueue.empty()) return true;
-    while (!sendQueue.empty()) {
-        SimpleNetwork::Request *head = sendQueue.front();
+    if (!useDestQueues) {
+        if (sendQueue.empty()) return true;
+        while (!sendQueue.empty() && trySend(sendQueue.front()))
+            sendQueue.pop();
+        return false;
+    }
+
+    /* Give each destination with something queued a turn at sending one packet,
+     * and keep going round until none of them can send */
+    if (readyDests.empty()) return true;
+    bool sent = true;
+    while (sent && !readyDests.empty()) {
+        sent = false;
+        size_t turns = readyDests.size();
+        for (size_t i = 0; i < turns; i++) {
+            EndpointID dst = readyDests.front();
+            readyDests.pop_front();
+            std::queue<SimpleNetwork::Request*> &queue = destQueues[dst];
+            if (trySend(queue.front())) {
+                queue.pop();
+                sent = true;
+            }
+            if (!queue.empty())
+                readyDests.push_back(dst);
+        }
+    }
+    return false;
+}
+
+/* Hand a request to the link control if there is room for it */
+bool MemNIC::trySend(SimpleNetwork::Request * head) {
 /* Debug info - record before we attempt send so that if send destroys anything we have it */
 #ifdef __SST_DEBUG_OUTPUT__
-        MemEventBase * ev = (static_cast<MemRtrEvent*>(head->inspectPayload()))->event;
-        std::string debugEvStr;
-        uint64_t dst = head->dest;
-        bool doDebug = false;
-        if (ev) { 
-            debugEvStr = ev->getBriefString();
-            doDebug = is_debug_event(ev);
-        }
+    MemEventBase * ev = (static_cast<MemRtrEvent*>(head->inspectPayload()))->event;
+    std::string debugEvStr;
+    uint64_t dst = head->dest;
+    bool doDebug = false;
+    if (ev) { 
+        debugEvStr = ev->getBriefString();
+        doDebug = is_debug_event(ev);
+    }
 #endif
-        if (link_control->spaceToSend(0, head->size_in_bits) && link_control->send(head, 0)) {
+    if (link_control->spaceToSend(0, head->size_in_bits) && link_control->send(head, 0)) {
 #ifdef __SST_DEBUG_OUTPUT__
-            if (!debugEvStr.empty() && doDebug) {
-                dbg.debug(_L9_, "%s (memNIC), Sending message %s to dst addr %" PRIu64 "\n",
-                        getName().c_str(), debugEvStr.c_str(), dst);
-            }
-#endif
-            sendQueue.pop();
-        } else {
-            break;
+        if (!debugEvStr.empty() && doDebug) {
+            dbg.debug(_L9_, "%s (memNIC), Sending message %s to dst addr %" PRIu64 "\n",
+                    getName().c_str(), debugEvStr.c_str(), dst);
         }
+#endif
+        return true;
     }
     return false;
 }
@@ -280,10 +329,10 @@ bool MemNIC::recvNotify(int) {
 
 /* Send event to memNIC */
 void MemNIC::send(MemEventBase *ev) {
-    SimpleNetwork::Request *req = new SimpleNetwork::Request();
+    SimpleNetwork::Request *req = allocateRequest();
     MemRtrEvent * mre = new MemRtrEvent(ev);
     req->src = info.addr;
-    req->dest = lookupNetworkAddress(ev->getDst());
+    req->dest = lookupNetworkAddress(ev->getDstID());
     req->size_in_bits = getSizeInBits(ev);
     req->vn = 0;
     
@@ -293,12 +342,59 @@ void MemNIC::send(MemEventBase *ev) {
     }
 
     req->givePayload(mre);
-    sendQueue.push(req);
+
+    if (!useDestQueues) {
+        sendQueue.push(req);
+        return;
+    }
+
+    EndpointID dst = ev->getDstID();
+    if (dst >= destQueues.size())
+        destQueues.resize(dst + 1);
+    if (destQueues[dst].empty())
+        readyDests.push_back(dst);
+    destQueues[dst].push(req);
 }
 
 
 /** Helper functions **/
 
+namespace {
+    /* Free network requests for the calling thread */
+    struct RequestFreeList {
+        std::vector<SimpleNetwork::Request*> requests;
+        ~RequestFreeList() {
+            for (size_t i = 0; i < requests.size(); i++)
+                delete requests[i];
+        }
+    };
+
+    const size_t kMaxFreeRequests = 4096;
+
+    RequestFreeList& requestFreeList() {
+        static thread_local RequestFreeList freeList;
+        return freeList;
+    }
+}
+
+SimpleNetwork::Request* MemNIC::allocateRequest() {
+    RequestFreeList &freeList = requestFreeList();
+    if (freeList.requests.empty())
+        return new SimpleNetwork::Request();
+    SimpleNetwork::Request * req = freeList.requests.back();
+    freeList.requests.pop_back();
+    *req = SimpleNetwork::Request();    /* Payload was taken by the receiver */
+    return req;
+}
+
+void MemNIC::releaseRequest(SimpleNetwork::Request * req) {
+    RequestFreeList &freeList = requestFreeList();
+    if (freeList.requests.size() < kMaxFreeRequests)
+        freeList.requests.push_back(req);
+    else
+        delete req;
+}
+
 /* Calculate size in bits of an event */
 size_t MemNIC::getSizeInBits(MemEventBase *ev) {
     return 8 * (packetHeaderBytes + ev->getPayloadSize());
@@ -312,7 +408,7 @@ MemEventBase* MemNIC::recv() {
     SimpleNetwork::Request *req = link_control->recv(0);
     if (req != nullptr) {
         MemRtrEvent *mre = static_cast<MemRtrEvent*>(req->takePayload());
-        delete req;
+        releaseRequest(req);
         
         if (mre->hasClientData()) {
             MemEventBase * ev = mre->event;
@@ -321,7 +417,7 @@ MemEventBase* MemNIC::recv() {
             return ev;
         } else { /* InitMemRtrEvent - someone updated their info */
             InitMemRtrEvent *imre = static_cast<InitMemRtrEvent*>(mre);
-            if (networkAddressMap.find(imre->info.name) == networkAddressMap.end()) {
+            if (!hasNetworkAddress(EndpointRegistry::intern(imre->info.name))) {
                 dbg.fatal(CALL_INFO, -1, "%s (MemNIC), received information about previously unknown endpoint. This case is not handled. Endpoint name: %s\n",
                         getName().c_str(), imre->info.name.c_str());
             }
@@ -352,6 +448,17 @@ void MemNIC::printStatus(Output &out) {
         sendQueue.pop();
     }
     tmpQ.swap(sendQueue);
+
+    for (size_t dst = 0; dst < destQueues.size(); dst++) {
+        if (destQueues[dst].empty()) continue;
+        out.output("    Send queue for %s (%zu entries):\n", EndpointRegistry::getName(dst).c_str(), destQueues[dst].size());
+        for (size_t i = 0; i < destQueues[dst].size(); i++) {
+            SST::Interfaces::SimpleNetwork::Request * req = destQueues[dst].front();
+            out.output("      %s\n", static_cast<MemRtrEvent*>(req->inspectPayload())->event->getVerboseString().c_str());
+            destQueues[dst].pop();
+            destQueues[dst].push(req);
+        }
+    }
     out.output("    Link status: \n");
     link_control->printStatus(out);
     out.output("  End MemHierarchy::MemNIC\n");
@@ -19,6 +19,7 @@
 #include <string>
 #include <unordered_map>
 #include <queue>
+#include <deque>
 
 #include <sst/core/event.h>
 #include <sst/core/output.h>
@@ -27,6 +28,7 @@
 #include <sst/core/interfaces/simpleNetwork.h>
 
 #include "sst/elements/memHierarchy/memEventBase.h"
+#include "sst/elements/memHierarchy/memEventPool.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
 
@@ -48,6 +50,7 @@ class MemNICBase : public MemLinkBase {
         ~MemNICBase() { }
 
         uint64_t lookupNetworkAddress(const std::string &dst) const;
+        uint64_t lookupNetworkAddress(EndpointID dst) const;
 
         // Router events 
         class MemRtrEvent : public SST::Event {
@@ -55,6 +58,10 @@ class MemNICBase : public MemLinkBase {
                 MemEventBase * event;
                 MemRtrEvent() : Event(), event(nullptr) { }
                 MemRtrEvent(MemEventBase * ev) : Event(), event(ev) { }
+
+                /* One of these wraps every event sent over the network, so recycle them like the events themselves */
+                static void* operator new(size_t size) { return MemEventPool::allocate(size); }
+                static void operator delete(void * ptr, size_t size) { MemEventPool::release(ptr, size); }
             
                 virtual Event* clone(void) override {
                     MemRtrEvent *mre = new MemRtrEvent(*this);
@@ -131,7 +138,13 @@ class MemNICBase : public MemLinkBase {
         bool initMsgSent;
 
         // Data structures
-        std::unordered_map<std::string,uint64_t> networkAddressMap; // Map of name -> address for each network endpoint
+        std::vector<uint64_t> networkAddresses; // Network address of each endpoint, indexed by interned name
+        static const uint64_t NO_NETWORK_ADDRESS = (uint64_t) - 1;
+
+        bool hasNetworkAddress(EndpointID id) const {
+            return id < networkAddresses.size() && networkAddresses[id] != NO_NETWORK_ADDRESS;
+        }
+        EndpointID nameID;  // Interned getName()
         
         // Init queues
         std::queue<MemRtrEvent*> initQueue; // Queue for received init events
@@ -161,6 +174,7 @@ public:
         { "network_input_buffer_size",   "(string) Size of input buffer", "1KiB"},\
         { "network_output_buffer_size",  "(string) Size of output buffer", "1KiB"},\
         { "min_packet_size",             "(string) Size of a packet without a payload (e.g., control message size)", "8B"},\
+        { "destination_queues",          "(bool) Queue outgoing packets per destination and take turns between destinations, so a packet that does not fit in the output buffer does not hold up packets to other destinations", "false"},\
         { "port",                        "(string) Set by parent component. Name of port this NIC sits on.", ""}
 
     
@@ -176,7 +190,7 @@ public:
     MemNIC(Component * comp, Params &params);
     
     /* Destructor */
-    ~MemNIC() { }
+    ~MemNIC();
 
     /* Functions called by parent for handling events */
     bool clock();
@@ -199,6 +213,12 @@ public:
 
 private:
 
+    bool trySend(SST::Interfaces::SimpleNetwork::Request * req);
+
+    /* Network requests are recycled on a per-thread free list: the receiving NIC frees what the sending one allocated */
+    static SST::Interfaces::SimpleNetwork::Request* allocateRequest();
+    static void releaseRequest(SST::Interfaces::SimpleNetwork::Request * req);
+
     // Other parameters
     size_t packetHeaderBytes;
 
@@ -207,6 +227,11 @@ private:
 
     // Event queues
     std::queue<SST::Interfaces::SimpleNetwork::Request*> sendQueue; // Queue of events waiting to be sent (sent on clock)
+
+    // Per-destination queues, used instead of sendQueue if 'destination_queues' is set
+    bool useDestQueues;
+    std::vector<std::queue<SST::Interfaces::SimpleNetwork::Request*> > destQueues;   // Indexed by destination EndpointID
+    std::deque<EndpointID> readyDests;  // Destinations with a non-empty queue, in the order they get a turn
 };
 
 } //namespace memHierarchy
@@ -18,26 +18,49 @@
 
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/mman.h>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+#include <unordered_map>
 #include "sst/elements/memHierarchy/util.h"
 
 namespace SST {
 namespace MemHierarchy {
 namespace Backend {
 
+/*
+ * Backing stores hold the simulated contents of memory
+ *
+ * The bulk get/set calls copy whole runs with memcpy; the std::vector
+ * overloads are kept for existing callers and forward to them.
+ */
 class Backing {
 public:
     Backing( ) { }
-    ~Backing() { }
+    virtual ~Backing() { }
 
     virtual void set( Addr addr, uint8_t value ) = 0;
-    virtual void set( Addr addr, size_t size, std::vector<uint8_t>& data) = 0;
+    virtual void set( Addr addr, size_t size, const uint8_t* data ) = 0;
 
     virtual uint8_t get( Addr addr) = 0;
-    virtual void get( Addr addr, size_t size, std::vector<uint8_t>& data) = 0;
+    virtual void get( Addr addr, size_t size, uint8_t* data ) = 0;
+
+    void set( Addr addr, size_t size, const std::vector<uint8_t>& data ) {
+        set(addr, size, data.data());
+    }
+
+    void get( Addr addr, size_t size, std::vector<uint8_t>& data ) {
+        if (data.size() < size) data.resize(size, 0);
+        get(addr, size, data.data());
+    }
 };
 
 class BackingMMAP : public Backing {
 public:
+    using Backing::set;
+    using Backing::get;
+
     BackingMMAP(std::string memoryFile, size_t size, size_t offset = 0) : Backing(), m_fd(-1), m_size(size), m_offset(offset) {
         int flags = MAP_PRIVATE;
         if ( ! memoryFile.empty() ) {
@@ -66,30 +89,167 @@ public:
         m_buffer[addr - m_offset ] = value;
     }
 
-    void set (Addr addr, size_t size, std::vector<uint8_t> &data) {
-        for (size_t i = 0; i < size; i++) 
-            m_buffer[addr + i] = data[i];
+    void set( Addr addr, size_t size, const uint8_t* data ) {
+        memcpy(m_buffer + (addr - m_offset), data, size);
     }
 
     uint8_t get( Addr addr ) {
         return m_buffer[addr - m_offset];
     }
 
-    void get( Addr addr, size_t size, std::vector<uint8_t> &data) {
-        for (size_t i = 0; i < size; i++)
-            data[i] = m_buffer[addr + i];
+    void get( Addr addr, size_t size, uint8_t* data ) {
+        memcpy(data, m_buffer + (addr - m_offset), size);
     }
 
 private:
     uint8_t* m_buffer;
     int m_fd;
-    int m_size;
+    size_t m_size;
+    size_t m_offset;
+};
+
+/*
+ * Anonymous mapping of the whole address space that reserves no swap
+ * (MAP_NORESERVE), so only pages that are actually written take up host
+ * memory. Writes mark their pages dirty in a bitmap so a dump or
+ * checkpoint only has to visit the pages that were touched.
+ */
+class BackingSparseMMAP : public Backing {
+public:
+    using Backing::set;
+    using Backing::get;
+
+    BackingSparseMMAP(size_t size, size_t offset = 0) : Backing(), m_size(size), m_offset(offset) {
+        m_pageSize = sysconf(_SC_PAGESIZE);
+        m_pageShift = log2Of(m_pageSize);
+        m_buffer = (uint8_t*)mmap(NULL, size, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON|MAP_NORESERVE, -1, 0);
+
+        if ( m_buffer == MAP_FAILED) {
+            throw 2;
+        }
+        m_dirty.resize((((size + m_pageSize - 1) >> m_pageShift) + 63) / 64, 0);
+    }
+
+    ~BackingSparseMMAP() {
+        munmap( m_buffer, m_size );
+    }
+
+    void set( Addr addr, uint8_t value ) {
+        Addr offset = addr - m_offset;
+        markDirty(offset, 1);
+        m_buffer[offset] = value;
+    }
+
+    void set( Addr addr, size_t size, const uint8_t* data ) {
+        Addr offset = addr - m_offset;
+        markDirty(offset, size);
+        memcpy(m_buffer + offset, data, size);
+    }
+
+    uint8_t get( Addr addr ) {
+        return m_buffer[addr - m_offset];
+    }
+
+    void get( Addr addr, size_t size, uint8_t* data ) {
+        memcpy(data, m_buffer + (addr - m_offset), size);
+    }
+
+    size_t getPageSize() const { return m_pageSize; }
+
+    /* Number of pages written since construction or the last clearDirty() */
+    size_t getDirtyPageCount() const {
+        size_t count = 0;
+        for (size_t i = 0; i < m_dirty.size(); i++)
+            count += __builtin_popcountll(m_dirty[i]);
+        return count;
+    }
+
+    void clearDirty() {
+        std::fill(m_dirty.begin(), m_dirty.end(), 0);
+    }
+
+    /* Call f(addr, data, bytes) for each dirty page, in address order */
+    template<typename F>
+    void forEachDirtyPage(F f) const {
+        for (size_t word = 0; word < m_dirty.size(); word++) {
+            uint64_t bits = m_dirty[word];
+            while (bits) {
+                size_t page = word * 64 + __builtin_ctzll(bits);
+                bits &= bits - 1;
+                size_t start = page << m_pageShift;
+                size_t bytes = std::min(m_pageSize, m_size - start);
+                f(start + m_offset, (const uint8_t*)(m_buffer + start), bytes);
+            }
+        }
+    }
+
+    /* Write the dirty pages to 'fd' as (address, bytes, data) records. Returns false on a write error. */
+    bool dump(int fd) const {
+        bool ok = true;
+        forEachDirtyPage([&](Addr addr, const uint8_t* data, size_t bytes) {
+                uint64_t header[2] = { addr, bytes };
+                if (ok) ok = writeAll(fd, header, sizeof(header)) && writeAll(fd, data, bytes);
+            });
+        return ok;
+    }
+
+    /* Load records written by dump(). Returns false on a malformed or truncated file. */
+    bool restore(int fd) {
+        uint64_t header[2];
+        ssize_t got;
+        while ((got = read(fd, header, sizeof(header))) == sizeof(header)) {
+            if (header[0] < m_offset || header[0] - m_offset + header[1] > m_size) return false;
+            markDirty(header[0] - m_offset, header[1]);
+            if (!readAll(fd, m_buffer + (header[0] - m_offset), header[1])) return false;
+        }
+        return got == 0;
+    }
+
+private:
+    void markDirty(Addr offset, size_t size) {
+        if (size == 0) return;
+        size_t first = offset >> m_pageShift;
+        size_t last = (offset + size - 1) >> m_pageShift;
+        for (size_t page = first; page <= last; page++)
+            m_dirty[page >> 6] |= (uint64_t)1 << (page & 63);
+    }
+
+    static bool writeAll(int fd, const void* buf, size_t bytes) {
+        const uint8_t* ptr = (const uint8_t*)buf;
+        while (bytes > 0) {
+            ssize_t n = write(fd, ptr, bytes);
+            if (n <= 0) return false;
+            ptr += n;
+            bytes -= n;
+        }
+        return true;
+    }
+
+    static bool readAll(int fd, void* buf, size_t bytes) {
+        uint8_t* ptr = (uint8_t*)buf;
+        while (bytes > 0) {
+            ssize_t n = read(fd, ptr, bytes);
+            if (n <= 0) return false;
+            ptr += n;
+            bytes -= n;
+        }
+        return true;
+    }
+
+    uint8_t* m_buffer;
+    size_t m_size;
     size_t m_offset;
+    size_t m_pageSize;
+    unsigned int m_pageShift;
+    std::vector<uint64_t> m_dirty;
 };
 
 class BackingMalloc : public Backing {
 public:
-    BackingMalloc(size_t size) {
+    using Backing::set;
+    using Backing::get;
+
+    BackingMalloc(size_t size) : m_lastBAddr(0), m_lastPage(nullptr) {
         m_allocUnit = size;
         /* Alloc unit needs to be pwr-2 */
         if (!isPowerOfTwo(m_allocUnit)) {
@@ -99,75 +259,85 @@ public:
         m_shift = log2Of(m_allocUnit);
     }
 
+    ~BackingMalloc() {
+        for (std::unordered_map<Addr,uint8_t*>::iterator it = m_buffer.begin(); it != m_buffer.end(); it++)
+            free(it->second);
+    }
+
     void set( Addr addr, uint8_t value ) {
         Addr bAddr = addr >> m_shift;
         Addr offset = addr - (bAddr << m_shift);
-        allocIfNeeded(bAddr);
-        m_buffer[bAddr][offset] = value;
+        allocIfNeeded(bAddr)[offset] = value;
     }
 
-    void set( Addr addr, size_t size, std::vector<uint8_t> &data ) {
-        /* Account for size exceeding alloc unit size */
+    void set( Addr addr, size_t size, const uint8_t* data ) {
+        /* Copy one alloc unit at a time, size may exceed alloc unit size */
         Addr bAddr = addr >> m_shift;
         Addr offset = addr - (bAddr << m_shift);
-        size_t dataOffset = 0;
-        
-        allocIfNeeded(bAddr);
-
-        while (dataOffset != size) {
-            m_buffer[bAddr][offset] = data[dataOffset];
-            offset++;
-            dataOffset++;
-
-            if (offset == m_allocUnit) {
-                offset = 0;
-                bAddr++;
-                allocIfNeeded(bAddr);
-            }
+        while (size > 0) {
+            size_t chunk = std::min(size, (size_t)(m_allocUnit - offset));
+            memcpy(allocIfNeeded(bAddr) + offset, data, chunk);
+            data += chunk;
+            size -= chunk;
+            offset = 0;
+            bAddr++;
         }
     }        
 
-    void get (Addr addr, size_t size, std::vector<uint8_t> &data) {
+    /* Reads of never-written memory return zero without allocating */
+    void get( Addr addr, size_t size, uint8_t* data ) {
         Addr bAddr = addr >> m_shift;
         Addr offset = addr - (bAddr << m_shift);
-        size_t dataOffset = 0;
-        
-        allocIfNeeded(bAddr);
-        
-        while (dataOffset != size) {
-            data[dataOffset] = m_buffer[bAddr][offset];
-            offset++;
-            dataOffset++;
-            if (offset == m_allocUnit) {
-                bAddr++;
-                offset = 0;
-                allocIfNeeded(bAddr);
-            }
+        while (size > 0) {
+            size_t chunk = std::min(size, (size_t)(m_allocUnit - offset));
+            uint8_t* page = lookup(bAddr);
+            if (page) memcpy(data, page + offset, chunk);
+            else memset(data, 0, chunk);
+            data += chunk;
+            size -= chunk;
+            offset = 0;
+            bAddr++;
         }
     }
 
     uint8_t get( Addr addr ) {
         Addr bAddr = addr >> m_shift;
         Addr offset = addr - (bAddr << m_shift);
-        allocIfNeeded(bAddr);
-        return m_buffer[bAddr][offset];
+        uint8_t* page = lookup(bAddr);
+        return page ? page[offset] : 0;
     }
 
 private:
-    void allocIfNeeded(Addr bAddr) {
-        if (m_buffer.find(bAddr) == m_buffer.end()) {
-            uint8_t* data = (uint8_t*) malloc(sizeof(uint8_t)*m_allocUnit);
-            if (!data) {
-                Output out("", 1, 0, Output::STDOUT);
-                out.fatal(CALL_INFO, -1, "BackingMalloc: Error - malloc failed.\n");
-            }
-            m_buffer[bAddr] = data;
+    /* Consecutive accesses usually fall in the same alloc unit, so check the last one before hashing */
+    uint8_t* lookup(Addr bAddr) {
+        if (m_lastPage && bAddr == m_lastBAddr) return m_lastPage;
+        std::unordered_map<Addr,uint8_t*>::iterator it = m_buffer.find(bAddr);
+        if (it == m_buffer.end()) return nullptr;
+        m_lastBAddr = bAddr;
+        m_lastPage = it->second;
+        return m_lastPage;
+    }
+
+    uint8_t* allocIfNeeded(Addr bAddr) {
+        uint8_t* page = lookup(bAddr);
+        if (page) return page;
+
+        page = (uint8_t*) calloc(m_allocUnit, sizeof(uint8_t));
+        if (!page) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "BackingMalloc: Error - malloc failed.\n");
         }
+        m_buffer[bAddr] = page;
+        m_lastBAddr = bAddr;
+        m_lastPage = page;
+        return page;
     }
 
     std::unordered_map<Addr,uint8_t*> m_buffer;
-    unsigned int m_allocUnit;
+    size_t m_allocUnit;
     unsigned int m_shift;
+    Addr m_lastBAddr;
+    uint8_t* m_lastPage;
 };
 
 }
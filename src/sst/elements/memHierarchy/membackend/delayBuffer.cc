@@ -48,6 +48,8 @@ DelayBuffer::DelayBuffer(Component *comp, Params &params) : SimpleMemBackend(com
         delay_self_link = comp->configureSelfLink("DelaySelfLink", delay.toString(), new Event::Handler<DelayBuffer>(this, &DelayBuffer::handleNextRequest));
     } else {
         delay_self_link = NULL;
+        // Requests go straight to the backend, so pass on its signal that a rejected request can be retried
+        backend->setRetryHandler( std::bind( &DelayBuffer::notifyRetry, this ) );
     }
 }
 
@@ -73,7 +75,9 @@ bool DelayBuffer::issueRequest( ReqId req, Addr addr, bool isWrite, unsigned num
  */
 
 bool DelayBuffer::clock(Cycle_t cycle) {
-    return backend->clock(cycle);
+    bool idle = backend->clock(cycle);
+    // Delayed requests reach the backend from handleNextRequest, so keep the controller clock running until they have all been issued
+    return idle && requestBuffer.empty();
 }
 
 void DelayBuffer::setup() {
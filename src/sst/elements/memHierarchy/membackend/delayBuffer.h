@@ -45,6 +45,8 @@ public:
     virtual bool clock(Cycle_t cycle);
     virtual const std::string& getClockFreq() { return backend->getClockFreq(); }
     virtual bool isClocked() { return backend->isClocked(); }
+    virtual bool notifiesRetry() { return delay_self_link != NULL || backend->notifiesRetry(); }
+    virtual void turnClockOn(Cycle_t cycle) { backend->turnClockOn(cycle); }
 
 private:
     void handleMemReponse( ReqId id ) {
@@ -96,6 +96,15 @@ public:
     
     /* Called by parent's clock() function */
     virtual bool clock(Cycle_t UNUSED(cycle)) { return true; } 
+
+    /* Called by parent when its clock resumes after being off; 'cycle' is the cycle before the next call to clock() */
+    virtual void turnClockOn(Cycle_t UNUSED(cycle)) { }
+
+    /* Unclocked backends that return true call notifyRetry() whenever a request they rejected might now be accepted */
+    virtual bool notifiesRetry() { return false; }
+    virtual void setRetryHandler( std::function<void()> func ) {
+        m_retryFunc = func;
+    }
     
     /* Interface to parent */
     virtual size_t getMemSize() { return m_memSize; }
@@ -109,6 +118,10 @@ public:
     }
 
 protected:
+    void notifyRetry() {
+        if (m_retryFunc) m_retryFunc();
+    }
+
     Output*         output;
     std::string     m_clockFreq;
     int32_t         m_maxReqPerCycle;
@@ -116,6 +129,7 @@ protected:
     int32_t         m_reqWidth;
 
     std::function<const std::string(ReqId)> m_getRequestor;
+    std::function<void()> m_retryFunc;
 };
 
 /* MemBackend - timing only */
@@ -55,6 +55,11 @@ MemBackendConvertor::MemBackendConvertor(Component *comp, Params& params ) :
     }
     
     m_clockBackend = m_backend->isClocked();
+
+    m_eventDriven = params.find<bool>("event_driven", false) && !m_clockBackend && m_backend->notifiesRetry();
+    m_waitingForBackend = false;
+    if (m_eventDriven)
+        m_backend->setRetryHandler( std::bind( &MemBackendConvertor::handleBackendRetry, this ) );
     
     stat_GetSReqReceived    = registerStatistic<uint64_t>("requests_received_GetS");
     stat_GetSXReqReceived  = registerStatistic<uint64_t>("requests_received_GetSX");
@@ -96,6 +101,7 @@ void MemBackendConvertor::handleCustomEvent( CustomCmdInfo * info) {
 
 bool MemBackendConvertor::clock(Cycle_t cycle) {
     m_cycleCount++;
+    m_waitingForBackend = false;
 
     int reqsThisCycle = 0;
     bool cycleWithIssue = false;
@@ -112,6 +118,7 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
         } else {
             cycleWithIssue = false;
             stat_cyclesAttemptIssueButRejected->addData(1);
+            m_waitingForBackend = m_eventDriven;
             break;
         }
 
@@ -120,7 +127,7 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
 
         if ( req->issueDone() ) {
             Debug(_L10_, "Completed issue of request\n");
-            m_requestQueue.pop_front();
+            popRequestQueue();
         }
     }
 
@@ -135,8 +142,8 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
 
     // Can turn off the clock if:
     // 1) backend says it's ok
-    // 2) requestQueue is empty
-    if (unclock && m_requestQueue.empty())
+    // 2) requestQueue is empty or the backend will tell us when to retry
+    if (unclock && (m_requestQueue.empty() || m_waitingForBackend))
         return true;
 
     return false;
@@ -148,10 +155,11 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
  */
 void MemBackendConvertor::turnClockOn(Cycle_t cycle) {
     Cycle_t cyclesOff = cycle - m_cycleCount;
-    for (Cycle_t i = 0; i < cyclesOff; i++)
-        stat_outstandingReqs->addData( m_pendingRequests.size() );
+    if (cyclesOff)
+        stat_outstandingReqs->addDataNTimes( cyclesOff, m_pendingRequests.size() );
     m_cycleCount = cycle;
     m_clockOn = true;
+    m_backend->turnClockOn(cycle);
 }
 
 /*
@@ -161,6 +169,21 @@ void MemBackendConvertor::turnClockOff() {
     m_clockOn = false;
 }
 
+/*
+ * Called by an event-driven backend when it may be able to accept
+ * the request it last rejected
+ */
+void MemBackendConvertor::handleBackendRetry() {
+    if (!m_waitingForBackend)
+        return;
+
+    m_waitingForBackend = false;
+    if (!m_clockOn) {
+        Cycle_t cycle = static_cast<MemController*>(parent)->turnClockOn();
+        turnClockOn(cycle);
+    }
+}
+
 void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
 
     /* If clock is not on, turn it back on */
@@ -200,23 +223,17 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
             doResponseStat( event->getCmd(), latency );
 
             if (!flags) flags = event->getFlags();
-            SST::Event::id_type evID = event->getID();
             sendResponse(event->getID(), flags); // Needs to occur before a flush is completed since flush is dependent
 
             // TODO clock responses
-            // Check for flushes that are waiting on this event to finish
-            if (m_dependentRequests.find(evID) != m_dependentRequests.end()) {
-                std::set<MemEvent*, memEventCmp> flushes = m_dependentRequests.find(evID)->second;
-
-                for (std::set<MemEvent*, memEventCmp>::iterator it = flushes.begin(); it != flushes.end(); it++) {
-                    (m_waitingFlushes.find(*it)->second).erase(evID);
-                    if ((m_waitingFlushes.find(*it)->second).empty()) {
-                        MemEvent * flush = *it;
-                        sendResponse(flush->getID(), (flush->getFlags() | MemEvent::F_SUCCESS));
-                        m_waitingFlushes.erase(flush);
-                    }
+            // Complete any flushes that were only waiting on this event
+            std::vector<FlushReq*>& flushes = static_cast<MemReq*>(req)->getFlushes();
+            for (std::vector<FlushReq*>::iterator it = flushes.begin(); it != flushes.end(); it++) {
+                FlushReq* flush = *it;
+                if (--flush->m_pending == 0) {
+                    sendResponse(flush->m_event->getID(), (flush->m_event->getFlags() | MemEvent::F_SUCCESS));
+                    delete flush;
                 }
-                m_dependentRequests.erase(evID);
             }
             delete req;
         }
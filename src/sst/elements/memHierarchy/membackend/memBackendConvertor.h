@@ -22,6 +22,7 @@
 #include <sst/core/warnmacros.h>
 
 #include "sst/elements/memHierarchy/memEvent.h"
+#include "sst/elements/memHierarchy/addrHashMap.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
 
 namespace SST {
@@ -42,7 +43,8 @@ class MemBackendConvertor : public SubComponent {
             {"debug_mask",      "(uint) Mask on debug_level", "0"},\
             {"debug_location",  "(uint) 0: No debugging, 1: STDOUT, 2: STDERR, 3: FILE", "0"},\
             {"request_width",   "(uint) Max size of a request that can be accepted by the memory controller", "64"},\
-            {"backend",         "Backend memory model to use for timing. Defaults to 'simpleMem'", "memHierarchy.simpleMem"}
+            {"backend",         "Backend memory model to use for timing. Defaults to 'simpleMem'", "memHierarchy.simpleMem"},\
+            {"event_driven",    "(bool) If the backend is not clocked and can signal when it is ready again, stop polling it after it rejects a request and wait for the signal instead", "false"}
 
 #define MEMBACKENDCONVERTOR_ELI_STATS { "cycles_with_issue",                  "Total cycles with successful issue to back end",   "cycles",   1 },\
             { "cycles_attempted_issue_but_rejected","Total cycles where an attempt to issue to backend was rejected (indicates backend full)", "cycles", 1 },\
@@ -101,10 +103,17 @@ class MemBackendConvertor : public SubComponent {
 
     };
 
+    /* A flush waiting on the requests to its line that were queued ahead of it */
+    struct FlushReq {
+        FlushReq( MemEvent* event ) : m_event(event), m_pending(0) { }
+        MemEvent*   m_event;
+        uint32_t    m_pending;  // Number of requests still to complete
+    };
+
     class MemReq : public BaseReq {
       public:
         MemReq( MemEvent* event, uint32_t reqId ) : BaseReq(reqId, BaseReq::ReqType::MEM), 
-            m_event(event), m_offset(0), m_numReq(0) { }
+            m_event(event), m_offset(0), m_numReq(0), m_nextSameLine(nullptr) { }
         ~MemReq() { }
 
         static uint32_t getBaseId( ReqId id) { return id >> 32; }
@@ -130,6 +139,15 @@ class MemBackendConvertor : public SubComponent {
             return ( m_offset >= m_event->getSize() && 0 == m_numReq );
         }
 
+        void addFlush( FlushReq* flush ) {
+            m_flushes.push_back(flush);
+            flush->m_pending++;
+        }
+        std::vector<FlushReq*>& getFlushes() { return m_flushes; }
+
+        MemReq* getNextSameLine() { return m_nextSameLine; }
+        void setNextSameLine( MemReq* req ) { m_nextSameLine = req; }
+
         std::string getString() {
             std::ostringstream str;
             str << "addr: " << addr() << " baseAddr: " << baseAddr() << " processed: " << processed();
@@ -141,6 +159,8 @@ class MemBackendConvertor : public SubComponent {
         MemEvent*   m_event;
         uint32_t    m_offset;
         uint32_t    m_numReq;
+        std::vector<FlushReq*> m_flushes;   // Flushes waiting on this request
+        MemReq*     m_nextSameLine;         // Next queued request to the same line
     };
 
   public:
@@ -155,6 +175,7 @@ class MemBackendConvertor : public SubComponent {
     virtual void turnClockOn(Cycle_t cycle);
     virtual void handleMemEvent(  MemEvent* );
     virtual void handleCustomEvent( CustomCmdInfo* );
+    virtual void handleBackendRetry();
     virtual uint32_t getRequestWidth();
     virtual bool isBackendClocked() { return m_clockBackend; }
 
@@ -172,13 +193,16 @@ class MemBackendConvertor : public SubComponent {
     // such that all the requests are consolidated in one place
   protected:
     ~MemBackendConvertor() {
-        while ( m_requestQueue.size()) {
-            delete m_requestQueue.front();
-            m_requestQueue.pop_front();
-        }
-
+        /* Queued requests are also pending, so only delete them once */
         PendingRequests::iterator iter = m_pendingRequests.begin();
         for ( ; iter != m_pendingRequests.end(); ++ iter ) {
+            if (iter->second->isMemEv()) {
+                std::vector<FlushReq*>& flushes = static_cast<MemReq*>(iter->second)->getFlushes();
+                for (std::vector<FlushReq*>::iterator it = flushes.begin(); it != flushes.end(); it++) {
+                    if (--(*it)->m_pending == 0)
+                        delete *it;
+                }
+            }
             delete iter->second;
         }
     }
@@ -199,27 +223,13 @@ class MemBackendConvertor : public SubComponent {
 
     bool setupMemReq( MemEvent* ev ) {
         if ( Command::FlushLine == ev->getCmd() || Command::FlushLineInv == ev->getCmd() ) {
-            // TODO optimize if this becomes a problem, it is slow
-            std::set<SST::Event::id_type> dependsOn;
-            for (std::deque<BaseReq*>::iterator it = m_requestQueue.begin(); it != m_requestQueue.end(); it++) {
-                if (!(*it)->isMemEv())
-                    continue;
-                MemReq * mr = static_cast<MemReq*>(*it);
-                if (mr->baseAddr() == ev->getBaseAddr()) {
-                    MemEvent * req = mr->getMemEvent();
-                    dependsOn.insert(req->getID());
-                    if (m_dependentRequests.find(req->getID()) == m_dependentRequests.end()) {
-                        std::set<MemEvent*, memEventCmp> flushSet;
-                        flushSet.insert(ev);
-                        m_dependentRequests.insert(std::make_pair(req->getID(), flushSet));
-                    } else {
-                        (m_dependentRequests.find(req->getID())->second).insert(ev);
-                    }
-                }
-            }
+            // Wait for every request to this line that has not finished issuing
+            LineQueue* line = m_queuedLines.find(ev->getBaseAddr());
+            if (line == nullptr) return false;
 
-            if (dependsOn.empty()) return false;
-            m_waitingFlushes.insert(std::make_pair(ev, dependsOn));
+            FlushReq* flush = new FlushReq(ev);
+            for (MemReq* req = line->head; req != nullptr; req = req->getNextSameLine())
+                req->addFlush(flush);
             return true; 
         }
 
@@ -227,9 +237,32 @@ class MemBackendConvertor : public SubComponent {
         MemReq* req = new MemReq( ev, id );
         m_requestQueue.push_back( req );
         m_pendingRequests[id] = req;
+
+        LineQueue& line = m_queuedLines[ev->getBaseAddr()];
+        if (line.tail)
+            line.tail->setNextSameLine(req);
+        else
+            line.head = req;
+        line.tail = req;
         return true;
     }
 
+    /* Remove the request at the head of the queue once it has been fully issued */
+    void popRequestQueue() {
+        BaseReq* req = m_requestQueue.front();
+        m_requestQueue.pop_front();
+        if (!req->isMemEv()) return;
+
+        // Requests leave the queue in order, so this one is also the head of its line's list
+        MemReq* memReq = static_cast<MemReq*>(req);
+        Addr baseAddr = memReq->baseAddr();
+        LineQueue* line = m_queuedLines.find(baseAddr);
+        line->head = memReq->getNextSameLine();
+        memReq->setNextSameLine(nullptr);
+        if (line->head == nullptr)
+            m_queuedLines.erase(baseAddr);
+    }
+
     inline void doClockStat( ) {
         stat_totalCycles->addData(1);        
     }
@@ -277,6 +310,8 @@ class MemBackendConvertor : public SubComponent {
     uint64_t m_cycleCount;
 
     bool m_clockOn;
+    bool m_eventDriven;         // Wait for the backend to signal instead of retrying every cycle
+    bool m_waitingForBackend;   // Backend rejected the head of the queue and will signal when to retry
 
     uint32_t genReqId( ) { return ++m_reqId; }
 
@@ -288,8 +323,13 @@ class MemBackendConvertor : public SubComponent {
     PendingRequests         m_pendingRequests;
     uint32_t                m_frontendRequestWidth;
 
-    std::map<MemEvent*, std::set<SST::Event::id_type> > m_waitingFlushes; // Set of request IDs for each flush
-    std::map<SST::Event::id_type, std::set<MemEvent*, memEventCmp> > m_dependentRequests; // Reverse map, set of flushes for each request ID, for faster lookup
+    /* Requests in m_requestQueue for each line, in queue order, so a flush can find the ones it must wait on */
+    struct LineQueue {
+        LineQueue() : head(nullptr), tail(nullptr) { }
+        MemReq* head;
+        MemReq* tail;
+    };
+    AddrHashMap<LineQueue>  m_queuedLines;
 
     Statistic<uint64_t>* stat_GetSLatency;
     Statistic<uint64_t>* stat_GetSXLatency;
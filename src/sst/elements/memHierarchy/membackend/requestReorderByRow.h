@@ -47,6 +47,7 @@ public:
     void setup();
     void finish();
     bool clock(Cycle_t cycle);
+    virtual void turnClockOn(Cycle_t cycle) { backend->turnClockOn(cycle); }
     virtual const std::string& getClockFreq() { return backend->getClockFreq(); }
 
 private:
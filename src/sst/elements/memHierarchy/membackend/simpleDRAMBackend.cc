@@ -125,10 +125,12 @@ void SimpleDRAM::handleSelfEvent(SST::Event *event){
             busy[ev->bank] = false;
         }
         handleMemResponse(ev->reqId);
+        if (policy != RowPolicy::CLOSED) notifyRetry();
         delete event;
     } else {
         openRow[ev->bank] = -1;
         busy[ev->bank] = false;
+        notifyRetry();
         delete event;
     }
 }
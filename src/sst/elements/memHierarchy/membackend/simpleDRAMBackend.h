@@ -51,6 +51,7 @@ public:
     SimpleDRAM(Component *comp, Params &params);
     bool issueRequest( ReqId, Addr, bool, unsigned );
     bool isClocked() { return false; }
+    bool notifiesRetry() { return true; }
 
     typedef enum {OPEN, CLOSED, DYNAMIC, TIMEOUT } RowPolicy;
 
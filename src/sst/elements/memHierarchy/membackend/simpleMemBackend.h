@@ -38,6 +38,7 @@ public:
     bool issueRequest(ReqId, Addr, bool, unsigned );
     virtual int32_t getMaxReqPerCycle() { return 1; }
     virtual bool isClocked() { return false; }    
+    virtual bool notifiesRetry() { return true; }   /* Never rejects */
 
 public:
     class MemCtrlEvent : public SST::Event {
@@ -12,6 +12,7 @@
 
 #include <sst_config.h>
 #include <sst/core/timeLord.h>
+#include <sst/core/unitAlgebra.h>
 #include "membackend/timingDRAMBackend.h"
 
 using namespace SST;
@@ -22,7 +23,7 @@ bool TimingDRAM::Channel::m_printConfig = true;
 bool TimingDRAM::Rank::m_printConfig = true;
 bool TimingDRAM::Bank::m_printConfig = true;
 
-TimingDRAM::TimingDRAM(Component *comp, Params &params) : SimpleMemBackend(comp, params), m_cycle(0) {
+TimingDRAM::TimingDRAM(Component *comp, Params &params) : SimpleMemBackend(comp, params), m_cycle(0), m_lastClock(0), m_idle(false) {
 
     int id = params.find<int>("id", -1);
     assert( id != -1 );
@@ -82,7 +83,42 @@ bool TimingDRAM::clock(Cycle_t cycle)
         m_channels[i].clock(m_cycle);
     }
     ++m_cycle;
-    return false;
+
+    // With no transactions, commands, or rows waiting on the page policy, skipped cycles would do nothing
+    m_lastClock = cycle;
+    m_idle = true;
+    for ( unsigned i = 0; i < m_channels.size() && m_idle; i++ ) {
+        m_idle = m_channels[i].isIdle();
+    }
+    return m_idle;
+}
+
+/*
+ * Advance our cycle count over the cycles the parent's clock was off so
+ * that timing is the same as if we had been clocked throughout
+ */
+void TimingDRAM::turnClockOn(Cycle_t cycle)
+{
+    if ( m_idle && cycle > m_lastClock ) {
+        m_cycle += cycle - m_lastClock;
+    }
+    m_idle = false;
+}
+
+void TimingDRAM::finish()
+{
+    // Ranks that were quiet while our clock was off accrue background energy up to now
+    SimTime_t cycle = m_cycle;
+    if ( m_idle ) {
+        Cycle_t now = getCurrentSimTime( getClockFreq() );
+        if ( now > m_lastClock ) {
+            cycle += now - m_lastClock;
+        }
+    }
+
+    for ( unsigned i = 0; i < m_channels.size(); i++ ) {
+        m_channels[i].finish( cycle );
+    }
 }
 
 //==================================================================================
@@ -111,7 +147,7 @@ TimingDRAM::Channel::Channel( Component* comp, TimingDRAM* mem, Params& params,
 
     Params tmpParams = params.find_prefix_params("rank." );
     for ( unsigned i=0; i<numRanks; i++ ) {
-        m_ranks.push_back( Rank( comp, tmpParams, mc, myNum, i, output, mapper ) );
+        m_ranks.push_back( Rank( comp, mem, tmpParams, mc, myNum, i, output, mapper ) );
     } 
 }
 
@@ -130,6 +166,7 @@ void TimingDRAM::Channel::clock( SimTime_t cycle )
 
             if (cmd->getTrans() != nullptr) {
                 m_retiredTrans.push(cmd->getTrans());
+                m_ranks[ cmd->getRank() ].retireTrans( cycle );
             }
 
             delete (*iter);
@@ -155,6 +192,7 @@ void TimingDRAM::Channel::clock( SimTime_t cycle )
                     cycle, cmd->getName().c_str(), cmd->getRank(), cmd->getBank(), cmd->getRow());
 
         m_dataBusAvailCycle = cmd->issue();  
+        m_ranks[ cmd->getRank() ].issueCmd( cmd, cycle );
 
         m_issuedCmds.push_back(cmd);
     }
@@ -189,8 +227,9 @@ TimingDRAM::Cmd* TimingDRAM::Channel::popCmd( SimTime_t cycle, SimTime_t dataBus
 // Rank 
 //==================================================================================
 
-TimingDRAM::Rank::Rank( Component* comp, Params& params, unsigned mc, unsigned chan, unsigned myNum, Output* output, AddrMapper* mapper ) : 
-    m_output( output ), m_mapper( mapper ), m_nextBankUp(0)
+TimingDRAM::Rank::Rank( Component* comp, TimingDRAM* mem, Params& params, unsigned mc, unsigned chan, unsigned myNum, Output* output, AddrMapper* mapper ) : 
+    m_output( output ), m_mapper( mapper ), m_nextBankUp(0), m_openBanks(0), m_inFlight(0),
+    m_idleSince(0), m_powerCycle(0), m_readyCycle(0)
 {
     std::ostringstream tmp;
     tmp << "@t:TimingDRAM:Rank:@p():@l:mc=" << mc << ":chan=" << chan << ":rank=" << myNum <<": "; 
@@ -200,11 +239,68 @@ TimingDRAM::Rank::Rank( Component* comp, Params& params, unsigned mc, unsigned c
 
     m_mapper->setNumBanks( banks );
 
+    // Currents are in mA and times in ns, so energies come out in pJ
+    UnitAlgebra clock( mem->getClockFreq() );
+    double tCK = clock.hasUnits("s") ? clock.getValue().toDouble() * 1e9 : 1e9 / clock.getValue().toDouble();
+    double scale = params.find<unsigned>("devices", 8) * params.find<double>("VDD", 1.5) * tCK;
+
+    double idd0 = params.find<double>("IDD0", 55);
+    double idd2p = params.find<double>("IDD2P", 12);
+    double idd2n = params.find<double>("IDD2N", 32);
+    double idd3p = params.find<double>("IDD3P", 17);
+    double idd3n = params.find<double>("IDD3N", 38);
+    double idd4r = params.find<double>("IDD4R", 157);
+    double idd4w = params.find<double>("IDD4W", 128);
+    double idd5 = params.find<double>("IDD5", 235);
+    double idd6 = params.find<double>("IDD6", 12);
+    unsigned tRAS = params.find<unsigned>("tRAS", 28);
+    unsigned tRP = params.find<unsigned>("bank.TRP", 11);
+    unsigned tRFC = params.find<unsigned>("tRFC", 128);
+
+    // IDD0 covers a full ACT-PRE cycle; split it at tRAS into the part above active and precharge standby
+    m_power.actEnergy = ( idd0 - idd3n ) * tRAS * scale;
+    m_power.preEnergy = ( idd0 - idd2n ) * tRP * scale;
+    m_power.readEnergy = ( idd4r - idd3n ) * scale;
+    m_power.writeEnergy = ( idd4w - idd3n ) * scale;
+    m_power.refreshEnergy = ( idd5 - idd3n ) * tRFC * scale;
+    m_power.actStandby = idd3n * scale;
+    m_power.preStandby = idd2n * scale;
+    m_power.actPowerDown = idd3p * scale;
+    m_power.prePowerDown = idd2p * scale;
+    m_power.selfRefresh = idd6 * scale;
+    m_power.tREFI = params.find<SimTime_t>("tREFI", 6240);
+    m_power.tXP = params.find<SimTime_t>("tXP", 5);
+    m_power.tXS = params.find<SimTime_t>("tXS", 136);
+    m_power.powerDownDelay = params.find<SimTime_t>("powerDownDelay", 0);
+    m_power.selfRefreshDelay = params.find<SimTime_t>("selfRefreshDelay", 0);
+    m_nextRefresh = m_power.tREFI;
+
     if ( m_printConfig ) {
         m_output->verbosePrefix(prefix(),CALL_INFO, 1, DBG_MASK, "number of banks: %d\n",banks);
+        m_output->verbosePrefix(prefix(),CALL_INFO, 1, DBG_MASK, "ACT/PRE energy:  %.1f/%.1f pJ\n",m_power.actEnergy,m_power.preEnergy);
+        m_output->verbosePrefix(prefix(),CALL_INFO, 1, DBG_MASK, "power-down delay:   %" PRIu64 "\n",m_power.powerDownDelay);
+        m_output->verbosePrefix(prefix(),CALL_INFO, 1, DBG_MASK, "self-refresh delay: %" PRIu64 "\n",m_power.selfRefreshDelay);
         m_printConfig = false;
     }
 
+    // Power states are always modelled, energy is only accumulated into these statistics, so without energyStats none is counted
+    if ( params.find<bool>("energyStats", false) ) {
+        std::string subId = std::to_string(chan) + "_" + std::to_string(myNum);
+        statActEnergy = mem->registerStatistic<double>("act_energy", subId);
+        statPreEnergy = mem->registerStatistic<double>("pre_energy", subId);
+        statReadEnergy = mem->registerStatistic<double>("read_energy", subId);
+        statWriteEnergy = mem->registerStatistic<double>("write_energy", subId);
+        statRefreshEnergy = mem->registerStatistic<double>("refresh_energy", subId);
+        statBackgroundEnergy = mem->registerStatistic<double>("background_energy", subId);
+        statPowerDownCycles = mem->registerStatistic<uint64_t>("powerdown_cycles", subId);
+        statSelfRefreshCycles = mem->registerStatistic<uint64_t>("selfrefresh_cycles", subId);
+        statPowerDownExits = mem->registerStatistic<uint64_t>("powerdown_exits", subId);
+        statSelfRefreshExits = mem->registerStatistic<uint64_t>("selfrefresh_exits", subId);
+    } else {
+        statActEnergy = statPreEnergy = statReadEnergy = statWriteEnergy = statRefreshEnergy = statBackgroundEnergy = NULL;
+        statPowerDownCycles = statSelfRefreshCycles = statPowerDownExits = statSelfRefreshExits = NULL;
+    }
+
     Params tmpParams = params.find_prefix_params("bank." );
     for ( unsigned i=0; i<banks; i++ ) {
         m_banks.push_back( Bank( comp, tmpParams, mc, chan, myNum, i, output ) );
@@ -215,6 +311,10 @@ TimingDRAM::Cmd* TimingDRAM::Rank::popCmd( SimTime_t cycle, SimTime_t dataBusAva
 {
     m_output->verbosePrefix(prefix(),CALL_INFO, 5, DBG_MASK, "\n" );
 
+    if ( cycle < m_readyCycle ) {
+        return NULL;
+    }
+
     unsigned current = m_nextBankUp;
     for ( unsigned i = 0; i < m_banks.size(); i++ ) {
         Cmd* cmd = m_banks[current].popCmd( cycle, dataBusAvailCycle );
@@ -234,6 +334,129 @@ TimingDRAM::Cmd* TimingDRAM::Rank::popCmd( SimTime_t cycle, SimTime_t dataBusAva
     return NULL;
 }
 
+void TimingDRAM::Rank::issueCmd( Cmd* cmd, SimTime_t cycle )
+{
+    // A command issued with nothing in flight (a page policy closing a row) ends any low-power period
+    if ( m_inFlight ) {
+        accrueStandby( cycle );
+    } else {
+        accrueLowPower( cycle, false );
+    }
+
+    switch ( cmd->m_op ) {
+      case Cmd::ACT:
+        record( statActEnergy, m_power.actEnergy );
+        m_openBanks++;
+        break;
+      case Cmd::PRE:
+        record( statPreEnergy, m_power.preEnergy );
+        if ( m_openBanks ) m_openBanks--;
+        break;
+      case Cmd::COL:
+        if ( cmd->getTrans()->isWrite ) {
+            record( statWriteEnergy, m_power.writeEnergy * cmd->getDataCycles() );
+        } else {
+            record( statReadEnergy, m_power.readEnergy * cmd->getDataCycles() );
+        }
+        break;
+    }
+}
+
+void TimingDRAM::Rank::finish( SimTime_t cycle )
+{
+    if ( m_inFlight ) {
+        accrueStandby( cycle );
+    } else {
+        accrueLowPower( cycle, false );
+    }
+}
+
+/*
+ * A transaction arrived at a rank with nothing in flight. If the rank has
+ * been quiet long enough to power down or self-refresh, it has to exit
+ * first and cannot take a command for tXP or tXS.
+ */
+void TimingDRAM::Rank::wake( SimTime_t cycle )
+{
+    SimTime_t exitLatency = accrueLowPower( cycle, true );
+    if ( exitLatency ) {
+        m_readyCycle = cycle + exitLatency;
+        m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK, "cycle=%" PRIu64 " low-power exit, ready at %" PRIu64 "\n",
+                cycle, m_readyCycle );
+    }
+}
+
+/*
+ * Accrue background energy for a quiet rank up to 'cycle'. The rank enters
+ * power-down powerDownDelay cycles and self-refresh selfRefreshDelay cycles
+ * after its last command or transaction, whichever is later. Returns the
+ * latency to exit the state the rank is in at 'cycle', 0 if it is in standby.
+ */
+SimTime_t TimingDRAM::Rank::accrueLowPower( SimTime_t cycle, bool exit )
+{
+    const SimTime_t never = std::numeric_limits<SimTime_t>::max();
+    SimTime_t quiet = std::max( m_idleSince, m_powerCycle );
+    SimTime_t pdStart = m_power.powerDownDelay ? quiet + m_power.powerDownDelay : never;
+    SimTime_t srStart = m_power.selfRefreshDelay ? quiet + m_power.selfRefreshDelay : never;
+
+    if ( cycle <= std::min( pdStart, srStart ) ) {
+        accrueStandby( cycle );
+        return 0;
+    }
+
+    accrueStandby( std::min( pdStart, srStart ) );
+
+    SimTime_t exitLatency = 0;
+    if ( pdStart < srStart ) {
+        SimTime_t end = std::min( cycle, srStart );
+        record( statBackgroundEnergy, ( end - pdStart ) * ( m_openBanks ? m_power.actPowerDown : m_power.prePowerDown ) );
+        record( statPowerDownCycles, end - pdStart );
+        accrueRefresh( end );
+        exitLatency = m_power.tXP;
+        if ( exit && end == cycle ) record( statPowerDownExits, 1 );
+    }
+
+    if ( cycle > srStart ) {
+        // Self-refresh needs every bank precharged, and the device refreshes itself
+        if ( m_openBanks ) {
+            record( statPreEnergy, m_power.preEnergy * m_openBanks );
+            m_openBanks = 0;
+        }
+        for ( unsigned i = 0; i < m_banks.size(); i++ ) {
+            m_banks[i].closeRow();
+        }
+        record( statBackgroundEnergy, ( cycle - srStart ) * m_power.selfRefresh );
+        record( statSelfRefreshCycles, cycle - srStart );
+        m_nextRefresh = cycle + m_power.tREFI;
+        exitLatency = m_power.tXS;
+        if ( exit ) record( statSelfRefreshExits, 1 );
+    }
+
+    m_powerCycle = cycle;
+    return exitLatency;
+}
+
+/* Standby energy and refreshes from m_powerCycle to 'cycle' */
+void TimingDRAM::Rank::accrueStandby( SimTime_t cycle )
+{
+    if ( cycle <= m_powerCycle ) {
+        return;
+    }
+    record( statBackgroundEnergy, ( cycle - m_powerCycle ) * ( m_openBanks ? m_power.actStandby : m_power.preStandby ) );
+    accrueRefresh( cycle );
+    m_powerCycle = cycle;
+}
+
+void TimingDRAM::Rank::accrueRefresh( SimTime_t cycle )
+{
+    if ( 0 == m_power.tREFI || cycle < m_nextRefresh ) {
+        return;
+    }
+    SimTime_t count = ( cycle - m_nextRefresh ) / m_power.tREFI + 1;
+    record( statRefreshEnergy, m_power.refreshEnergy * count );
+    m_nextRefresh += count * m_power.tREFI;
+}
+
 //==================================================================================
 // Bank
 //==================================================================================
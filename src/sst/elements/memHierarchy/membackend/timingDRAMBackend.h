@@ -14,6 +14,7 @@
 #define _H_SST_MEMH_TIMING_DRAM_BACKEND
 
 #include <queue>
+#include <limits>
 
 #include "sst/elements/memHierarchy/membackend/simpleMemBackend.h"
 #include "sst/elements/memHierarchy/membackend/timingAddrMapper.h"
@@ -41,6 +42,25 @@ public:
             {"channel.numRanks", "Number of ranks per channel", "1"},
             {"channel.transaction_Q_size", "Size of transaction queue", "32"},
             {"channel.rank.numBanks", "Number of banks per rank", "8"},
+            {"channel.rank.devices", "Number of DRAM devices per rank, the IDD currents are per device", "8"},
+            {"channel.rank.VDD", "Supply voltage (V)", "1.5"},
+            {"channel.rank.IDD0", "One bank ACT-PRE current (mA)", "55"},
+            {"channel.rank.IDD2P", "Precharge power-down current (mA)", "12"},
+            {"channel.rank.IDD2N", "Precharge standby current (mA)", "32"},
+            {"channel.rank.IDD3P", "Active power-down current (mA)", "17"},
+            {"channel.rank.IDD3N", "Active standby current (mA)", "38"},
+            {"channel.rank.IDD4R", "Burst read current (mA)", "157"},
+            {"channel.rank.IDD4W", "Burst write current (mA)", "128"},
+            {"channel.rank.IDD5", "Burst refresh current (mA)", "235"},
+            {"channel.rank.IDD6", "Self-refresh current (mA)", "12"},
+            {"channel.rank.tRAS", "ACT to PRE time in cycles, used for ACT/PRE energy", "28"},
+            {"channel.rank.tRFC", "Refresh cycle time in cycles", "128"},
+            {"channel.rank.tREFI", "Refresh interval in cycles, 0 for no refresh energy", "6240"},
+            {"channel.rank.tXP", "Power-down exit latency in cycles", "5"},
+            {"channel.rank.tXS", "Self-refresh exit latency in cycles", "136"},
+            {"channel.rank.powerDownDelay", "Cycles a rank must be quiet before it enters power-down, 0 to never power down", "0"},
+            {"channel.rank.selfRefreshDelay", "Cycles a rank must be quiet before it enters self-refresh, 0 to never self-refresh", "0"},
+            {"channel.rank.energyStats", "Register the per-rank energy and low-power statistics", "0"},
             {"channel.rank.bank.CL", "Column access latency in cycles", "11"},
             {"channel.rank.bank.CL_WR", "Column write latency", "11"},
             {"channel.rank.bank.RCD", "Row access latency in cycles", "11"},
@@ -49,6 +69,19 @@ public:
             {"channel.rank.bank.transactionQ", "Transaction queue model (subcomponent)", "memHierarchy.fifoTransactionQ"},
             {"channel.rank.bank.pagePolicy", "Policy subcomponent for managing row buffer", "memHierarchy.simplePagePolicy"})
 
+    /* Per-rank statistics, the subid is <channel>_<rank>. Only registered with channel.rank.energyStats set */
+    SST_ELI_DOCUMENT_STATISTICS(
+            {"act_energy", "Energy of ACT commands", "pJ", 1},
+            {"pre_energy", "Energy of PRE commands, including rows closed to enter self-refresh", "pJ", 1},
+            {"read_energy", "Energy of read bursts", "pJ", 1},
+            {"write_energy", "Energy of write bursts", "pJ", 1},
+            {"refresh_energy", "Energy of refreshes issued outside self-refresh", "pJ", 1},
+            {"background_energy", "Standby, power-down and self-refresh energy", "pJ", 1},
+            {"powerdown_cycles", "Cycles spent in power-down", "cycles", 1},
+            {"selfrefresh_cycles", "Cycles spent in self-refresh", "cycles", 1},
+            {"powerdown_exits", "Number of power-down exits", "count", 1},
+            {"selfrefresh_exits", "Number of self-refresh exits", "count", 1})
+
 /* Begin class definition */
 private:
     const uint64_t DBG_MASK = 0x1;
@@ -94,6 +127,16 @@ private:
         unsigned getRank() { return m_rank; }
         unsigned getBank() { return m_bank; }
 
+        /* Forget the open row, the rank precharged it to enter self-refresh */
+        void closeRow() {
+            m_row = -1;
+        }
+
+        /* Nothing left to do until a new transaction arrives */
+        bool isIdle() {
+            return m_cmdQ.empty() && NULL == m_lastCmd && ( m_row == (unsigned)-1 || m_pagePolicy->keepsRowOpen() );
+        }
+
       private:
         void update( SimTime_t );
         const char* prefix() { return m_pre.c_str(); }
@@ -201,6 +244,7 @@ private:
         unsigned getBank()      { return m_bank->getBank(); }
         unsigned getRow()       { return m_row; }
         Transaction* getTrans() { return m_trans; }
+        unsigned getDataCycles(){ return m_dataCycles; }
       private:
 
         Bank*           m_bank;
@@ -222,7 +266,7 @@ private:
       public:
         static const uint64_t DBG_MASK = (1 << 2); 
 
-        Rank( Component*, Params&, unsigned mc, unsigned chan, unsigned rank, Output*, AddrMapper* );
+        Rank( Component*, TimingDRAM* mem, Params&, unsigned mc, unsigned chan, unsigned rank, Output*, AddrMapper* );
         
         Cmd* popCmd( SimTime_t cycle, SimTime_t dataBusAvailCycle );
 
@@ -232,11 +276,65 @@ private:
             m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK,"bank=%d addr=%#" PRIx64 "\n",
                 bank,trans->addr);
 
+            if ( 0 == m_inFlight ) {
+                wake( trans->createTime );
+            }
+            m_inFlight++;
             m_banks[bank].pushTrans( trans );
         }
 
+        void retireTrans( SimTime_t cycle ) {
+            if ( 0 == --m_inFlight ) {
+                m_idleSince = cycle;
+            }
+        }
+
+        void issueCmd( Cmd*, SimTime_t cycle );
+        void finish( SimTime_t cycle );
+
+        bool isIdle() {
+            for ( unsigned i = 0; i < m_banks.size(); i++ ) {
+                if ( ! m_banks[i].isIdle() ) return false;
+            }
+            return true;
+        }
+
       private:
 
+        /*
+         * Energy follows the Micron IDD method: a command costs its current
+         * above standby over the time it takes, and the background costs the
+         * standby, power-down or self-refresh current for the time spent in
+         * each. Background energy is accrued whenever the rank changes state,
+         * so it is right even when the clock was off in between.
+         */
+        struct Power {
+            double      actEnergy;      // pJ per command
+            double      preEnergy;
+            double      readEnergy;     // pJ per data cycle
+            double      writeEnergy;
+            double      refreshEnergy;
+            double      actStandby;     // pJ per cycle
+            double      preStandby;
+            double      actPowerDown;
+            double      prePowerDown;
+            double      selfRefresh;
+            SimTime_t   tREFI;
+            SimTime_t   tXP;
+            SimTime_t   tXS;
+            SimTime_t   powerDownDelay;
+            SimTime_t   selfRefreshDelay;
+        };
+
+        void wake( SimTime_t cycle );
+        SimTime_t accrueLowPower( SimTime_t cycle, bool exit );
+        void accrueStandby( SimTime_t cycle );
+        void accrueRefresh( SimTime_t cycle );
+
+        // The statistics are NULL unless channel.rank.energyStats is set
+        void record( Statistic<double>* stat, double value ) { if ( stat ) stat->addData( value ); }
+        void record( Statistic<uint64_t>* stat, uint64_t value ) { if ( stat ) stat->addData( value ); }
+
         const char* prefix() { return m_pre.c_str(); }
         Output*         m_output;
         AddrMapper*     m_mapper;
@@ -244,6 +342,25 @@ private:
 
         unsigned            m_nextBankUp;
         std::vector<Bank>   m_banks;
+
+        Power               m_power;
+        unsigned            m_openBanks;    // Banks with an ACT issued and no PRE since
+        unsigned            m_inFlight;     // Transactions pushed and not yet retired
+        SimTime_t           m_idleSince;    // Cycle m_inFlight last dropped to zero
+        SimTime_t           m_powerCycle;   // Background energy is accrued up to this cycle
+        SimTime_t           m_nextRefresh;
+        SimTime_t           m_readyCycle;   // No command may issue before this, set on power-down/self-refresh exit
+
+        Statistic<double>*      statActEnergy;
+        Statistic<double>*      statPreEnergy;
+        Statistic<double>*      statReadEnergy;
+        Statistic<double>*      statWriteEnergy;
+        Statistic<double>*      statRefreshEnergy;
+        Statistic<double>*      statBackgroundEnergy;
+        Statistic<uint64_t>*    statPowerDownCycles;
+        Statistic<uint64_t>*    statSelfRefreshCycles;
+        Statistic<uint64_t>*    statPowerDownExits;
+        Statistic<uint64_t>*    statSelfRefreshExits;
     };
 
     class Channel {
@@ -274,6 +391,20 @@ private:
 
         void clock(SimTime_t );
 
+        bool isIdle() {
+            if ( m_pendingCount || ! m_issuedCmds.empty() ) return false;
+            for ( unsigned i = 0; i < m_ranks.size(); i++ ) {
+                if ( ! m_ranks[i].isIdle() ) return false;
+            }
+            return true;
+        }
+
+        void finish( SimTime_t cycle ) {
+            for ( unsigned i = 0; i < m_ranks.size(); i++ ) {
+                m_ranks[i].finish( cycle );
+            }
+        }
+
       private:
         Cmd* popCmd( SimTime_t cycle, SimTime_t dataBusAvailCycle );
         const char* prefix() { return m_pre.c_str(); }
@@ -304,13 +435,16 @@ public:
         handleMemResponse( id );
     }
     virtual bool clock(Cycle_t cycle);
-    virtual void finish() {}
+    virtual void turnClockOn(Cycle_t cycle);
+    virtual void finish();
 
 private:
 
     std::vector<Channel> m_channels;
     AddrMapper* m_mapper;
     SimTime_t   m_cycle;
+    Cycle_t     m_lastClock;    // Parent cycle of the last call to clock()
+    bool        m_idle;         // Last call to clock() let the parent turn its clock off
 
 };
 
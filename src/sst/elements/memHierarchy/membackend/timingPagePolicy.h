@@ -23,6 +23,9 @@ class PagePolicy : public SST::SubComponent {
   public:
     PagePolicy( Component* owner, Params& params ) : SubComponent( owner)  { }
     virtual bool shouldClose( SimTime_t current ) = 0;
+
+    /* True if shouldClose() will keep returning false for an open row, so it need not be polled while idle */
+    virtual bool keepsRowOpen() { return false; }
 };
 
 class SimplePagePolicy : public PagePolicy {
@@ -41,6 +44,8 @@ class SimplePagePolicy : public PagePolicy {
     bool shouldClose( SimTime_t current ) {
         return m_close;
     }
+
+    bool keepsRowOpen() { return !m_close; }
   protected:
     bool m_close;
 };
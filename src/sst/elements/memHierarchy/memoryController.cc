@@ -187,14 +187,14 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
     if (!found) {
         bool oldBackVal = params.find<bool>("do_not_back", false, found);
         if (found) {
-            out.output("%s, ** Found deprecated parameter: do_not_back ** Use 'backing' parameter instead and specify 'none', 'malloc', or 'mmap'. Remove this parameter from your input deck to eliminate this message.\n", 
+            out.output("%s, ** Found deprecated parameter: do_not_back ** Use 'backing' parameter instead and specify 'none', 'malloc', 'mmap', or 'sparse'. Remove this parameter from your input deck to eliminate this message.\n", 
                     getName().c_str());
         }
         if (oldBackVal) backingType = "none";
     }
 
-    if (backingType != "none" && backingType != "mmap" && backingType != "malloc") {
-        out.fatal(CALL_INFO, -1, "%s, Error - Invalid param: backing. Must be one of 'none', 'malloc', or 'mmap'. You specified: %s\n",
+    if (backingType != "none" && backingType != "mmap" && backingType != "malloc" && backingType != "sparse") {
+        out.fatal(CALL_INFO, -1, "%s, Error - Invalid param: backing. Must be one of 'none', 'malloc', 'mmap', or 'sparse'. You specified: %s\n",
                 getName().c_str(), backingType.c_str());
     }
         
@@ -232,6 +232,32 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
         }
     } else if (backingType == "malloc") {
         backing_ = new Backend::BackingMalloc(sizeBytes);
+    } else if (backingType == "sparse") {
+        try {
+            backing_ = new Backend::BackingSparseMMAP( memBackendConvertor_->getMemSize() );
+        }
+        catch ( int ) {
+            out.output("%s, Could not MMAP sparse backing store. Creating malloc based store instead.\n", getName().c_str());
+            backing_ = new Backend::BackingMalloc(sizeBytes);
+        }
+    }
+
+    std::string restoreFile = params.find<std::string>("backing_restore_file", "");
+    backingDumpFile_ = params.find<std::string>("backing_dump_file", "");
+    if (!restoreFile.empty() || !backingDumpFile_.empty()) {
+        Backend::BackingSparseMMAP* sparse = dynamic_cast<Backend::BackingSparseMMAP*>(backing_);
+        if (!sparse) {
+            out.fatal(CALL_INFO, -1, "%s, Error - backing_restore_file and backing_dump_file require a 'sparse' backing store. Backing is: %s\n",
+                    getName().c_str(), backingType.c_str());
+        }
+        if (!restoreFile.empty()) {
+            int fd = open(restoreFile.c_str(), O_RDONLY);
+            if (fd < 0 || !sparse->restore(fd)) {
+                out.fatal(CALL_INFO, -1, "%s, Error - unable to restore backing store from backing_restore_file. You specified '%s'.\n",
+                        getName().c_str(), restoreFile.c_str());
+            }
+            close(fd);
+        }
     }
 
     /* Clock Handler */
@@ -442,6 +468,16 @@ void MemController::finish(void) {
     }
     memBackendConvertor_->finish();
     link_->finish();
+
+    if (!backingDumpFile_.empty()) {
+        Backend::BackingSparseMMAP* sparse = static_cast<Backend::BackingSparseMMAP*>(backing_);
+        int fd = open(backingDumpFile_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0 || !sparse->dump(fd)) {
+            out.fatal(CALL_INFO, -1, "%s, Error - unable to dump backing store to backing_dump_file. You specified '%s'.\n",
+                    getName().c_str(), backingDumpFile_.c_str());
+        }
+        close(fd);
+    }
 }
 
 void MemController::writeData(MemEvent* event) {
@@ -486,8 +522,7 @@ void MemController::readData(MemEvent* event) {
 void MemController::writeData(Addr addr, std::vector<uint8_t> * data) {
     if (!backing_) return;
 
-    for (size_t i = 0; i < data->size(); i++)
-        backing_->set(addr + i, data->at(i));
+    backing_->set(addr, data->size(), *data);
 }
 
 
@@ -496,8 +531,7 @@ void MemController::readData(Addr addr, size_t bytes, std::vector<uint8_t> &data
     
     if (!backing_) return;
 
-    for (size_t i = 0; i < bytes; i++)
-        data[i] = backing_->get(addr + i);
+    backing_->get(addr, bytes, data);
 }
 
 
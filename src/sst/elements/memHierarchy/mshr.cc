@@ -61,6 +61,55 @@ MSHR::MSHR(Output* debug, int maxSize, string cacheName, std::set<Addr> debugAdd
     d2_->init("", 10, 0, (Output::output_location_t)1);
 
     DEBUG_ADDR = debugAddr;
+
+    statProbeLength_ = nullptr;
+
+    /* Size the table so that a full MSHR stays lightly loaded; it grows if acks/writebacks need more */
+    int capacity = 2 * (maxSize_ < 4096 ? maxSize_ : 4096);
+    map_ = mshrTable(capacity);
+}
+
+MSHR::~MSHR() {
+    for (mshrTable::iterator it = map_.begin(); it != map_.end(); ++it)
+        delete it.value();
+    for (vector<mshrEntry*>::iterator it = freeEntries_.begin(); it != freeEntries_.end(); it++)
+        delete *it;
+    delete d2_;
+}
+
+mshrEntry* MSHR::findEntry(Addr baseAddr) {
+    mshrEntry ** entry = map_.find(baseAddr);
+    if (statProbeLength_) statProbeLength_->addData(map_.lastProbeLength());
+    return entry ? *entry : nullptr;
+}
+
+mshrEntry* MSHR::getEntry(Addr baseAddr) {
+    mshrEntry * entry = findEntry(baseAddr);
+    if (entry) return entry;
+
+    if (freeEntries_.empty()) {
+        entry = new mshrEntry();
+    } else {
+        entry = freeEntries_.back();
+        freeEntries_.pop_back();
+    }
+    entry->acksNeeded = 0;
+    map_.insert(baseAddr, entry);
+    return entry;
+}
+
+void MSHR::eraseEntry(Addr baseAddr, mshrEntry* entry) {
+    if (is_debug_addr(baseAddr)) d_->debug(_L9_, "\tMSHR erasing 0x%" PRIx64 "\n", baseAddr);
+    map_.erase(baseAddr);
+    /* clear() keeps vector capacity for the next user of this entry */
+    entry->mshrQueue.clear();
+    entry->dataBuffer.clear();
+    freeEntries_.push_back(entry);
+}
+
+void MSHR::eraseIfEmpty(Addr baseAddr, mshrEntry* entry) {
+    if ((entry->acksNeeded == 0) && entry->dataBuffer.empty() && entry->mshrQueue.empty())
+        eraseEntry(baseAddr, entry);
 }
 
 
@@ -79,115 +128,101 @@ bool MSHR::isFull() {
 }
 
 int MSHR::getAcksNeeded(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) return 0;
-    return (it->second).acksNeeded;
+    mshrEntry * entry = findEntry(baseAddr);
+    if (entry == nullptr) return 0;
+    return entry->acksNeeded;
 }
 
 
 void MSHR::setAcksNeeded(Addr baseAddr, int acksNeeded, MemEvent * event) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) {
+    mshrEntry * entry = findEntry(baseAddr);
+    if (entry == nullptr) {
         if (is_debug_addr(baseAddr)) d_->debug(_L6_, "\tCreating new MSHR holder for acks\n");
         
-        mshrEntry entry;
-        entry.acksNeeded = acksNeeded;
-        entry.dataBuffer.clear();
+        entry = getEntry(baseAddr);
+        entry->acksNeeded = acksNeeded;
         if (event != nullptr)
-            entry.mshrQueue.push_back(mshrType(event));
-        map_[baseAddr] = entry;
+            entry->mshrQueue.push_back(mshrType(event));
         return;
     }
-    (it->second).acksNeeded = acksNeeded;
+    entry->acksNeeded = acksNeeded;
 }
 
 void MSHR::incrementAcksNeeded(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) {
-        mshrEntry entry;
-        entry.acksNeeded = 1;
-        map_[baseAddr] = entry;
-    } else {
-        (it->second).acksNeeded++;
-    }
+    getEntry(baseAddr)->acksNeeded++;
 }
 
 void MSHR::decrementAcksNeeded(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) return;
-    (it->second).acksNeeded--;
-    if (((it->second).acksNeeded == 0) && (it->second).dataBuffer.empty() && (it->second).mshrQueue.empty()) {
-        if (is_debug_addr(baseAddr)) d_->debug(_L9_, "\tMSHR erasing 0x%" PRIx64 "\n", baseAddr);
-        
-        map_.erase(it);
-    }
+    mshrEntry * entry = findEntry(baseAddr);
+    if (entry == nullptr) return;
+    entry->acksNeeded--;
+    eraseIfEmpty(baseAddr, entry);
 }
 
 void MSHR::setDataBuffer(Addr baseAddr, vector<uint8_t>& data) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: No pending request for response event. Addr = 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
-    (it->second).dataBuffer = data;
+    mshrEntry * entry = findEntry(baseAddr);
+    if (entry == nullptr) d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: No pending request for response event. Addr = 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
+    entry->dataBuffer.assign(data.begin(), data.end());
 }
 
 vector<uint8_t> * MSHR::getDataBuffer(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) return NULL;
-    return &((it->second).dataBuffer);
+    mshrEntry * entry = findEntry(baseAddr);
+    if (entry == nullptr) return NULL;
+    return &(entry->dataBuffer);
 }
 
 void MSHR::clearDataBuffer(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it != map_.end()) (it->second).dataBuffer.clear();
-    if (((it->second).acksNeeded == 0) && (it->second).dataBuffer.empty() && (it->second).mshrQueue.empty()) {
-        if (is_debug_addr(baseAddr)) d_->debug(_L9_, "\tMSHR erasing 0x%" PRIx64 "\n", baseAddr);
-        
-        map_.erase(it);
-    }
+    mshrEntry * entry = findEntry(baseAddr);
+    if (entry == nullptr) return;
+    entry->dataBuffer.clear();
+    eraseIfEmpty(baseAddr, entry);
 }
 
 bool MSHR::isDataBufferValid(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it != map_.end()) (it->second).dataBuffer.clear();
+    mshrEntry * entry = findEntry(baseAddr);
+    if (entry != nullptr) entry->dataBuffer.clear();
     return false;
 }
 
 bool MSHR::exists(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) return false;
-    vector<mshrType> * queue = &((it->second).mshrQueue);
+    mshrEntry * entry = findEntry(baseAddr);
+    if (entry == nullptr) return false;
+    vector<mshrType> * queue = &(entry->mshrQueue);
     vector<mshrType>::iterator frontEntry = queue->begin();
     if (frontEntry == queue->end()) return false;
     return (frontEntry->elem.isEvent());
 }
 
-bool MSHR::isHit(Addr baseAddr) { return (map_.find(baseAddr) != map_.end()) && (map_.find(baseAddr)->second.mshrQueue.size() > 0); }
+bool MSHR::isHit(Addr baseAddr) { 
+    mshrEntry * entry = findEntry(baseAddr);
+    return (entry != nullptr) && (entry->mshrQueue.size() > 0); 
+}
 
 bool MSHR::pendingWriteback(Addr baseAddr) {
     mshrType entry = mshrType(baseAddr);
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) return false;
+    mshrEntry * mshrEnt = findEntry(baseAddr);
+    if (mshrEnt == nullptr) return false;
 
-    vector<mshrType>& res = (it->second).mshrQueue;
+    vector<mshrType>& res = mshrEnt->mshrQueue;
     vector<mshrType>::iterator itv = std::find_if(res.begin(), res.end(), MSHREntryCompare(&entry));
     return (itv != res.end());
 }
 
-const vector<mshrType> MSHR::lookup(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) {
+const vector<mshrType>& MSHR::lookup(Addr baseAddr) {
+    mshrEntry * entry = findEntry(baseAddr);
+    if (entry == nullptr) {
         d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: mshr did not find entry with address 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
     }
-    vector<mshrType> res = (it->second).mshrQueue;
-    return res;
+    return entry->mshrQueue;
 }
 
 
 MemEvent* MSHR::lookupFront(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) {
+    mshrEntry * entry = findEntry(baseAddr);
+    if (entry == nullptr) {
         d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: mshr did not find entry with address 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
     }
-    vector<mshrType> queue = (it->second).mshrQueue;
+    vector<mshrType> &queue = entry->mshrQueue;
     if (queue.front().elem.isAddr()) {
         d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: front entry in mshr is not of type MemEvent. Addr = 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
     }
@@ -214,7 +249,7 @@ bool MSHR::insert(Addr baseAddr, MemEvent* event) {
     
     if (is_debug_addr(baseAddr)) {
         d_->debug(_L9_, "\tMSHR: Event Inserted. Key addr = %" PRIx64 ", event Addr = %" PRIx64 ", Cmd = %s, MSHR Size = %u, Entry Size = %zu\n", 
-                baseAddr, event->getAddr(), CommandString[(int)event->getCmd()], size_, map_[baseAddr].mshrQueue.size());
+                baseAddr, event->getAddr(), CommandString[(int)event->getCmd()], size_, getEntry(baseAddr)->mshrQueue.size());
     }
 
     return true;
@@ -238,16 +273,8 @@ bool MSHR::insertWriteback(Addr keyAddr) {
     
     mshrType mshrElement = mshrType(keyAddr);
 
-    mshrTable::iterator it = map_.find(keyAddr);
-    if (it == map_.end()) {
-        mshrEntry newEntry;
-        newEntry.acksNeeded = 0;
-        newEntry.dataBuffer.clear();
-        map_[keyAddr] = newEntry;
-    }
-
-    vector<mshrType>::iterator itv = map_[keyAddr].mshrQueue.begin();
-    map_[keyAddr].mshrQueue.insert(itv, mshrElement);
+    mshrEntry * entry = getEntry(keyAddr);
+    entry->mshrQueue.insert(entry->mshrQueue.begin(), mshrElement);
     //printTable();
     
     return true;
@@ -259,7 +286,7 @@ bool MSHR::insertInv(Addr baseAddr, MemEvent* event, bool inProgress) {
     if (LIKELY(ret)) {
         if (is_debug_addr(baseAddr)) {
             d_->debug(_L9_, "\tMSHR: Event Inserted. Key addr = %" PRIx64 ", event Addr = %" PRIx64 ", Cmd = %s, MSHR Size = %u, Entry Size = %zu\n", 
-                    baseAddr, event->getAddr(), CommandString[(int)event->getCmd()], size_, map_[baseAddr].mshrQueue.size());
+                    baseAddr, event->getAddr(), CommandString[(int)event->getCmd()], size_, getEntry(baseAddr)->mshrQueue.size());
         }
     } else if (is_debug_addr(baseAddr)) d_->debug(_L9_, "\tMSHR Full.  Event could not be inserted.\n");
     
@@ -268,16 +295,8 @@ bool MSHR::insertInv(Addr baseAddr, MemEvent* event, bool inProgress) {
 
 bool MSHR::insertAll(Addr baseAddr, vector<mshrType>& events) {
     if (events.empty()) return false;
-    mshrTable::iterator it = map_.find(baseAddr);
-    
-    if (it != map_.end()) (it->second).mshrQueue.insert((it->second).mshrQueue.end(), events.begin(), events.end());
-    else {
-        mshrEntry entry;
-        entry.mshrQueue = events;
-        entry.acksNeeded = 0;
-        entry.dataBuffer.clear();
-        map_[baseAddr] = entry;
-    }
+    mshrEntry * entry = getEntry(baseAddr);
+    entry->mshrQueue.insert(entry->mshrQueue.end(), events.begin(), events.end());
     
     int trueSize = 0;
     int prefetches = 0;
@@ -298,14 +317,7 @@ bool MSHR::insertAll(Addr baseAddr, vector<mshrType>& events) {
 
 /* Private insertion methods called by public inserts */
 bool MSHR::insert(Addr baseAddr, mshrType entry) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) {
-        mshrEntry entry;
-        entry.acksNeeded = 0;
-        entry.dataBuffer.clear();
-        map_[baseAddr] = entry;
-    }
-    map_[baseAddr].mshrQueue.push_back(entry);
+    getEntry(baseAddr)->mshrQueue.push_back(entry);
     //printTable();
     
     return true;
@@ -314,9 +326,10 @@ bool MSHR::insert(Addr baseAddr, mshrType entry) {
 bool MSHR::insertInv(Addr baseAddr, mshrType entry, bool inProgress) {
     if (size_ >= maxSize_) return false;
     
-    vector<mshrType>::iterator it = map_[baseAddr].mshrQueue.begin();
-    if (inProgress && map_[baseAddr].mshrQueue.size() > 0) it++;
-    map_[baseAddr].mshrQueue.insert(it, entry);
+    vector<mshrType> &queue = getEntry(baseAddr)->mshrQueue;
+    vector<mshrType>::iterator it = queue.begin();
+    if (inProgress && queue.size() > 0) it++;
+    queue.insert(it, entry);
     if (entry.elem.isEvent()) size_++;
     //printTable();
     return true;
@@ -328,10 +341,10 @@ bool MSHR::insertInv(Addr baseAddr, mshrType entry, bool inProgress) {
 
 
 
-MemEvent* MSHR::getOldestRequest() const {
+MemEvent* MSHR::getOldestRequest() {
     MemEvent *ev = NULL;
-    for ( mshrTable::const_iterator it = map_.begin() ; it != map_.end() ; ++it ) {
-        for ( vector<mshrType>::const_iterator jt = (it->second).mshrQueue.begin() ; jt != (it->second).mshrQueue.end() ; jt++ ) {
+    for ( mshrTable::iterator it = map_.begin() ; it != map_.end() ; ++it ) {
+        for ( vector<mshrType>::const_iterator jt = it.value()->mshrQueue.begin() ; jt != it.value()->mshrQueue.end() ; jt++ ) {
             if ( jt->elem.isEvent() ) {
                 MemEvent *me = (jt->elem).getEvent();
                 if ( !ev || ( me->getInitializationTime() < ev->getInitializationTime() ) ) {
@@ -345,27 +358,23 @@ MemEvent* MSHR::getOldestRequest() const {
 }
 
 vector<mshrType>* MSHR::getAll(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) {
+    mshrEntry * entry = findEntry(baseAddr);
+    if (entry == nullptr) {
         d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: mshr did not find entry with address 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
     }
-    return &((it->second).mshrQueue); 
+    return &(entry->mshrQueue); 
 }
 
 
-vector<mshrType> MSHR::removeAll(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) {
+/* Moves the queue into 'res' without copying it, the entry takes over whatever storage 'res' had */
+void MSHR::removeAll(Addr baseAddr, vector<mshrType>& res) {
+    mshrEntry * entry = findEntry(baseAddr);
+    if (entry == nullptr) {
         d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: mshr did not find entry with address 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
     }
-    vector<mshrType> res = (it->second).mshrQueue;
-    if ((it->second).acksNeeded == 0 && (it->second).dataBuffer.empty()) {
-        if (is_debug_addr(baseAddr)) d_->debug(_L9_, "\tMSHR erasing 0x%" PRIx64 "\n", baseAddr);
-        
-        map_.erase(it);
-    } else {
-        (it->second).mshrQueue.clear();
-    }
+    res.clear();
+    res.swap(entry->mshrQueue);
+    eraseIfEmpty(baseAddr, entry);
     int trueSize = 0;
     int prefetches = 0;
     for (vector<mshrType>::iterator it = res.begin(); it != res.end(); it++) {
@@ -381,12 +390,11 @@ vector<mshrType> MSHR::removeAll(Addr baseAddr) {
     if (size_ < 0) {
         d2_->fatal(CALL_INFO, -1, "%s (MSHR), Error: mshr size < 0 after removing all elements for addr = 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
     }
-    return res;
 }
 
 MemEvent* MSHR::removeFront(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) {
+    mshrEntry * entry = findEntry(baseAddr);
+    if (entry == nullptr) {
         d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: mshr did not find entry with address 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
     }
     //if (it->second.empty()) {
@@ -397,15 +405,12 @@ MemEvent* MSHR::removeFront(Addr baseAddr) {
     //     d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: front entry in mshr is not of type MemEvent. Addr = 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
     // }
     
-    MemEvent* ret = ((it->second).mshrQueue.front().elem).getEvent();
+    MemEvent* ret = (entry->mshrQueue.front().elem).getEvent();
     
     if (ret->isPrefetch()) prefetchCount_--;
     
-    (it->second).mshrQueue.erase(it->second.mshrQueue.begin());
-    if (((it->second).acksNeeded == 0) && (it->second).dataBuffer.empty() && (it->second).mshrQueue.empty()) {
-        if (is_debug_addr(baseAddr)) d_->debug(_L9_, "\tMSHR erasing 0x%" PRIx64 "\n", baseAddr);
-        map_.erase(it);
-    }
+    entry->mshrQueue.erase(entry->mshrQueue.begin());
+    eraseIfEmpty(baseAddr, entry);
     
     size_--;
     
@@ -436,22 +441,18 @@ void MSHR::removeElement(Addr baseAddr, Addr pointer) {
 
 bool MSHR::removeElement(Addr baseAddr, mshrType entry) {
 
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) return false;    
+    mshrEntry * mshrEnt = findEntry(baseAddr);
+    if (mshrEnt == nullptr) return false;    
    
-    if (is_debug_addr(baseAddr)) d_->debug(_L9_,"\tMSHR Entry size = %zu\n", it->second.mshrQueue.size());
+    if (is_debug_addr(baseAddr)) d_->debug(_L9_,"\tMSHR Entry size = %zu\n", mshrEnt->mshrQueue.size());
     
-    vector<mshrType>& res = (it->second).mshrQueue;
+    vector<mshrType>& res = mshrEnt->mshrQueue;
     vector<mshrType>::iterator itv = std::find_if(res.begin(), res.end(), MSHREntryCompare(&entry));
     
     if (itv == res.end()) return false;
     res.erase(std::remove_if(res.begin(), res.end(), MSHREntryCompare(&entry)), res.end());
 
-    if (((it->second).acksNeeded == 0) && (it->second).dataBuffer.empty() && (it->second).mshrQueue.empty()) {
-        if (is_debug_addr(baseAddr)) d_->debug(_L9_, "\tMSHR erasing 0x%" PRIx64 "\n", baseAddr);
-        
-        map_.erase(it);
-    }
+    eraseIfEmpty(baseAddr, mshrEnt);
     
     if (is_debug_addr(baseAddr)) d_->debug(_L9_, "\tMSHR Removed Event\n");
     //printTable();
@@ -467,12 +468,12 @@ void MSHR::removeWriteback(Addr baseAddr) {
 bool MSHR::elementIsHit(Addr baseAddr, MemEvent *event) {
     mshrType entry = mshrType(event);
 
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) return false;    
+    mshrEntry * mshrEnt = findEntry(baseAddr);
+    if (mshrEnt == nullptr) return false;    
     
-    if (is_debug_addr(baseAddr)) d_->debug(_L9_,"\tMSHR Entry size = %zu\n", it->second.mshrQueue.size());
+    if (is_debug_addr(baseAddr)) d_->debug(_L9_,"\tMSHR Entry size = %zu\n", mshrEnt->mshrQueue.size());
     
-    vector<mshrType>& res = (it->second).mshrQueue;
+    vector<mshrType>& res = mshrEnt->mshrQueue;
     vector<mshrType>::iterator itv = std::find_if (res.begin(), res.end(), MSHREntryCompare(&entry));
     
     if (itv == res.end()) return false;
@@ -481,9 +482,9 @@ bool MSHR::elementIsHit(Addr baseAddr, MemEvent *event) {
 
 
 void MSHR::printTable() {
-    for (mshrTable::iterator it = map_.begin(); it != map_.end(); it++) {
-        vector<mshrType> entries = (it->second).mshrQueue;
-        d_->debug(_L9_, "\tMSHR: Addr = 0x%" PRIx64 "\n", (it->first));
+    for (mshrTable::iterator it = map_.begin(); it != map_.end(); ++it) {
+        vector<mshrType> &entries = it.value()->mshrQueue;
+        d_->debug(_L9_, "\tMSHR: Addr = 0x%" PRIx64 "\n", it.key());
         for (vector<mshrType>::iterator it2 = entries.begin(); it2 != entries.end(); it2++) {
             if (it2->elem.isAddr()) {
                 Addr ptr = (it2->elem).getAddr();
@@ -510,9 +511,9 @@ void MSHR::printTable() {
 
 void MSHR::printStatus(Output &out) {
     out.output("    MSHR Status for %s. Size: %u. Prefetches: %u\n", ownerName_.c_str(), size_, prefetchCount_);
-    for (mshrTable::iterator it = map_.begin(); it != map_.end(); it++) {
-        vector<mshrType> entries = (it->second).mshrQueue;
-        out.output("      Entry: Addr = 0x%" PRIx64 " Acks needed: %d\n", (it->first), it->second.acksNeeded);
+    for (mshrTable::iterator it = map_.begin(); it != map_.end(); ++it) {
+        vector<mshrType> &entries = it.value()->mshrQueue;
+        out.output("      Entry: Addr = 0x%" PRIx64 " Acks needed: %d\n", it.key(), it.value()->acksNeeded);
         for (vector<mshrType>::iterator it2 = entries.begin(); it2 != entries.end(); it2++) {
             if (it2->elem.isAddr()) {
                 Addr ptr = (it2->elem).getAddr();
@@ -27,6 +27,7 @@
 
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/util.h"
+#include "sst/elements/memHierarchy/addrHashMap.h"
 
 namespace SST { namespace MemHierarchy {
 
@@ -71,7 +72,8 @@ struct mshrEntry {
     vector<uint8_t> dataBuffer;   // Temporary holding place for response data during replay of request events (for non-inclusive caches)
 };
 
-typedef map<Addr, mshrEntry >   mshrTable;
+/* Entries are pooled by the MSHR; the table maps a line address to its entry */
+typedef AddrHashMap<mshrEntry*>  mshrTable;
 
 #define HUGE_MSHR 100000
 
@@ -83,6 +85,7 @@ public:
         
     // used externally
     MSHR(Output* dbg, int maxSize, string cacheName, std::set<Addr> debugAddr);
+    ~MSHR();
     bool exists(Addr baseAddr);                             
     vector<mshrType>* getAll(Addr);                       
     
@@ -94,18 +97,21 @@ public:
     
     MemEvent* removeFront(Addr baseAddr);                  
     void removeElement(Addr baseAddr, MemEvent* event);     
-    vector<mshrType> removeAll(Addr);                       
+    void removeAll(Addr, vector<mshrType>&);                
     void removeWriteback(Addr baseAddr);
 
-    const vector<mshrType> lookup(Addr baseAddr);           
+    const vector<mshrType>& lookup(Addr baseAddr);          
     bool isHit(Addr baseAddr);                              
     bool elementIsHit(Addr baseAddr, MemEvent *event);
     bool isFull();                                          // external
     bool isAlmostFull();                                    // external
-    MemEvent* getOldestRequest() const;                     // external
+    MemEvent* getOldestRequest();                           // external
     bool pendingWriteback(Addr baseAddr);
     unsigned int getSize(){ return size_; }                 
     unsigned int getPrefetchCount() { return prefetchCount_; }
+    
+    /** Record the number of table slots examined by each address lookup */
+    void setProbeLengthStatistic(Statistic<uint64_t>* stat) { statProbeLength_ = stat; }
 
     // Bookkeeping getters/setters
     int getAcksNeeded(Addr baseAddr);
@@ -134,7 +140,15 @@ public:
     void printTable();
 
 private:
+    /* Table access - entries are recycled through freeEntries_ so that steady-state misses don't allocate */
+    mshrEntry* findEntry(Addr baseAddr);
+    mshrEntry* getEntry(Addr baseAddr);     // Create if not found
+    void eraseEntry(Addr baseAddr, mshrEntry* entry);
+    void eraseIfEmpty(Addr baseAddr, mshrEntry* entry);
+
     mshrTable map_;
+    vector<mshrEntry*> freeEntries_;
+    Statistic<uint64_t>* statProbeLength_;
     Output* d_;
     Output* d2_;
     int size_;
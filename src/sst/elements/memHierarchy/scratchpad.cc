@@ -127,14 +127,14 @@ Scratchpad::Scratchpad(ComponentId_t id, Params &params) : Component(id) {
     if (!found) {
         bool oldBackVal = params.find<bool>("do_not_back", false, found);
         if (found) {
-            out.output("%s, ** Found deprecated parameter: do_not_back ** Use 'backing' parameter instead and specify 'none', 'malloc', or 'mmap'. Remove this parameter from your input deck to eliminate this message.\n", 
+            out.output("%s, ** Found deprecated parameter: do_not_back ** Use 'backing' parameter instead and specify 'none', 'malloc', 'mmap', or 'sparse'. Remove this parameter from your input deck to eliminate this message.\n", 
                     getName().c_str());
         }
         if (oldBackVal) backingType = "none";
     }
 
-    if (backingType != "none" && backingType != "mmap" && backingType != "malloc") {
-        out.fatal(CALL_INFO, -1, "%s, Error - Invalid param: backing. Must be one of 'none', 'malloc', or 'mmap'. You specified: %s\n",
+    if (backingType != "none" && backingType != "mmap" && backingType != "malloc" && backingType != "sparse") {
+        out.fatal(CALL_INFO, -1, "%s, Error - Invalid param: backing. Must be one of 'none', 'malloc', 'mmap', or 'sparse'. You specified: %s\n",
                 getName().c_str(), backingType.c_str());
     }
         
@@ -171,6 +171,14 @@ Scratchpad::Scratchpad(ComponentId_t id, Params &params) : Component(id) {
         }
     } else if (backingType == "malloc") {
         backing_ = new Backend::BackingMalloc(sizeBytes);
+    } else if (backingType == "sparse") {
+        try {
+            backing_ = new Backend::BackingSparseMMAP( scratch_->getMemSize() );
+        }
+        catch ( int ) {
+            out.output("%s, Could not MMAP sparse backing store. Creating malloc based store instead.\n", getName().c_str());
+            backing_ = new Backend::BackingMalloc(sizeBytes);
+        }
     }
 
     // Assume no caching, may change during init
@@ -301,7 +309,7 @@ void Scratchpad::init(unsigned int phase) {
             }
         } else { // Not a NULLCMD
             MemEventInit * memRequest = new MemEventInit(getName(), initEv->getCmd(), initEv->getAddr() - remoteAddrOffset_, initEv->getPayload());
-            memRequest->setDst(linkDown_->findTargetDestination(memRequest->getAddr()));
+            memRequest->setDstID(linkDown_->findTargetDestinationID(memRequest->getAddr()));
             linkDown_->sendInitData(memRequest);
         }
         delete initEv;
@@ -448,7 +456,7 @@ bool Scratchpad::clock(Cycle_t cycle) {
 
     while (!memMsgQueue_.empty() && memMsgQueue_.begin()->first < timestamp_) {
         MemEvent * sendEv = memMsgQueue_.begin()->second;
-        sendEv->setDst(linkDown_->findTargetDestination(sendEv->getBaseAddr()));
+        sendEv->setDstID(linkDown_->findTargetDestinationID(sendEv->getBaseAddr()));
         
         if (is_debug_event(sendEv)) {
             if (!debug) dbg.debug(_L4_, "\n");
@@ -518,7 +526,7 @@ void Scratchpad::handleScratchRead(MemEvent * ev) {
         response->setCmd(Command::GetXResp);
 
     MemEvent * read = new MemEvent(this, ev->getAddr(), ev->getBaseAddr(), Command::GetS, ev->getSize());
-    read->setRqstr(ev->getRqstr());
+    read->setRqstrID(ev->getRqstrID());
     read->setVirtualAddress(ev->getVirtualAddress());
     read->setInstructionPointer(ev->getInstructionPointer());
 
@@ -596,7 +604,7 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
     response = ev->makeResponse();
 
     MemEvent * write = new MemEvent(this, ev->getAddr(), ev->getBaseAddr(), Command::PutM, ev->getPayload());
-    write->setRqstr(ev->getRqstr());
+    write->setRqstrID(ev->getRqstrID());
     write->setVirtualAddress(ev->getVirtualAddress());
     write->setInstructionPointer(ev->getInstructionPointer());
     write->setFlag(MemEvent::F_NORESPONSE);
@@ -668,7 +676,7 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
     ev->setSrcBaseAddr((ev->getSrcAddr() - remoteAddrOffset_) & ~(remoteLineSize_ - 1));
     MemEvent * remoteRead = new MemEvent(this, ev->getSrcAddr() - remoteAddrOffset_, ev->getSrcBaseAddr(), Command::GetS, ev->getSize());
     remoteRead->setFlag(MemEvent::F_NONCACHEABLE);
-    remoteRead->setRqstr(ev->getRqstr());
+    remoteRead->setRqstrID(ev->getRqstrID());
     remoteRead->setVirtualAddress(ev->getSrcVirtualAddress());
     remoteRead->setInstructionPointer(ev->getInstructionPointer());
     responseIDMap_.insert(std::make_pair(remoteRead->getID(), ev->getID()));
@@ -831,7 +839,7 @@ void Scratchpad::handleAckInv(MemEventBase * event) {
         uint32_t size = deriveSize(addr, baseAddr, request->getSrcAddr(), request->getSize());
         
         MemEvent * read = new MemEvent(this, addr, baseAddr, Command::GetS, size);
-        read->setRqstr(request->getRqstr());
+        read->setRqstrID(request->getRqstrID());
         read->setVirtualAddress(request->getSrcVirtualAddress());
         read->setInstructionPointer(request->getInstructionPointer());
         responseIDMap_.insert(std::make_pair(read->getID(),requestID));
@@ -876,7 +884,7 @@ void Scratchpad::handleFetchResp(MemEventBase * event) {
     // Send a write to scratch if the line was dirty since we forcefully invalidated
     if (response->getDirty()) {
         MemEvent * write = new MemEvent(this, response->getAddr(), baseAddr, Command::PutM, response->getPayload());
-        write->setRqstr(put->getRqstr());
+        write->setRqstrID(put->getRqstrID());
         write->setVirtualAddress(put->getSrcVirtualAddress());
         write->setInstructionPointer(put->getInstructionPointer());
         write->setFlag(MemEvent::F_NORESPONSE);
@@ -958,7 +966,7 @@ void Scratchpad::handleRemoteRead(MemEvent * event) {
     event->setBaseAddr((event->getAddr() - remoteAddrOffset_) & ~(remoteLineSize_ - 1));
     MemEvent * request = new MemEvent(this, event->getAddr() - remoteAddrOffset_, event->getBaseAddr(), Command::GetS, event->getSize());
     request->setFlag(MemEvent::F_NONCACHEABLE); // Use byte not line address
-    request->setRqstr(event->getRqstr());
+    request->setRqstrID(event->getRqstrID());
     request->setVirtualAddress(event->getVirtualAddress());
     request->setInstructionPointer(event->getInstructionPointer());
     
@@ -986,7 +994,7 @@ void Scratchpad::handleRemoteWrite(MemEvent * event) {
     MemEvent * request = new MemEvent(this, event->getAddr() - remoteAddrOffset_, event->getBaseAddr(), Command::GetX, event->getPayload());
     request->setFlag(MemEvent::F_NORESPONSE);
     request->setFlag(MemEvent::F_NONCACHEABLE);
-    request->setRqstr(event->getRqstr());
+    request->setRqstrID(event->getRqstrID());
     request->setVirtualAddress(event->getVirtualAddress());
     request->setInstructionPointer(event->getInstructionPointer());
 
@@ -1026,7 +1034,7 @@ void Scratchpad::handleRemoteGetResponse(MemEvent * response, SST::Event::id_typ
         if (size > bytesLeft) size = bytesLeft;
         std::vector<uint8_t> data(response->getPayload()[payloadOffset],response->getPayload()[payloadOffset+size]);
         MemEvent * write = new MemEvent(this, addr, baseAddr, Command::PutM, data);
-        write->setRqstr(request->getRqstr());
+        write->setRqstrID(request->getRqstrID());
         write->setVirtualAddress(request->getDstVirtualAddress());
         write->setInstructionPointer(request->getInstructionPointer());
         write->setFlag(MemEvent::F_NORESPONSE);
@@ -1184,7 +1192,7 @@ void Scratchpad::sendResponse(MemEventBase * event) {
 bool Scratchpad::startGet(Addr baseAddr, MoveEvent * get) {
     if (caching_ && cacheStatus_.at(baseAddr/scratchLineSize_) == true) {
         MemEvent * inv = new MemEvent(this, baseAddr, baseAddr, Command::ForceInv, scratchLineSize_);
-        inv->setRqstr(get->getRqstr());
+        inv->setRqstrID(get->getRqstrID());
         inv->setDst(linkUp_->getSources()->begin()->name);
         inv->setVirtualAddress(get->getDstVirtualAddress());
         inv->setInstructionPointer(get->getInstructionPointer());
@@ -1203,8 +1211,8 @@ bool Scratchpad::startGet(Addr baseAddr, MoveEvent * get) {
 bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put) {
     if (caching_ && cacheStatus_.at(baseAddr/scratchLineSize_) == true) {
         MemEvent * inv = new MemEvent(this, baseAddr, baseAddr, Command::FetchInv, scratchLineSize_);
-        inv->setRqstr(put->getRqstr());
-        inv->setDst(put->getSrc());
+        inv->setRqstrID(put->getRqstrID());
+        inv->setDstID(put->getSrcID());
         inv->setVirtualAddress(put->getSrcVirtualAddress());
         inv->setInstructionPointer(put->getInstructionPointer());
         dbg.debug(_L5_, "\tInserting event in processor queue. %s\n", inv->getBriefString().c_str());
@@ -1218,7 +1226,7 @@ bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put) {
         uint32_t size = deriveSize(addr, baseAddr, put->getSrcAddr(), put->getSize());
 
         MemEvent * read = new MemEvent(this, addr, baseAddr, Command::GetS, size);
-        read->setRqstr(put->getRqstr());
+        read->setRqstrID(put->getRqstrID());
         read->setVirtualAddress(put->getSrcVirtualAddress());
         read->setInstructionPointer(put->getInstructionPointer());
         responseIDMap_.insert(std::make_pair(read->getID(), put->getID()));
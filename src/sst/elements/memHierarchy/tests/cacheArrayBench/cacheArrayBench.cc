@@ -0,0 +1,317 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * Times SetAssociativeArray::lookup() and findReplacementCandidate() with the
+ * tag, state and replacement fields held in each heap-allocated CacheLine (as
+ * before the TagStore) against the packed TagStore, for 16 and 32 ways.
+ *
+ * The array itself needs the SST core, so both layouts are reproduced here
+ * without it: the fields of the old CacheLine with the old forward probe and
+ * per-set scratch copy for replacement, and the TagStore with findWay() and
+ * the slices handed to replacement. Both use LRU's findBestCandidate().
+ * Every line is valid and has no sharers, so each probe and each replacement
+ * looks at the whole set. Both layouts must pick the same lines.
+ *
+ * Build with the Makefile in this directory and run:
+ *   ./cacheArrayBench [cache size in MiB] [operations]
+ */
+
+#include <stdint.h>
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <vector>
+
+typedef uint64_t Addr;
+enum State { I, S, E, M };
+
+/* findBestCandidate() of LRUReplacementMgr in replacementManager.h */
+class LRUReplacementMgr {
+public:
+    LRUReplacementMgr(unsigned int numLines, unsigned int numWays) : timestamp(1), array(numLines, 0), numWays(numWays) { }
+
+    void update(unsigned int id) { array[id] = timestamp++; }
+
+    unsigned int findBestCandidate(unsigned int setBegin, State * state, unsigned int * sharers, bool * owned, bool sharersAware) {
+        unsigned int setEnd = setBegin + numWays;
+        unsigned int bestCandidate = setBegin;
+        Rank bestRank = {array[setBegin], (sharersAware)? sharers[0] : 0, (sharersAware)? owned[0] : false, state[0]};
+        if (state[0] == I) return bestCandidate;
+        int i = 1;
+        for (unsigned int id = setBegin + 1; id < setEnd; id++) {
+            Rank candRank = {array[id], (sharersAware)? sharers[i] : 0, (sharersAware)? owned[i] : false, state[i]};
+            if (candRank.lessThan(bestRank)) {
+                bestRank = candRank;
+                bestCandidate = id;
+                if (state[i] == I) return bestCandidate;
+            }
+            i++;
+        }
+        return bestCandidate;
+    }
+
+private:
+    struct Rank {
+        uint64_t        timestamp;
+        unsigned int    sharers;
+        bool            owned;
+        State           state;
+
+        inline bool lessThan(const Rank& other) const {
+            if (state == I) return true;
+            if (sharers == 0 && other.sharers > 0) return true;
+            else if (sharers > 0 && other.sharers == 0) return false;
+            else if (!owned && other.owned) return true;
+            else if (owned && !other.owned) return false;
+            else return timestamp < other.timestamp;
+        }
+    };
+
+    uint64_t                timestamp;
+    std::vector<uint64_t>   array;
+    unsigned int            numWays;
+};
+
+/* The members of CacheLine before the TagStore, in the same order */
+class OldCacheLine {
+public:
+    OldCacheLine(unsigned int size, int index) : size_(size), index_(index), dbg_(nullptr), sharerIndex_(nullptr),
+            baseAddr_(0), state_(I), numSharers_(0), owned_(false), owner_(0), lastSendTimestamp_(0),
+            userLock_(0), LLSCAtomic_(false), eventsWaitingForLock_(false), dataLine_(nullptr) {
+        sharers_.resize(1, 0);
+        data_.resize(size_);
+    }
+
+    void setBaseAddr(Addr addr) { baseAddr_ = addr; }
+    Addr getBaseAddr() { return baseAddr_; }
+    void setState(State state) { state_ = state; }
+    State getState() { return state_; }
+    unsigned int numSharers() { return numSharers_; }
+    bool ownerExists() { return owned_; }
+
+private:
+    const uint32_t          size_;
+    const int               index_;
+    void *                  dbg_;
+    void *                  sharerIndex_;
+    Addr                    baseAddr_;
+    State                   state_;
+    unsigned int            numSharers_;
+    bool                    owned_;
+    std::vector<uint64_t>   sharers_;
+    uint32_t                owner_;
+    uint64_t                lastSendTimestamp_;
+    unsigned int            userLock_;
+    bool                    LLSCAtomic_;
+    bool                    eventsWaitingForLock_;
+    void *                  dataLine_;
+    std::vector<uint8_t>    data_;
+};
+
+/* SetAssociativeArray before the TagStore */
+class OldArray {
+public:
+    OldArray(unsigned int numLines, unsigned int associativity, unsigned int lineSize) : numSets_(numLines / associativity),
+            associativity_(associativity), replacementMgr_(numLines, associativity) {
+        /* Lines of a long running simulation are not laid out by index, so allocate them in a scrambled order */
+        std::vector<unsigned int> order(numLines);
+        for (unsigned int i = 0; i < numLines; i++) order[i] = i;
+        std::shuffle(order.begin(), order.end(), std::mt19937(1));
+
+        lines_.resize(numLines);
+        for (unsigned int i = 0; i < numLines; i++) lines_[order[i]] = new OldCacheLine(lineSize, order[i]);
+
+        setStates = new State[associativity];
+        setSharers = new unsigned int[associativity];
+        setOwned = new bool[associativity];
+    }
+
+    ~OldArray() {
+        for (unsigned int i = 0; i < lines_.size(); i++) delete lines_[i];
+        delete [] setStates;
+        delete [] setSharers;
+        delete [] setOwned;
+    }
+
+    void fill(unsigned int index, Addr baseAddr, State state) {
+        lines_[index]->setBaseAddr(baseAddr);
+        lines_[index]->setState(state);
+        replacementMgr_.update(index);
+    }
+
+    int lookup(const Addr baseAddr, bool update) {
+        int setBegin = (baseAddr % numSets_) * associativity_;
+        int setEnd = setBegin + associativity_;
+
+        for (int i = setBegin; i < setEnd; i++) {
+            if (lines_[i]->getBaseAddr() == baseAddr) {
+                if (update) replacementMgr_.update(i);
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    int findReplacementCandidate(const Addr baseAddr) {
+        int setBegin = (baseAddr % numSets_) * associativity_;
+
+        for (unsigned int id = 0; id < associativity_; id++) {
+            setStates[id] = lines_[id+setBegin]->getState();
+            setSharers[id] = lines_[id+setBegin]->numSharers();
+            setOwned[id] = lines_[id+setBegin]->ownerExists();
+        }
+        return replacementMgr_.findBestCandidate(setBegin, setStates, setSharers, setOwned, true);
+    }
+
+private:
+    unsigned int                numSets_;
+    unsigned int                associativity_;
+    LRUReplacementMgr           replacementMgr_;
+    std::vector<OldCacheLine*>  lines_;
+    State *                     setStates;
+    unsigned int *              setSharers;
+    bool *                      setOwned;
+};
+
+/* SetAssociativeArray with the TagStore of cacheArray.h */
+class PackedArray {
+public:
+    PackedArray(unsigned int numLines, unsigned int associativity) : numSets_(numLines / associativity),
+            associativity_(associativity), replacementMgr_(numLines, associativity),
+            tags(numLines, 0), states(numLines, I), sharerCounts(numLines, 0), owned(numLines, 0) { }
+
+    void fill(unsigned int index, Addr baseAddr, State state) {
+        tags[index] = baseAddr;
+        states[index] = state;
+        replacementMgr_.update(index);
+    }
+
+    int lookup(const Addr baseAddr, bool update) {
+        int setBegin = (baseAddr % numSets_) * associativity_;
+
+        int index = findWay(setBegin, baseAddr);
+        if (index == -1) return -1;
+
+        if (update) replacementMgr_.update(index);
+        return index;
+    }
+
+    int findReplacementCandidate(const Addr baseAddr) {
+        int setBegin = (baseAddr % numSets_) * associativity_;
+
+        return replacementMgr_.findBestCandidate(setBegin, &states[setBegin], &sharerCounts[setBegin], (bool*)&owned[setBegin], true);
+    }
+
+private:
+    /* As CacheArray::findWay() */
+    int findWay(unsigned int setBegin, Addr baseAddr) {
+        const Addr * setTags = &tags[setBegin];
+        int way = -1;
+        for (int i = associativity_ - 1; i >= 0; i--) {
+            way = (setTags[i] == baseAddr) ? i : way;
+        }
+        return (way == -1) ? -1 : (int)setBegin + way;
+    }
+
+    unsigned int                numSets_;
+    unsigned int                associativity_;
+    LRUReplacementMgr           replacementMgr_;
+    std::vector<Addr>           tags;
+    std::vector<State>          states;
+    std::vector<unsigned int>   sharerCounts;
+    std::vector<uint8_t>        owned;      // bool, but std::vector<bool> is not contiguous
+};
+
+struct Timing {
+    double lookupNs;
+    double replaceNs;
+    uint64_t checksum;
+};
+
+/* Fill every line, then time lookups (half of them hits) and replacement candidate searches */
+template<typename Array>
+Timing run(Array& array, unsigned int numLines, unsigned int associativity, const std::vector<Addr>& probes) {
+    const unsigned int numSets = numLines / associativity;
+    for (unsigned int index = 0; index < numLines; index++) {
+        unsigned int set = index / associativity;
+        unsigned int way = index % associativity;
+        array.fill(index, set + (Addr)way * numSets, (way & 1) ? M : S);
+    }
+
+    Timing timing;
+    timing.checksum = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < probes.size(); i++) {
+        timing.checksum += array.lookup(probes[i], true) + 1;
+    }
+    std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < probes.size(); i++) {
+        timing.checksum += array.findReplacementCandidate(probes[i]);
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    timing.lookupNs = std::chrono::duration<double, std::nano>(middle - start).count() / probes.size();
+    timing.replaceNs = std::chrono::duration<double, std::nano>(end - middle).count() / probes.size();
+    return timing;
+}
+
+int main(int argc, char* argv[]) {
+    const unsigned int lineSize = 64;
+    const size_t cacheMiB = (argc > 1) ? strtoul(argv[1], NULL, 0) : 8;
+    const size_t operations = (argc > 2) ? strtoul(argv[2], NULL, 0) : 10000000;
+    const unsigned int numLines = (unsigned int)(cacheMiB * 1024 * 1024 / lineSize);
+    const unsigned int waysToRun[] = { 16, 32 };
+
+    printf("%zu MiB cache, %u byte lines, %zu operations\n", cacheMiB, lineSize, operations);
+    printf("%-6s %-24s %12s %12s\n", "Ways", "Operation", "Old (ns)", "Packed (ns)");
+
+    int status = 0;
+    for (unsigned int w = 0; w < sizeof(waysToRun) / sizeof(waysToRun[0]); w++) {
+        const unsigned int associativity = waysToRun[w];
+        const Addr resident = numLines;
+
+        /* Half the probes hit a random resident line, half miss in a random set */
+        std::vector<Addr> probes(operations);
+        std::mt19937_64 rng(associativity);
+        for (size_t i = 0; i < operations; i++) {
+            Addr addr = rng() % resident;
+            probes[i] = (rng() & 1) ? addr : addr + resident;
+        }
+
+        Timing old, packed;
+        {
+            OldArray array(numLines, associativity, lineSize);
+            old = run(array, numLines, associativity, probes);
+        }
+        {
+            PackedArray array(numLines, associativity);
+            packed = run(array, numLines, associativity, probes);
+        }
+
+        printf("%-6u %-24s %12.2f %12.2f  (%.2fx)\n", associativity, "lookup", old.lookupNs, packed.lookupNs, old.lookupNs / packed.lookupNs);
+        printf("%-6u %-24s %12.2f %12.2f  (%.2fx)\n", associativity, "findReplacementCandidate", old.replaceNs, packed.replaceNs, old.replaceNs / packed.replaceNs);
+
+        if (old.checksum != packed.checksum) {
+            printf("Error: the layouts chose different lines with %u ways\n", associativity);
+            status = 1;
+        }
+    }
+
+    return status;
+}
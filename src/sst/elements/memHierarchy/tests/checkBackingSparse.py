@@ -0,0 +1,59 @@
+#!/usr/bin/env python
+
+import filecmp
+import os
+import subprocess
+import sys
+
+# Round trips the pages of a sparse backing store through its dump file.
+#
+# testBackingSparse.py first writes lines scattered over 4GiB and dumps the
+# pages it wrote. A second run restores that dump, makes no accesses and
+# dumps again, and the two dumps have to be identical.
+#
+# Run from within memHierarchy/tests/:
+#   python ./checkBackingSparse.py
+
+firstDump = "backing-sparse-1.dump"
+secondDump = "backing-sparse-2.dump"
+
+def run_sst(options):
+    osCmd = "sst testBackingSparse.py --model-options=\"" + options + "\""
+    print osCmd
+
+    p = subprocess.Popen(osCmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE, shell=True)
+    output, err = p.communicate()
+
+    if p.returncode != 0:
+        print "SST failed: ", err
+        sys.exit(1)
+
+for dump in [firstDump, secondDump]:
+    if os.path.exists(dump):
+        os.remove(dump)
+
+run_sst("--DumpFile=" + firstDump)
+run_sst("--NumLoadStore=0 --RestoreFile=" + firstDump + " --DumpFile=" + secondDump)
+
+results = ""
+failed = False
+
+# each page is a 16 byte header and at least one 4KiB page
+if os.path.exists(firstDump) and os.path.getsize(firstDump) > 4096:
+    results += "[v] Written pages dumped to " + firstDump + " (" + str(os.path.getsize(firstDump)) + " bytes)\n"
+else:
+    results += "[x] Written pages dumped to " + firstDump + "\n"
+    failed = True
+
+if not failed and filecmp.cmp(firstDump, secondDump, shallow=False):
+    results += "[v] Restored pages dump back unchanged\n"
+else:
+    results += "[x] Restored pages dump back unchanged\n"
+    failed = True
+
+print "-----RUNNING SPARSE BACKING-----"
+print(results)
+print("done.\n")
+
+if failed:
+    sys.exit(1)
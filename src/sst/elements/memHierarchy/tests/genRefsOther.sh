@@ -6,6 +6,9 @@ echo "Cassini..."
 sst ../../cassini/tests/streamcpu-nbp.py > ../../cassini/tests/refFiles/test_cassini_prefetch_nbp.out &
 sst ../../cassini/tests/streamcpu-nopf.py > ../../cassini/tests/refFiles/test_cassini_prefetch_nopf.out &
 sst ../../cassini/tests/streamcpu-sp.py > ../../cassini/tests/refFiles/test_cassini_prefetch_sp.out &
+sst ../../cassini/tests/streamcpu-ipsp.py > ../../cassini/tests/refFiles/test_cassini_prefetch_ipsp.out &
+sst ../../cassini/tests/streamcpu-sms.py > ../../cassini/tests/refFiles/test_cassini_prefetch_sms.out &
+sst ../../cassini/tests/streamcpu-bo.py > ../../cassini/tests/refFiles/test_cassini_prefetch_bo.out &
 wait
 
 # Miranda
@@ -0,0 +1,59 @@
+import sst
+import sys,getopt
+
+# Writes lines scattered over a 4GiB sparse backing store and dumps the pages
+# that were written. Run by checkBackingSparse.py, which restores a dump with
+# --NumLoadStore=0 and checks it dumps back unchanged.
+
+numLoadStore = "1000"
+restoreFile = ""
+dumpFile = "backing-sparse.dump"
+
+try:
+    opts, args = getopt.getopt(sys.argv[1:], "", ["NumLoadStore=","RestoreFile=","DumpFile="])
+except getopt.GetoptError as err:
+    print str(err)
+    sys.exit(2)
+for o, a in opts:
+    if o == "--NumLoadStore":
+        numLoadStore = a
+    elif o == "--RestoreFile":
+        restoreFile = a
+    elif o == "--DumpFile":
+        dumpFile = a
+
+# Define the simulation components
+comp_cpu = sst.Component("cpu", "memHierarchy.trivialCPU")
+comp_cpu.addParams({
+      "do_write" : "1",
+      "num_loadstore" : numLoadStore,
+      "commFreq" : "100",
+      "memSize" : "0x100000000"
+})
+comp_l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+comp_l1cache.addParams({
+      "access_latency_cycles" : "4",
+      "cache_frequency" : "2 Ghz",
+      "replacement_policy" : "lru",
+      "coherence_protocol" : "MSI",
+      "associativity" : "4",
+      "cache_line_size" : "64",
+      "L1" : "1",
+      "cache_size" : "2 KB"
+})
+comp_memory = sst.Component("memory", "memHierarchy.MemController")
+comp_memory.addParams({
+      "coherence_protocol" : "MSI",
+      "backend.access_time" : "100 ns",
+      "clock" : "1GHz",
+      "backend.mem_size" : "4GiB",
+      "backing" : "sparse",
+      "backing_restore_file" : restoreFile,
+      "backing_dump_file" : dumpFile
+})
+
+# Define the simulation links
+link_cpu_cache_link = sst.Link("link_cpu_cache_link")
+link_cpu_cache_link.connect( (comp_cpu, "mem_link", "1000ps"), (comp_l1cache, "high_network_0", "1000ps") )
+link_mem_bus_link = sst.Link("link_mem_bus_link")
+link_mem_bus_link.connect( (comp_l1cache, "low_network_0", "50ps"), (comp_memory, "direct_link", "50ps") )
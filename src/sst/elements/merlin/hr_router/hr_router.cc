@@ -391,14 +391,18 @@ hr_router::clock_handler(Cycle_t cycle)
 #endif
     }
     // Loop through all the events at the heads of the queues and call
-    // route
-    int index = 0;
-    for ( int i = 0; i < num_ports; i++ ) {
-        for ( int j = 0; j < num_vcs; j++ ) {
-            if ( vc_heads[index] != NULL ) {
-                topo->reroute(i,j,vc_heads[index]);
+    // route.  Only visit the ports and VCs that have an event.
+    for ( int w = 0; w < (int)ports_with_data.size(); w++ ) {
+        uint64_t port_bits = ports_with_data[w];
+        while ( port_bits ) {
+            int i = w * 64 + __builtin_ctzll(port_bits);
+            port_bits &= port_bits - 1;
+            uint64_t vc_bits = port_vcs_with_data[i];
+            while ( vc_bits ) {
+                int j = __builtin_ctzll(vc_bits);
+                vc_bits &= vc_bits - 1;
+                topo->reroute(i,j,vc_heads[i * num_vcs + j]);
             }
-            index++;
         }
     }
     
@@ -462,6 +466,7 @@ void hr_router::setup()
     for ( int i = 0; i < num_ports; i++ ) {
     	ports[i]->setup();
     }
+    topo->setup();
 }
 
 void hr_router::finish()
@@ -626,6 +631,11 @@ hr_router::reportSetVCs(int port, int vcs)
 void
 hr_router::init_vcs()
 {
+    // Per-port VC bitmasks are a single word
+    if ( num_vcs > 64 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "hr_router supports at most 64 VCs per port, %d requested\n", num_vcs);
+    }
+    initVCsWithData(num_ports);
 
     // int in_buf_sizes[num_vcs];
     // int out_buf_sizes[num_vcs];
@@ -651,6 +661,7 @@ hr_router::init_vcs()
     // Now that we have the number of VCs we can finish initializing
     // arbitration logic
     arb->setPorts(num_ports,num_vcs);
+    arb->setVCsWithData(getPortVCsWithData(), getPortsWithData());
 
     vcs_initialized = true;
     
@@ -24,6 +24,7 @@
 #include <sst/core/timeConverter.h>
 
 #include <vector>
+#include <algorithm>
 
 #include "sst/elements/merlin/router.h"
 #include "sst/elements/merlin/portControl.h"
@@ -52,12 +53,21 @@ private:
     int rr_port_shadow;
 #endif
 
-    typedef std::pair<uint16_t,uint16_t> priority_entry_t;
-    priority_entry_t* priority[2];
-    priority_entry_t* cur_list;
-    priority_entry_t* next_list;
-    
-    int total_entries;
+    // Priority order of the (port, vc) entries is kept as a rank per
+    // entry, lower rank goes first.  Each cycle only the entries with
+    // an event waiting are sorted by rank and checked.  Entries that
+    // win go behind everything else (in reverse order of winning), the
+    // rest keep their relative order, which is the same order a full
+    // least recently used list would have.
+    uint64_t* rank;
+    uint64_t next_rank;
+
+    typedef std::pair<uint64_t,int> candidate_t;
+    std::vector<candidate_t> candidates;
+    std::vector<int> winners;
+
+    const uint64_t* port_vcs_with_data;
+    const uint64_t* ports_with_data;
     
     internal_router_event** vc_heads;
 
@@ -65,33 +75,37 @@ private:
     
 public:
     xbar_arb_lru(Component* parent, Params& param) :
-        XbarArbitration(parent)
+        XbarArbitration(parent),
+        rank(NULL),
+        port_vcs_with_data(NULL),
+        ports_with_data(NULL)
     {
     }
 
     ~xbar_arb_lru() {
+        if ( rank != NULL ) delete [] rank;
     }
 
     void setPorts(int num_ports_s, int num_vcs_s) {
         num_ports = num_ports_s;
         num_vcs = num_vcs_s;
 
-        total_entries = num_ports * num_vcs;
+        int total_entries = num_ports * num_vcs;
 
-        priority[0] = new priority_entry_t[total_entries];
-        priority[1] = new priority_entry_t[total_entries];
-        cur_list = priority[0];
-        next_list = priority[1];
-        
-        int index = 0;
-        for ( int i = 0; i < num_ports; i++ ) {
-            for ( int j = 0; j < num_vcs; j++ ) {
-                cur_list[index++] = priority_entry_t(i,j);
-            }
+        // Start in port, then VC order
+        rank = new uint64_t[total_entries];
+        for ( int i = 0; i < total_entries; i++ ) {
+            rank[i] = i;
         }
+        next_rank = total_entries;
 
-        
-        vc_heads = new internal_router_event*[num_vcs];
+        candidates.reserve(total_entries);
+        winners.reserve(num_ports);
+    }
+
+    void setVCsWithData(const uint64_t* port_vcs, const uint64_t* ports) {
+        port_vcs_with_data = port_vcs;
+        ports_with_data = ports;
     }
     
     // Naming convention is from point of view of the xbar.  So,
@@ -108,89 +122,67 @@ public:
         
         for ( int i = 0; i < num_ports; i++ ) progress_vc[i] = -1;
 
-        // std::cout << "---------" << std::endl;
-        // for ( int i = 0; i < total_entries; i++ ) {
-        //     std::cout << priority[cur_list][i].first << ", " << priority[cur_list][i].second << std::endl;
-        // }
-        // std::cout << "---------" << std::endl;
+        // Gather the entries that have an event and whose input port
+        // isn't busy, in priority order.  Nothing else can change
+        // state this cycle.
+        candidates.clear();
+        int num_words = (num_ports + 63) / 64;
+        for ( int w = 0; w < num_words; w++ ) {
+            uint64_t port_bits = ports_with_data[w];
+            while ( port_bits ) {
+                int port = w * 64 + __builtin_ctzll(port_bits);
+                port_bits &= port_bits - 1;
+                if ( in_port_busy[port] > 0 ) continue;
+
+                uint64_t vc_bits = port_vcs_with_data[port];
+                while ( vc_bits ) {
+                    int entry = port * num_vcs + __builtin_ctzll(vc_bits);
+                    vc_bits &= vc_bits - 1;
+                    candidates.push_back(candidate_t(rank[entry], entry));
+                }
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
 
-        // Run through the priority list
-        // for ( priority_list_t::iterator it = priority.begin(); it != priority.end(); ) {
-        // int sat_index = total_entries - 1;
-        // int unsat_index = 0;
+        winners.clear();
+        for ( size_t i = 0; i < candidates.size(); i++ ) {
+            int entry = candidates[i].second;
+            int port = entry / num_vcs;
+            int vc = entry - port * num_vcs;
 
-        priority_entry_t* sat_list = &next_list[total_entries-1];
-        priority_entry_t* unsat_list = next_list;
-        
-        for ( int i = 0; i < total_entries; i++ ) {
-                    
-            // const priority_entry_t& check = priority[cur_list][i];
-            const priority_entry_t& check = cur_list[i];
+            // An earlier entry for this port may have won this cycle
+            if ( in_port_busy[port] > 0 ) continue;
 
-            /* std::cout << check.first << ", " << check.second << std::endl; */
-            
-            int port = check.first;
-            int vc = check.second;
-
-            // std::cout << check.first << ", " << check.second << std::endl;
-            
             vc_heads = ports[port]->getVCHeads();
-	    
-            // if the output of this port is busy or if there is no
-            // event to be processed, nothing to do.
             internal_router_event* src_event = vc_heads[vc];
-            if ( in_port_busy[port] <= 0 && src_event != NULL) {
-                // Have an event, see if it can be progressed
-                int next_port = src_event->getNextPort();
-                int next_vc = src_event->getVC();
+
+            // Have an event, see if it can be progressed
+            int next_port = src_event->getNextPort();
+            int next_vc = src_event->getVC();
             
-                // We can progress if the next port's input is not
-                // busy and there are enough credits.
-                if ( out_port_busy[next_port] <= 0 &&
-                     ports[next_port]->spaceToSend(next_vc, src_event->getFlitCount()) ) {
+            // We can progress if the next port's input is not
+            // busy and there are enough credits.
+            if ( out_port_busy[next_port] <= 0 &&
+                 ports[next_port]->spaceToSend(next_vc, src_event->getFlitCount()) ) {
                                 
-                    // Tell the router what to move
-                    progress_vc[port] = vc;
-                    
-                    // Need to set the busy values
-                    in_port_busy[port] = src_event->getFlitCount();
-                    out_port_busy[next_port] = src_event->getFlitCount();
+                // Tell the router what to move
+                progress_vc[port] = vc;
                     
+                // Need to set the busy values
+                in_port_busy[port] = src_event->getFlitCount();
+                out_port_busy[next_port] = src_event->getFlitCount();
 
-                    // Copy data to new list
-                    // std::cout << "putting at bottom of list" << std::endl;
-                    // next_list[sat_index--] = check;
-                    *sat_list = check;
-                    --sat_list;
-                }
-                else {
-                    // std::cout << "putting at top of list" << std::endl;
-                    // next_list[unsat_index++] = check;
-                    *unsat_list = check;
-                    ++unsat_list;
-                    progress_vc[port] = -2;
-                }
+                winners.push_back(entry);
             }
             else {
-                // std::cout << "putting at top of list" << std::endl;
-                // next_list[unsat_index++] = check;
-                *unsat_list = check;
-                ++unsat_list;
+                progress_vc[port] = -2;
             }
         }
 
-        // std::cout << "+++++++++" << std::endl;
-        // for ( int i = 0; i < total_entries; i++ ) {
-        //     std::cout << priority[next_list][i].first << ", " << priority[cur_list][i].second << std::endl;
-        // }
-        // std::cout << "+++++++++" << std::endl;
-
-        // cur_list ^= next_list;
-        // next_list ^= cur_list;
-        // cur_list ^= next_list;
-        priority_entry_t* tmp = cur_list;
-        cur_list = next_list;
-        next_list = tmp;
+        // Move winners to the back of the list, first winner last
+        for ( int i = winners.size() - 1; i >= 0; i-- ) {
+            rank[winners[i]] = next_rank++;
+        }
         return;
     }
     
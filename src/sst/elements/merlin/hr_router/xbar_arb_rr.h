@@ -58,13 +58,15 @@ private:
 #endif
     
     internal_router_event** vc_heads;
+    const uint64_t* port_vcs_with_data;
 
     // PortControl** ports;
     
 public:
     xbar_arb_rr(Component* parent, Params& params) :
         XbarArbitration(parent),
-        rr_vcs(NULL)
+        rr_vcs(NULL),
+        port_vcs_with_data(NULL)
     {
     }
 
@@ -87,6 +89,10 @@ public:
 #endif
         vc_heads = new internal_router_event*[num_vcs];
     }
+
+    void setVCsWithData(const uint64_t* port_vcs, const uint64_t* ports) {
+        port_vcs_with_data = port_vcs;
+    }
     
     // Naming convention is from point of view of the xbar.  So,
     // in_port_busy is >0 if someone is writing to that xbar port and
@@ -103,22 +109,32 @@ public:
         // for ( int port = rr_port, pcount = 0; pcount < num_ports; port = (port+1) % num_ports, pcount++ ) {
         for ( int port = rr_port, pcount = 0; pcount < num_ports; port = ((port != num_ports-1) ? port+1 : 0), pcount++ ) {
 
-            vc_heads = ports[port]->getVCHeads();
-	    
             // Overwrite old data
             progress_vc[port] = -1;
             // if the output of this port is busy, nothing to do.
             if ( in_port_busy[port] > 0 ) {
                 continue;
             }
-	    
+
+            // Only look at the VCs that have an event, starting from
+            // rr_vcs[port]: rotate the mask so that VC is bit 0.
+            uint64_t pending = port_vcs_with_data[port];
+            if ( pending != 0 ) {
+                vc_heads = ports[port]->getVCHeads();
+            }
+            int start = rr_vcs[port];
+            if ( start != 0 ) {
+                pending = (pending >> start) | (pending << (num_vcs - start));
+                if ( num_vcs < 64 ) pending &= ((uint64_t)1 << num_vcs) - 1;
+            }
+
             // See what we should progress for this port
-            // for ( int vc = rr_vcs[port], vcount = 0; vcount < num_vcs; vc = (vc+1) % num_vcs, vcount++ ) {
-            for ( int vc = rr_vcs[port], vcount = 0; vcount < num_vcs; vc = ((vc != num_vcs-1) ? (vc+1) : 0), vcount++ ) {
-		
-                // If there is no event, move to next VC
+            while ( pending ) {
+                int vc = start + __builtin_ctzll(pending);
+                if ( vc >= num_vcs ) vc -= num_vcs;
+                pending &= pending - 1;
+
                 internal_router_event* src_event = vc_heads[vc];
-                if ( src_event == NULL ) continue;
 		
                 // Have an event, see if it can be progressed
                 int next_port = src_event->getNextPort();
@@ -98,7 +98,7 @@ PortControl::recv(int vc)
 	// Need to update vc_heads
 	if ( input_buf[vc].empty() ) {
 	    vc_heads[vc] = NULL;
-	    parent->dec_vcs_with_data();
+	    parent->dec_vcs_with_data(port_number, vc);
 	}
 	else {
 	    vc_heads[vc] = input_buf[vc].front();
@@ -713,7 +713,7 @@ PortControl::handle_input_n2r(Event* ev)
 	    // If this becomes vc_head we need to put it into the vc_heads array
 	    if ( vc_heads[curr_vc] == NULL ) {
             vc_heads[curr_vc] = rtr_event;
-            parent->inc_vcs_with_data();
+            parent->inc_vcs_with_data(port_number, curr_vc);
 	    }
 	    
 	    if ( event->request->getTraceType() != SST::Interfaces::SimpleNetwork::Request::NONE ) {
@@ -807,7 +807,7 @@ PortControl::handle_input_r2r(Event* ev)
 	    // in the array) we need to put it into the vc_heads array
 	    if ( vc_heads[curr_vc] == NULL ) {
             vc_heads[curr_vc] = event;
-            parent->inc_vcs_with_data();
+            parent->inc_vcs_with_data(port_number, curr_vc);
 	    }
         // std::cout << "Got to here 3" << std::endl; 
 	    
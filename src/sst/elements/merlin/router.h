@@ -27,6 +27,8 @@
 #include <sst/core/unitAlgebra.h>
 #include <sst/core/interfaces/simpleNetwork.h>
 
+#include <vector>
+
 using namespace SST;
 
 namespace SST {
@@ -53,6 +55,19 @@ protected:
     { requestNotifyOnEvent = state; }
 
     int vcs_with_data;
+
+    // Bit vc of port_vcs_with_data[port] is set when that input VC
+    // has an event at its head, and bit port of ports_with_data is
+    // set when any VC of the port does.  PortControl keeps these up
+    // to date as events arrive and leave so the router and arbiter
+    // can skip idle ports and VCs.
+    std::vector<uint64_t> port_vcs_with_data;
+    std::vector<uint64_t> ports_with_data;
+
+    inline void initVCsWithData(int num_ports) {
+        port_vcs_with_data.assign(num_ports, 0);
+        ports_with_data.assign((num_ports + 63) / 64, 0);
+    }
     
 public:
 
@@ -68,9 +83,19 @@ public:
    
     virtual void notifyEvent() {}
 
-    inline void inc_vcs_with_data() { vcs_with_data++; }
-    inline void dec_vcs_with_data() { vcs_with_data--; }
+    inline void inc_vcs_with_data(int port, int vc) {
+        vcs_with_data++;
+        port_vcs_with_data[port] |= (uint64_t)1 << vc;
+        ports_with_data[port >> 6] |= (uint64_t)1 << (port & 63);
+    }
+    inline void dec_vcs_with_data(int port, int vc) {
+        vcs_with_data--;
+        port_vcs_with_data[port] &= ~((uint64_t)1 << vc);
+        if ( port_vcs_with_data[port] == 0 ) ports_with_data[port >> 6] &= ~((uint64_t)1 << (port & 63));
+    }
     inline int get_vcs_with_data() { return vcs_with_data; }
+    inline const uint64_t* getPortVCsWithData() const { return port_vcs_with_data.data(); }
+    inline const uint64_t* getPortsWithData() const { return ports_with_data.data(); }
 
     virtual int const* getOutputBufferCredits() = 0;
     virtual void sendTopologyEvent(int port, TopologyEvent* ev) = 0;
@@ -395,6 +420,10 @@ public:
     virtual void arbitrate(PortControl** ports, int* port_busy, int* out_port_busy, int* progress_vc) = 0;
 #endif
     virtual void setPorts(int num_ports, int num_vcs) = 0;
+    // Per-port bitmasks of VCs with an event waiting and bitmask of
+    // ports with any, as maintained by the Router.  Arbiters that
+    // don't use them will scan all the VC heads instead.
+    virtual void setVCsWithData(const uint64_t* port_vcs, const uint64_t* ports) {}
     virtual bool isOkayToPauseClock() { return true; }
     virtual void reportSkippedCycles(Cycle_t cycles) {};
     virtual void dumpState(std::ostream& stream) {};
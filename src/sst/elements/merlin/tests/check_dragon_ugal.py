@@ -0,0 +1,67 @@
+#!/usr/bin/env python
+
+import subprocess
+import sys
+
+# Runs the 72 node dragonfly with ugal-local and ugal-global routing and
+# checks every NIC sent and received all of its packets, and that no packet
+# was delivered to the wrong NIC.
+#
+# Run from within merlin/tests/ on a single rank and thread (ugal-global is
+# serial only):
+#   python ./check_dragon_ugal.py
+
+num_nics = 72
+packets_per_nic = 720
+
+tests = [ ("ugal-local", "dragon_72_ugal_local_test.py"),
+          ("ugal-global", "dragon_72_ugal_global_test.py") ]
+
+def run_sst(sdl):
+    osCmd = "sst " + sdl
+    print osCmd
+
+    p = subprocess.Popen(osCmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE, shell=True)
+    output, err = p.communicate()
+
+    if p.returncode != 0:
+        print "SST failed: ", err
+        sys.exit(1)
+
+    return output.split("\n")
+
+results = ""
+failed = False
+
+for algorithm, sdl in tests:
+    outputLines = run_sst(sdl)
+
+    sent = set()
+    received = set()
+    misrouted = 0
+    incomplete = 0
+    completed = False
+    for line in outputLines:
+        if line.find("Finished sending packets") != -1:
+            sent.add(int(line.split()[1]))
+        elif line.find("received all packets (total of " + str(packets_per_nic) + ")") != -1:
+            received.add(int(line.split()[2]))
+        elif line.find("received event with dest") != -1:
+            misrouted += 1
+        elif line.find("didn't receive all") != -1:
+            incomplete += 1
+        elif line.startswith("Simulation is complete"):
+            completed = True
+
+    if len(sent) == num_nics and len(received) == num_nics and misrouted == 0 and incomplete == 0 and completed:
+        results += "[v] " + algorithm + ": all " + str(num_nics) + " NICs sent and received all packets\n"
+    else:
+        results += "[x] " + algorithm + ": " + str(len(sent)) + " NICs finished sending, " + str(len(received)) + " received all packets, " + str(misrouted) + " misrouted, " + str(incomplete) + " incomplete\n"
+        failed = True
+
+print "-----RUNNING DRAGONFLY UGAL-----"
+print(results)
+print("done.\n")
+
+if failed:
+    sys.exit(1)
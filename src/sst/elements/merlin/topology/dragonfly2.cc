@@ -22,9 +22,23 @@
 
 #include <stdlib.h>
 #include <sstream>
+#include <map>
+#include <mutex>
 
 using namespace SST::Merlin;
 
+namespace {
+// Output buffer credits of the dragonfly2 routers in this process, per
+// network (dragonfly:network_name) and indexed by global router
+// number.  ugal-global uses it to look at the queues on the global
+// links of the other routers in the group.  A network's table is
+// sized for all of its routers when the first one registers and is
+// never resized, entries are filled in during init and only read
+// while running.
+std::mutex credit_registry_lock;
+std::map<std::string, std::vector<topo_dragonfly2::RouterCreditInfo> > credit_registry;
+}
+
 
 
 void
@@ -77,6 +91,9 @@ topo_dragonfly2::topo_dragonfly2(Component* comp, Params &p) :
     std::string route_algo = p.find<std::string>("dragonfly:algorithm", "minimal");
 
     adaptive_threshold = p.find<double>("dragonfly:adaptive_threshold",2.0);
+    ugal_bias = p.find<int>("dragonfly:ugal_bias",0);
+    network_name = p.find<std::string>("dragonfly:network_name","dragonfly");
+    credit_table = NULL;
     
     // Get the global link map
     std::vector<int64_t> global_link_map;
@@ -140,6 +157,21 @@ topo_dragonfly2::topo_dragonfly2(Component* comp, Params &p) :
     else if ( !route_algo.compare("adaptive-local") ) {
         algorithm = ADAPTIVE_LOCAL;
     }
+    else if ( !route_algo.compare("ugal-local") ) {
+        algorithm = UGAL_LOCAL;
+    }
+    else if ( !route_algo.compare("ugal-global") ) {
+        // Remote queues are read straight out of the other routers,
+        // which is only safe (and repeatable) when they are not
+        // running on another thread or in another process.
+        if ( getNumRanks().rank > 1 ) {
+            output.fatal(CALL_INFO, -1, "dragonfly:algorithm ugal-global is not supported with more than one MPI rank, use ugal-local instead.\n");
+        }
+        if ( getNumRanks().thread > 1 ) {
+            output.fatal(CALL_INFO, -1, "dragonfly:algorithm ugal-global is not supported with more than one thread per rank, use ugal-local instead.\n");
+        }
+        algorithm = UGAL_GLOBAL;
+    }
     else {
         algorithm = MINIMAL;
     }
@@ -150,6 +182,11 @@ topo_dragonfly2::topo_dragonfly2(Component* comp, Params &p) :
 
     rng = new RNG::XORShiftRNG(id+1);
 
+    router_port.resize(params.a);
+    for ( uint32_t r = 0; r < params.a; r++ ) {
+        router_port[r] = params.p + r - (r > router_id ? 1 : 0);
+    }
+
     output.verbose(CALL_INFO, 1, 1, "%u:%u:  ID: %u   Params:  p = %u  a = %u  k = %u  h = %u  g = %u\n",
             group_id, router_id, id, params.p, params.a, params.k, params.h, params.g);
 }
@@ -160,6 +197,23 @@ topo_dragonfly2::~topo_dragonfly2()
 }
 
 
+void topo_dragonfly2::setup()
+{
+    // The global link map is complete once the shared region has
+    // been merged, so build the per-group lookup tables now rather
+    // than doing the group arithmetic for every packet.
+    group_port.assign(params.g * params.n, 0);
+    group_link.assign(params.g * params.n, RouterPortPair(router_id, 0));
+    for ( uint32_t group = 0; group < params.g; group++ ) {
+        if ( group == group_id ) continue;
+        for ( uint32_t slice = 0; slice < params.n; slice++ ) {
+            group_port[group * params.n + slice] = compute_port_for_group(group, slice);
+            group_link[group * params.n + slice] = global_link_for_group(group, slice);
+        }
+    }
+}
+
+
 void topo_dragonfly2::route(int port, int vc, internal_router_event* ev)
 {
     topo_dragonfly2_event *td_ev = static_cast<topo_dragonfly2_event*>(ev);
@@ -243,6 +297,16 @@ void topo_dragonfly2::route(int port, int vc, internal_router_event* ev)
 
 void topo_dragonfly2::reroute(int port, int vc, internal_router_event* ev)
 {
+    if ( algorithm == UGAL_LOCAL || algorithm == UGAL_GLOBAL ) {
+        // UGAL decides between the minimal and valiant path once, at
+        // the source router.  Until the packet wins arbitration the
+        // decision is re-evaluated against the current queue depths.
+        if ( (uint32_t)port < params.p ) {
+            ugal_reroute(vc, static_cast<topo_dragonfly2_event*>(ev));
+        }
+        return;
+    }
+
     if ( algorithm != ADAPTIVE_LOCAL ) return;
 
     // For now, we make the adaptive routing decision only at the
@@ -288,8 +352,8 @@ void topo_dragonfly2::reroute(int port, int vc, internal_router_event* ev)
     int direct_slice1 = td_ev->global_slice_shadow;
     // int direct_slice2 = td_ev->global_slice;
     int direct_slice2 = (td_ev->global_slice_shadow + 1) % params.n;
-    int direct_route_port1 = port_for_group(td_ev->dest.group, direct_slice1, 0 );
-    int direct_route_port2 = port_for_group(td_ev->dest.group, direct_slice2, 1 );
+    int direct_route_port1 = port_for_group(td_ev->dest.group, direct_slice1);
+    int direct_route_port2 = port_for_group(td_ev->dest.group, direct_slice2);
     int direct_route_credits1 = output_credits[direct_route_port1 * num_vcs + vc];
     int direct_route_credits2 = output_credits[direct_route_port2 * num_vcs + vc];
     int direct_slice;
@@ -333,8 +397,8 @@ void topo_dragonfly2::reroute(int port, int vc, internal_router_event* ev)
         int valiant_slice1 = td_ev->global_slice;
         // int valiant_slice2 = td_ev->global_slice;
         int valiant_slice2 = (td_ev->global_slice + 1) % params.n;
-        int valiant_route_port1 = port_for_group(td_ev->dest.mid_group_shadow, valiant_slice1, 2 );
-        int valiant_route_port2 = port_for_group(td_ev->dest.mid_group_shadow, valiant_slice2, 3 );
+        int valiant_route_port1 = port_for_group(td_ev->dest.mid_group_shadow, valiant_slice1);
+        int valiant_route_port2 = port_for_group(td_ev->dest.mid_group_shadow, valiant_slice2);
         int valiant_route_credits1 = output_credits[valiant_route_port1 * num_vcs + vc];
         int valiant_route_credits2 = output_credits[valiant_route_port2 * num_vcs + vc];
         if ( valiant_route_credits1 > valiant_route_credits2 ) {
@@ -373,6 +437,107 @@ void topo_dragonfly2::reroute(int port, int vc, internal_router_event* ev)
 }
 
 
+void topo_dragonfly2::ugal_reroute(int vc, topo_dragonfly2_event* td_ev)
+{
+    if ( td_ev->dest.group == group_id ) {
+        if ( td_ev->dest.router == router_id ) return;
+
+        // Direct path is one local hop, valiant path is two
+        uint32_t direct_port = port_for_router(td_ev->dest.router);
+        uint32_t valiant_port = port_for_router(td_ev->dest.mid_group_shadow);
+        int direct_cost = occupancy(direct_port, vc);
+        int valiant_cost = 2 * occupancy(valiant_port, vc);
+
+        if ( direct_cost <= valiant_cost + ugal_bias ) {
+            td_ev->dest.mid_group = td_ev->dest.router;
+            td_ev->setNextPort(direct_port);
+        }
+        else {
+            td_ev->dest.mid_group = td_ev->dest.mid_group_shadow;
+            td_ev->setNextPort(valiant_port);
+        }
+        return;
+    }
+
+    // Consider two global slices for each of the minimal and valiant
+    // paths.  After leaving this router, the minimal path has a global
+    // hop and at most one local hop left, the valiant path has two of
+    // each.
+    uint32_t direct_slice = td_ev->global_slice_shadow;
+    int direct_cost = path_cost(td_ev->dest.group, direct_slice, vc, 2);
+    if ( params.n > 1 ) {
+        uint32_t slice = (direct_slice + 1) % params.n;
+        int cost = path_cost(td_ev->dest.group, slice, vc, 2);
+        if ( cost < direct_cost ) {
+            direct_slice = slice;
+            direct_cost = cost;
+        }
+    }
+
+    if ( td_ev->dest.mid_group_shadow != td_ev->dest.group ) {
+        uint32_t valiant_slice = td_ev->global_slice_shadow;
+        int valiant_cost = path_cost(td_ev->dest.mid_group_shadow, valiant_slice, vc, 4);
+        if ( params.n > 1 ) {
+            uint32_t slice = (valiant_slice + 1) % params.n;
+            int cost = path_cost(td_ev->dest.mid_group_shadow, slice, vc, 4);
+            if ( cost < valiant_cost ) {
+                valiant_slice = slice;
+                valiant_cost = cost;
+            }
+        }
+
+        if ( direct_cost > valiant_cost + ugal_bias ) {
+            td_ev->dest.mid_group = td_ev->dest.mid_group_shadow;
+            td_ev->global_slice = valiant_slice;
+            td_ev->setNextPort(port_for_group(td_ev->dest.mid_group, valiant_slice));
+            return;
+        }
+    }
+
+    td_ev->dest.mid_group = td_ev->dest.group;
+    td_ev->global_slice = direct_slice;
+    td_ev->setNextPort(port_for_group(td_ev->dest.group, direct_slice));
+}
+
+
+// Hop-weighted queue occupancy of the path that leaves the group
+// through the given global link.  ugal-local only sees the queue at
+// this router's output port.  ugal-global also adds the queue on the
+// global link itself when it belongs to another router in the group.
+int topo_dragonfly2::path_cost(uint32_t group, uint32_t global_slice, int vc, int remaining_hops) const
+{
+    uint32_t port = port_for_group(group, global_slice);
+    int queue = occupancy(port, vc);
+    int hops = remaining_hops;
+    if ( group_link[group * params.n + global_slice].router != router_id ) {
+        hops++;
+        if ( algorithm == UGAL_GLOBAL ) queue += gateway_occupancy(group, global_slice, vc);
+    }
+    return queue * hops;
+}
+
+
+int topo_dragonfly2::occupancy(int port, int vc) const
+{
+    int index = port * num_vcs + vc;
+    return output_capacity[index] - output_credits[index];
+}
+
+
+// Occupancy of the global port on another router in this group.
+// The other router's counters are read directly, which is why
+// ugal-global is limited to a single rank and thread.
+int topo_dragonfly2::gateway_occupancy(uint32_t group, uint32_t global_slice, int vc) const
+{
+    const RouterPortPair& pair = group_link[group * params.n + global_slice];
+    if ( credit_table == NULL ) return 0;
+    const RouterCreditInfo& info = (*credit_table)[group_id * params.a + pair.router];
+    if ( info.credits == NULL || vc >= info.num_vcs ) return 0;
+    int slot = pair.port * info.num_vcs + vc;
+    return info.capacity[slot] - info.credits[slot];
+}
+
+
 internal_router_event* topo_dragonfly2::process_input(RtrEvent* ev)
 {
     dgnfly2Addr dstAddr = {0, 0, 0, 0};
@@ -389,6 +554,8 @@ internal_router_event* topo_dragonfly2::process_input(RtrEvent* ev)
         break;
     case VALIANT:
     case ADAPTIVE_LOCAL:
+    case UGAL_LOCAL:
+    case UGAL_GLOBAL:
         if ( dstAddr.group == group_id ) {
             // staying within group, set mid_group to be an intermediate router within group
             do {
@@ -397,6 +564,9 @@ internal_router_event* topo_dragonfly2::process_input(RtrEvent* ev)
             }
             while ( dstAddr.mid_group == router_id );
             // dstAddr.mid_group = dstAddr.group;
+        } else if ( params.g <= 2 ) {
+            // No intermediate group to go through
+            dstAddr.mid_group = dstAddr.group;
         } else {
             do {
                 dstAddr.mid_group = rng->generateNextUInt32() % params.g;
@@ -480,7 +650,7 @@ void topo_dragonfly2::routeInitData(int port, internal_router_event* ev, std::ve
         // Minimal Route
         int next_port;
         if ( td_ev->dest.group != group_id ) {
-            next_port = port_for_group(td_ev->dest.group, td_ev->global_slice);
+            next_port = compute_port_for_group(td_ev->dest.group, td_ev->global_slice);
         }
         else if ( td_ev->dest.router != router_id ) {
             next_port = port_for_router(td_ev->dest.router);
@@ -534,6 +704,31 @@ topo_dragonfly2::setOutputBufferCreditArray(int const* array, int vcs)
 {
     output_credits = array;
     num_vcs = vcs;
+
+    // The credit array is handed over right after the ports set it to
+    // the full buffer sizes, so save those to turn credits into
+    // occupancy.
+    output_capacity.assign(array, array + params.k * vcs);
+
+    // Only ugal-global looks at other routers' queues
+    if ( algorithm != UGAL_GLOBAL ) return;
+
+    std::lock_guard<std::mutex> lock(credit_registry_lock);
+    std::vector<RouterCreditInfo>& table = credit_registry[network_name];
+    if ( table.empty() ) {
+        RouterCreditInfo empty = { NULL, NULL, 0 };
+        table.resize(params.g * params.a, empty);
+    }
+
+    uint32_t index = group_id * params.a + router_id;
+    if ( table.size() != params.g * params.a || table[index].credits != NULL ) {
+        output.fatal(CALL_INFO, -1, "Two dragonfly2 networks in one process share dragonfly:network_name \"%s\", give each network its own name.\n",
+                     network_name.c_str());
+    }
+    table[index].credits = output_credits;
+    table[index].capacity = output_capacity.data();
+    table[index].num_vcs = vcs;
+    credit_table = &table;
 }
 
 
@@ -567,8 +762,7 @@ uint32_t topo_dragonfly2::router_to_group(uint32_t group)
 }
 
 
-/* returns local router port if group can't be reached from this router */
-uint32_t topo_dragonfly2::port_for_group(uint32_t group, uint32_t slice, int id)
+const RouterPortPair& topo_dragonfly2::global_link_for_group(uint32_t group, uint32_t slice)
 {
     // Look up global port to use
     switch ( global_route_mode ) {
@@ -587,22 +781,20 @@ uint32_t topo_dragonfly2::port_for_group(uint32_t group, uint32_t slice, int id)
         break;
     }
 
-    const RouterPortPair& pair = group_to_global_port.getRouterPortPair(group,slice);
+    return group_to_global_port.getRouterPortPair(group,slice);
+}
+
+
+/* returns local router port if group can't be reached from this router */
+uint32_t topo_dragonfly2::compute_port_for_group(uint32_t group, uint32_t slice)
+{
+    const RouterPortPair& pair = global_link_for_group(group, slice);
 
     if ( pair.router == router_id ) {
         return pair.port;
     } else {
         return port_for_router(pair.router);
     }
-
-}
-
-
-uint32_t topo_dragonfly2::port_for_router(uint32_t router)
-{
-    uint32_t tgt = params.p + router;
-    if ( router > router_id ) tgt--;
-    return tgt;
 }
 
 
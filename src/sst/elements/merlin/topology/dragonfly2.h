@@ -76,7 +76,7 @@ public:
         "merlin",
         "dragonfly2",
         SST_ELI_ELEMENT_VERSION(1,0,0),
-        "Dragonfly2 topology object.  Implements a dragonfly with a single all to all pattern within the group.",
+        "Dragonfly2 topology object.  Implements a dragonfly with a single all to all pattern within the group.  ugal-global routing is serial only, see dragonfly:algorithm.",
         "SST::Merlin::Topology")
     
     SST_ELI_DOCUMENT_PARAMS(
@@ -85,10 +85,14 @@ public:
         {"dragonfly:intergroup_per_router", "Number of links per router connected to other groups."},
         {"dragonfly:intergroup_links",      "Number of links between each pair of groups."},
         {"dragonfly:num_groups",            "Number of groups in network."},
-        {"dragonfly:algorithm",             "Routing algorithm to use [minmal (default) | valiant].", "minimal"},
+        {"dragonfly:algorithm",             "Routing algorithm to use [minmal (default) | valiant | adaptive-local | ugal-local | ugal-global]. "
+                                            "NOTE: ugal-global reads the output queues of the other routers in its group directly out of their memory, so it only runs serially "
+                                            "(one MPI rank, one thread) and is a fatal error in any parallel run, which rules it out for large dragonflies. Use ugal-local there, it only looks at the router's own queues.", "minimal"},
         {"dragonfly:adaptive_threshold",    "Threshold to use when make adaptive routing decisions.", "2.0"},
+        {"dragonfly:ugal_bias",             "Bias (in flits) toward the minimal path for ugal-local and ugal-global routing.", "0"},
         {"dragonfly:global_link_map",       "Array specifying connectivity of global links in each dragonfly group."},
         {"dragonfly:global_route_mode",     "Mode for intepreting global link map [absolute (default) | relative].","absolute"},
+        {"dragonfly:network_name",          "Name that tells dragonfly2 networks in the same process apart for ugal-global routing.", "dragonfly"},
     )
 
     /* Assumed connectivity of each router:
@@ -97,6 +101,12 @@ public:
      * ports [p+a-1, k-1]:  Inter-group
      */
 
+    struct RouterCreditInfo {
+        int const* credits;
+        const int* capacity;
+        int num_vcs;
+    };
+
     struct dgnfly2Params {
         uint32_t p;  /* # of hosts / router */
         uint32_t a;  /* # of routers / group */
@@ -109,7 +119,9 @@ public:
     enum RouteAlgo {
         MINIMAL,
         VALIANT,
-        ADAPTIVE_LOCAL
+        ADAPTIVE_LOCAL,
+        UGAL_LOCAL,
+        UGAL_GLOBAL
     };
 
     RouteToGroup group_to_global_port;
@@ -117,13 +129,27 @@ public:
     struct dgnfly2Params params;
     RouteAlgo algorithm;
     double adaptive_threshold;
+    int ugal_bias;
     uint32_t group_id;
     uint32_t router_id;
 
     RNG::SSTRandom* rng;
 
     int const* output_credits;
+    std::vector<int> output_capacity;
     int num_vcs;
+
+    // Credit arrays of the routers in this network, used by ugal-global
+    std::string network_name;
+    const std::vector<RouterCreditInfo>* credit_table;
+
+    // Routing tables, indexed by router in group and by
+    // (group * params.n + slice).  router_port is filled in the
+    // constructor, the group tables in setup() once the global link
+    // map has been published.
+    std::vector<uint16_t> router_port;
+    std::vector<uint16_t> group_port;
+    std::vector<RouterPortPair> group_link;
     
     enum global_route_mode_t { ABSOLUTE, RELATIVE };
     global_route_mode_t global_route_mode;
@@ -140,6 +166,8 @@ public:
     topo_dragonfly2(Component* comp, Params& p);
     ~topo_dragonfly2();
 
+    virtual void setup();
+
     virtual void route(int port, int vc, internal_router_event* ev);
     virtual void reroute(int port, int vc, internal_router_event* ev);
     virtual internal_router_event* process_input(RtrEvent* ev);
@@ -158,8 +186,17 @@ public:
 private:
     void idToLocation(int id, dgnfly2Addr *location);
     uint32_t router_to_group(uint32_t group);
-    uint32_t port_for_router(uint32_t router);
-    uint32_t port_for_group(uint32_t group, uint32_t global_slice, int id = -1);
+    inline uint32_t port_for_router(uint32_t router) const { return router_port[router]; }
+    inline uint32_t port_for_group(uint32_t group, uint32_t global_slice) const {
+        return group_port[group * params.n + global_slice];
+    }
+    const RouterPortPair& global_link_for_group(uint32_t group, uint32_t global_slice);
+    uint32_t compute_port_for_group(uint32_t group, uint32_t global_slice);
+
+    int occupancy(int port, int vc) const;
+    int gateway_occupancy(uint32_t group, uint32_t global_slice, int vc) const;
+    int path_cost(uint32_t group, uint32_t global_slice, int vc, int remaining_hops) const;
+    void ugal_reroute(int vc, topo_dragonfly2_event* td_ev);
 
 };
 
@@ -269,9 +269,14 @@ void RequestGenCPU::handleEvent( Interfaces::SimpleMem::Request* ev) {
 			out->verbose(CALL_INFO, 4, 0, "-> Entry has all parts satisfied, removing ID=%" PRIu64 ", total processing time: %" PRIu64 "ns\n",
 				cpuReq->getOriginalReqID(), (getCurrentSimTimeNano() - cpuReq->getIssueTime()));
 
-			// Notify every pending request that there may be a satisfied dependency
-			for(uint32_t i = 0; i < pendingRequests.size(); ++i) {
-				pendingRequests.at(i)->satisfyDependency(cpuReq->getOriginalReqID());
+			// Notify the pending requests that were waiting on this one
+			std::unordered_map<uint64_t, std::vector<GeneratorRequest*> >::iterator waiters =
+				dependentRequests.find(cpuReq->getOriginalReqID());
+			if(waiters != dependentRequests.end()) {
+				for(uint32_t i = 0; i < waiters->second.size(); ++i) {
+					waiters->second[i]->satisfyDependency();
+				}
+				dependentRequests.erase(waiters);
 			}
 
 			delete cpuReq;
@@ -452,6 +457,7 @@ bool RequestGenCPU::clockTick(SST::Cycle_t cycle) {
     
     // We need to generate at least as many requests as can be looked up in the OoO window
     // otherwise the issue will have starvation.
+    const uint32_t firstNewRequest = pendingRequests.size();
     for(int i = pendingRequests.size(); i < maxOpLookup; ++i) {
         if( reqGen->isFinished()) {
             break;
@@ -459,6 +465,15 @@ bool RequestGenCPU::clockTick(SST::Cycle_t cycle) {
             reqGen->generate(&pendingRequests);
     	}
     }
+
+    // Record which new requests wait on which so completions can find them directly
+    for(uint32_t i = firstNewRequest; i < pendingRequests.size(); ++i) {
+        GeneratorRequest* newRq = pendingRequests.at(i);
+        const std::vector<uint64_t>& deps = newRq->getDependencies();
+        for(uint32_t j = 0; j < deps.size(); ++j) {
+            dependentRequests[deps[j]].push_back(newRq);
+        }
+    }
     
     for(uint32_t i = 0; i < pendingRequests.size(); ++i) {
         if(reqsIssuedThisCycle == reqMaxPerCycle) {
@@ -21,6 +21,8 @@
 #include <sst/core/elementinfo.h>
 #include <sst/core/statapi/stataccumulator.h>
 
+#include <unordered_map>
+
 #include "mirandaGenerator.h"
 #include "mirandaEvent.h"
 #include "mirandaMemMgr.h"
@@ -132,6 +134,8 @@ private:
 	MirandaReqEvent* srcReqEvent;	
 
 	MirandaRequestQueue<GeneratorRequest*> pendingRequests;
+	// Reverse dependency edges: request ID -> pending requests waiting for it to complete
+	std::unordered_map<uint64_t, std::vector<GeneratorRequest*> > dependentRequests;
 	MirandaMemoryManager* memMgr;
 
         uint32_t maxRequestsPending[OPCOUNT];
@@ -24,6 +24,8 @@
 #include <sst/core/output.h>
 
 #include <queue>
+#include <vector>
+#include <algorithm>
 
 namespace SST {
 namespace Miranda {
@@ -40,7 +42,7 @@ static std::atomic<uint64_t> nextGeneratorRequestID(0);
 
 class GeneratorRequest {
 public:
-	GeneratorRequest() {
+	GeneratorRequest() : unsatisfiedDeps(0) {
 		reqID = nextGeneratorRequestID++;
 	}
 
@@ -50,25 +52,22 @@ public:
 
 	void addDependency(uint64_t depReq) {
 		dependsOn.push_back(depReq);
+		unsatisfiedDeps++;
 	}
 
-	void satisfyDependency(const GeneratorRequest* req) {
-		satisfyDependency(req->getRequestID());
+	const std::vector<uint64_t>& getDependencies() const {
+		return dependsOn;
 	}
 
-	void satisfyDependency(const uint64_t req) {
-		std::vector<uint64_t>::iterator searchDeps;
-
-		for(searchDeps = dependsOn.begin(); searchDeps != dependsOn.end(); searchDeps++) {
-			if( req == (*searchDeps) ) {
-				dependsOn.erase(searchDeps);
-				break;
-			}
-		}
+	// Called once for each of the requests this one depends on as
+	// it completes. The CPU keeps the completer -> waiters edges so
+	// it can call this directly rather than searching dependsOn.
+	void satisfyDependency() {
+		unsatisfiedDeps--;
 	}
 
 	bool canIssue() {
-		return dependsOn.empty();
+		return 0 == unsatisfiedDeps;
 	}
 
 	uint64_t getIssueTime() const {
@@ -82,14 +81,23 @@ protected:
 	uint64_t reqID;
 	uint64_t issueTime;
 	std::vector<uint64_t> dependsOn;
+	uint32_t unsatisfiedDeps;
 };
 
+/*
+ * Ring buffer of pending requests. Index 0 is the oldest entry.
+ * Issued entries are removed in place: the entries older than the
+ * removed ones shift up to fill the holes and the head advances, so
+ * removing from near the head (the common case) touches only a few
+ * slots and never allocates.
+ */
 template<typename QueueType>
 class MirandaRequestQueue {
 public:
        	MirandaRequestQueue() {
                         theQ = (QueueType*) malloc(sizeof(QueueType) * 16);
                         maxCapacity = 16;
+                        head = 0;
                         curSize = 0;
                 }
         ~MirandaRequestQueue() {
@@ -104,15 +112,22 @@ public:
 //		printf("Resizing MirandaQueue from: %" PRIu32 " to %" PRIu32 "\n",
 //			curSize, newSize);
 
-               	QueueType * newQ = (QueueType *) malloc(sizeof(QueueType) * newSize);
+               	uint32_t newCapacity = 16;
+               	while(newCapacity < newSize) {
+                       	newCapacity *= 2;
+               	}
+
+               	curSize = std::min(curSize, newSize);
+
+               	QueueType * newQ = (QueueType *) malloc(sizeof(QueueType) * newCapacity);
                	for(uint32_t i = 0; i < curSize; ++i) {
-                       	newQ[i] = theQ[i];
+                       	newQ[i] = at(i);
                 }
 
                 free(theQ);
                	theQ = newQ;
-               	maxCapacity = newSize;
-               	curSize = std::min(curSize, newSize);
+               	maxCapacity = newCapacity;
+               	head = 0;
         }
 
 	uint32_t size() const {
@@ -124,52 +139,49 @@ public:
 	}
 
        	QueueType at(const uint32_t index) {
-               	return theQ[index];
+               	return theQ[slot(index)];
        	}
 
-       	void erase(const std::vector<uint32_t> eraseList) {
+	// eraseList holds indices in ascending order
+       	void erase(const std::vector<uint32_t>& eraseList) {
 		if(0 == eraseList.size()) {
 			return;
 		}
 
-               	QueueType* newQ = (QueueType*) malloc(sizeof(QueueType) * maxCapacity);
-
-               	uint32_t nextSkipIndex = 0;
-               	uint32_t nextSkip = eraseList.at(nextSkipIndex);
-                uint32_t nextNewQIndex = 0;
-
-               	for(uint32_t i = 0; i < curSize; ++i) {
-                       	if(nextSkip == i) {
-                                nextSkipIndex++;
-
-                                if(nextSkipIndex >= eraseList.size()) {
-                                       	nextSkip = curSize;
-                               	} else {
-                                       	nextSkip = eraseList.at(nextSkipIndex);
-                                }
-                       	} else {
-                               	newQ[nextNewQIndex] = theQ[i];
-                                nextNewQIndex++;
-                       	}
-               	}
-
-                free(theQ);
+		// Walk from the last erased index toward the head, moving
+		// each surviving entry up past the holes seen so far.
+		int32_t nextSkipIndex = eraseList.size() - 1;
+		uint32_t dest = eraseList.back();
+
+		for(int64_t i = eraseList.back(); i >= 0; --i) {
+			if(nextSkipIndex >= 0 && eraseList[nextSkipIndex] == (uint32_t) i) {
+				nextSkipIndex--;
+			} else {
+				theQ[slot(dest)] = theQ[slot(i)];
+				dest--;
+			}
+		}
 
-               	theQ = newQ;
-		curSize = nextNewQIndex;
+		head = (head + eraseList.size()) & (maxCapacity - 1);
+		curSize -= eraseList.size();
         }
 
 	void push_back(QueueType t) {
                 if(curSize == maxCapacity) {
-                        resize(maxCapacity + 16);
+                        resize(maxCapacity * 2);
                 }
 
-                theQ[curSize] = t;
+                theQ[slot(curSize)] = t;
                 curSize++;
         }
 private:
+	uint32_t slot(const uint32_t index) const {
+		return (head + index) & (maxCapacity - 1);
+	}
+
         QueueType* theQ;
-        uint32_t maxCapacity;
+        uint32_t maxCapacity;	// Always a power of two
+        uint32_t head;
         uint32_t curSize;
 };
 
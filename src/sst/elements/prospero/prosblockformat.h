@@ -0,0 +1,550 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_PROSPERO_BLOCK_FORMAT
+#define _H_SST_PROSPERO_BLOCK_FORMAT
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <zlib.h>
+
+/*
+ * Block compressed trace container
+ *
+ * Shared by the Prospero readers, the Ariel trace generators and the CramSim
+ * trace reader, so it is header only and needs nothing but zlib. The payload
+ * is an opaque byte stream (binary records or lines of text) cut into blocks
+ * which are compressed independently, so any block can be decoded on its
+ * own, in any order and on any thread:
+ *
+ *   header   magic "PROSBLK1", codec (1 byte), 3 reserved bytes, block size (4 bytes)
+ *   blocks   the compressed blocks, back to back
+ *   index    per block: file offset (8 bytes), compressed and uncompressed length (4 bytes each)
+ *   trailer  index offset (8 bytes), block count (8 bytes), magic "PROSIDX1"
+ *
+ * The trailer is at a fixed distance from the end of the file so a reader can
+ * find the index, and from it the block holding any position in the stream,
+ * without touching the blocks. Integers are stored in host byte order, as
+ * the binary trace formats are. Only deflate is implemented, the codec byte
+ * leaves room for others.
+ */
+
+#define PROSPERO_BLOCK_MAGIC "PROSBLK1"
+#define PROSPERO_BLOCK_INDEX_MAGIC "PROSIDX1"
+#define PROSPERO_BLOCK_MAGIC_LENGTH 8
+
+#define PROSPERO_BLOCK_HEADER_LENGTH  (PROSPERO_BLOCK_MAGIC_LENGTH + 8)
+#define PROSPERO_BLOCK_TRAILER_LENGTH (8 + 8 + PROSPERO_BLOCK_MAGIC_LENGTH)
+#define PROSPERO_BLOCK_INDEX_ENTRY    (8 + 4 + 4)
+
+#define PROSPERO_BLOCK_CODEC_DEFLATE 1
+
+#define PROSPERO_BLOCK_DEFAULT_SIZE (1024 * 1024)
+
+namespace SST {
+namespace Prospero {
+
+class ProsperoBlockIndexEntry {
+public:
+	uint64_t offset;
+	uint32_t compressedLength;
+	uint32_t length;
+};
+
+/*
+ * Writes a block compressed trace. Records are appended whole, a record only
+ * spans two blocks if it is bigger than the block size.
+ */
+class ProsperoBlockWriter {
+
+public:
+	ProsperoBlockWriter() : file(NULL), blockSize(PROSPERO_BLOCK_DEFAULT_SIZE),
+		level(Z_DEFAULT_COMPRESSION), offset(0), failed(false) {}
+
+	~ProsperoBlockWriter() { close(); }
+
+	bool open(const char* path, const size_t size = PROSPERO_BLOCK_DEFAULT_SIZE,
+		const int compressionLevel = Z_DEFAULT_COMPRESSION) {
+
+		file = fopen(path, "wb");
+		if(NULL == file) {
+			return false;
+		}
+
+		blockSize = std::max((size_t) 1, std::min(size, (size_t) UINT32_MAX));
+		level = compressionLevel;
+		block.reserve(blockSize);
+
+		uint8_t header[PROSPERO_BLOCK_HEADER_LENGTH];
+		const uint32_t storedSize = (uint32_t) blockSize;
+
+		memset(header, 0, sizeof(header));
+		memcpy(header, PROSPERO_BLOCK_MAGIC, PROSPERO_BLOCK_MAGIC_LENGTH);
+		header[PROSPERO_BLOCK_MAGIC_LENGTH] = PROSPERO_BLOCK_CODEC_DEFLATE;
+		memcpy(header + PROSPERO_BLOCK_MAGIC_LENGTH + 4, &storedSize, sizeof(uint32_t));
+
+		offset = 0;
+		failed = false;
+		put(header, sizeof(header));
+
+		return !failed;
+	}
+
+	bool isOpen() const { return NULL != file; }
+
+	bool append(const void* data, size_t length) {
+		const uint8_t* bytes = (const uint8_t*) data;
+
+		if(block.size() + length > blockSize && !block.empty()) {
+			flushBlock();
+		}
+
+		while(length > 0) {
+			const size_t count = std::min(length, blockSize - block.size());
+			block.insert(block.end(), bytes, bytes + count);
+			bytes += count;
+			length -= count;
+
+			if(block.size() == blockSize) {
+				flushBlock();
+			}
+		}
+
+		return !failed;
+	}
+
+	/* Writes the last block, the index and the trailer. Returns false if any write failed. */
+	bool close() {
+		if(NULL == file) {
+			return !failed;
+		}
+
+		flushBlock();
+
+		const uint64_t indexOffset = offset;
+		const uint64_t blockCount = index.size();
+
+		for(size_t i = 0; i < index.size(); i++) {
+			uint8_t entry[PROSPERO_BLOCK_INDEX_ENTRY];
+			memcpy(entry, &index[i].offset, sizeof(uint64_t));
+			memcpy(entry + 8, &index[i].compressedLength, sizeof(uint32_t));
+			memcpy(entry + 12, &index[i].length, sizeof(uint32_t));
+			put(entry, sizeof(entry));
+		}
+
+		uint8_t trailer[PROSPERO_BLOCK_TRAILER_LENGTH];
+		memcpy(trailer, &indexOffset, sizeof(uint64_t));
+		memcpy(trailer + 8, &blockCount, sizeof(uint64_t));
+		memcpy(trailer + 16, PROSPERO_BLOCK_INDEX_MAGIC, PROSPERO_BLOCK_MAGIC_LENGTH);
+		put(trailer, sizeof(trailer));
+
+		if(0 != fclose(file)) {
+			failed = true;
+		}
+
+		file = NULL;
+		index.clear();
+		return !failed;
+	}
+
+private:
+	void put(const void* data, const size_t length) {
+		if(length != fwrite(data, 1, length, file)) {
+			failed = true;
+		}
+		offset += length;
+	}
+
+	void flushBlock() {
+		if(block.empty()) {
+			return;
+		}
+
+		uLongf compressedLength = compressBound(block.size());
+		compressed.resize(compressedLength);
+
+		if(Z_OK != compress2(&compressed[0], &compressedLength, &block[0], block.size(), level)) {
+			failed = true;
+		}
+
+		ProsperoBlockIndexEntry entry;
+		entry.offset = offset;
+		entry.compressedLength = (uint32_t) compressedLength;
+		entry.length = (uint32_t) block.size();
+		index.push_back(entry);
+
+		put(&compressed[0], compressedLength);
+		block.clear();
+	}
+
+	FILE* file;
+	size_t blockSize;
+	int level;
+	uint64_t offset;
+	bool failed;
+
+	std::vector<uint8_t> block;
+	std::vector<uint8_t> compressed;
+	std::vector<ProsperoBlockIndexEntry> index;
+
+};
+
+/*
+ * Reads a block compressed trace as a byte stream. Worker threads decode the
+ * blocks ahead of the one being read into a ring of blocksAhead slots, with
+ * no workers the blocks are decoded in the calling thread as they are
+ * reached. Either way the stream comes out in order.
+ */
+class ProsperoBlockReader {
+
+public:
+	ProsperoBlockReader() : traceFD(-1), length(0), nextBlock(0), nextDecode(0),
+		generation(0), stopping(false), position(0), error(false) {}
+
+	~ProsperoBlockReader() {
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			stopping = true;
+		}
+		space.notify_all();
+
+		for(size_t i = 0; i < workers.size(); i++) {
+			workers[i].join();
+		}
+
+		if(traceFD >= 0) {
+			::close(traceFD);
+		}
+	}
+
+	/* Checks for the container magic, so callers can fall back to their plain formats */
+	static bool isBlockTrace(const char* path) {
+		char magic[PROSPERO_BLOCK_MAGIC_LENGTH];
+		FILE* file = fopen(path, "rb");
+
+		if(NULL == file) {
+			return false;
+		}
+
+		const bool match = 1 == fread(magic, sizeof(magic), 1, file) &&
+			0 == memcmp(magic, PROSPERO_BLOCK_MAGIC, PROSPERO_BLOCK_MAGIC_LENGTH);
+
+		fclose(file);
+		return match;
+	}
+
+	/* Opens the trace and starts the workers. Returns false if the file is not a readable block trace. */
+	bool open(const char* path, const unsigned int threads = 2, const size_t blocksAhead = 8) {
+		traceFD = ::open(path, O_RDONLY);
+		if(traceFD < 0) {
+			return false;
+		}
+
+		struct stat traceStat;
+		if(0 != fstat(traceFD, &traceStat) ||
+			(uint64_t) traceStat.st_size < PROSPERO_BLOCK_HEADER_LENGTH + PROSPERO_BLOCK_TRAILER_LENGTH) {
+			return false;
+		}
+
+		const uint64_t fileLength = (uint64_t) traceStat.st_size;
+		uint8_t header[PROSPERO_BLOCK_HEADER_LENGTH];
+		uint8_t trailer[PROSPERO_BLOCK_TRAILER_LENGTH];
+
+		if(!get(header, sizeof(header), 0) ||
+			0 != memcmp(header, PROSPERO_BLOCK_MAGIC, PROSPERO_BLOCK_MAGIC_LENGTH) ||
+			PROSPERO_BLOCK_CODEC_DEFLATE != header[PROSPERO_BLOCK_MAGIC_LENGTH]) {
+			return false;
+		}
+
+		if(!get(trailer, sizeof(trailer), fileLength - sizeof(trailer)) ||
+			0 != memcmp(trailer + 16, PROSPERO_BLOCK_INDEX_MAGIC, PROSPERO_BLOCK_MAGIC_LENGTH)) {
+			return false;
+		}
+
+		uint64_t indexOffset = 0;
+		uint64_t blockCount = 0;
+		memcpy(&indexOffset, trailer, sizeof(uint64_t));
+		memcpy(&blockCount, trailer + 8, sizeof(uint64_t));
+
+		if(indexOffset < PROSPERO_BLOCK_HEADER_LENGTH || indexOffset > fileLength - sizeof(trailer) ||
+			blockCount != (fileLength - sizeof(trailer) - indexOffset) / PROSPERO_BLOCK_INDEX_ENTRY) {
+			return false;
+		}
+
+		std::vector<uint8_t> entries(blockCount * PROSPERO_BLOCK_INDEX_ENTRY);
+		if(blockCount > 0 && !get(&entries[0], entries.size(), indexOffset)) {
+			return false;
+		}
+
+		index.resize(blockCount);
+		starts.resize(blockCount);
+		length = 0;
+
+		for(uint64_t i = 0; i < blockCount; i++) {
+			const uint8_t* entry = &entries[i * PROSPERO_BLOCK_INDEX_ENTRY];
+			memcpy(&index[i].offset, entry, sizeof(uint64_t));
+			memcpy(&index[i].compressedLength, entry + 8, sizeof(uint32_t));
+			memcpy(&index[i].length, entry + 12, sizeof(uint32_t));
+
+			if(index[i].offset + index[i].compressedLength > indexOffset) {
+				return false;
+			}
+
+			starts[i] = length;
+			length += index[i].length;
+		}
+
+		slots.resize(threads > 0 ? std::max(blocksAhead, (size_t) threads) : 1);
+
+		for(unsigned int i = 0; i < threads; i++) {
+			workers.push_back(std::thread(&ProsperoBlockReader::work, this));
+		}
+
+		return true;
+	}
+
+	/* Copies up to count bytes of the stream into dest. Returns the bytes copied, short at the end of the stream or on error. */
+	size_t read(void* dest, const size_t count) {
+		uint8_t* bytes = (uint8_t*) dest;
+		size_t copied = 0;
+
+		while(copied < count) {
+			const Slot* slot = current();
+			if(NULL == slot) {
+				break;
+			}
+
+			const size_t available = slot->data.size() - position;
+			if(0 == available) {
+				advance();
+				continue;
+			}
+
+			const size_t step = std::min(available, count - copied);
+			memcpy(bytes + copied, &slot->data[position], step);
+			position += step;
+			copied += step;
+		}
+
+		return copied;
+	}
+
+	/* Reads up to the next newline, which is dropped, as std::getline does */
+	bool readLine(std::string& line) {
+		bool found = false;
+		line.clear();
+
+		while(true) {
+			const Slot* slot = current();
+			if(NULL == slot) {
+				return found;
+			}
+
+			const size_t available = slot->data.size() - position;
+			if(0 == available) {
+				advance();
+				continue;
+			}
+
+			found = true;
+			const uint8_t* start = &slot->data[position];
+			const uint8_t* newline = (const uint8_t*) memchr(start, '\n', available);
+
+			if(NULL != newline) {
+				line.append((const char*) start, newline - start);
+				position += (newline - start) + 1;
+				return true;
+			}
+
+			line.append((const char*) start, available);
+			position += available;
+		}
+	}
+
+	/* Moves to byte position of the stream, only the block holding it is decoded */
+	bool seek(const uint64_t target) {
+		if(target > length) {
+			return false;
+		}
+
+		const uint64_t block = (uint64_t) (std::upper_bound(starts.begin(), starts.end(), target) - starts.begin());
+
+		{
+			std::lock_guard<std::mutex> guard(lock);
+
+			generation++;
+			for(size_t i = 0; i < slots.size(); i++) {
+				slots[i].ready = false;
+			}
+
+			nextBlock = (block > 0) ? block - 1 : 0;
+			nextDecode = nextBlock;
+			position = (size_t) (target - ((nextBlock < starts.size()) ? starts[nextBlock] : length));
+		}
+
+		space.notify_all();
+		return true;
+	}
+
+	uint64_t size() const { return length; }
+	uint64_t blockCount() const { return index.size(); }
+	bool failed() const { return error; }
+
+private:
+	class Slot {
+	public:
+		Slot() : block(0), ready(false), failed(false) {}
+
+		uint64_t block;
+		bool ready;
+		bool failed;
+		std::vector<uint8_t> data;
+	};
+
+	bool get(void* dest, const size_t count, const uint64_t offset) const {
+		return count == (size_t) pread(traceFD, dest, count, (off_t) offset);
+	}
+
+	bool decode(const uint64_t block, std::vector<uint8_t>& data, std::vector<uint8_t>& scratch) const {
+		const ProsperoBlockIndexEntry& entry = index[block];
+
+		scratch.resize(std::max((uint32_t) 1, entry.compressedLength));
+		data.resize(entry.length);
+
+		if(!get(&scratch[0], entry.compressedLength, entry.offset)) {
+			return false;
+		}
+
+		uLongf decodedLength = entry.length;
+		return Z_OK == uncompress(data.empty() ? NULL : &data[0], &decodedLength, &scratch[0], entry.compressedLength) &&
+			decodedLength == entry.length;
+	}
+
+	void work() {
+		std::vector<uint8_t> data;
+		std::vector<uint8_t> scratch;
+		std::unique_lock<std::mutex> guard(lock);
+
+		while(true) {
+			// A slot is only reused once the block it held has been read past
+			while(!stopping && !(nextDecode < index.size() && nextDecode < nextBlock + slots.size())) {
+				space.wait(guard);
+			}
+
+			if(stopping) {
+				return;
+			}
+
+			const uint64_t block = nextDecode++;
+			const uint64_t decodeGeneration = generation;
+
+			guard.unlock();
+			const bool decoded = decode(block, data, scratch);
+			guard.lock();
+
+			// A seek while we were decoding makes the block stale
+			if(decodeGeneration == generation) {
+				Slot& slot = slots[block % slots.size()];
+				slot.data.swap(data);
+				slot.block = block;
+				slot.failed = !decoded;
+				slot.ready = true;
+				filled.notify_all();
+			}
+		}
+	}
+
+	/* The slot holding the block being read, or NULL at the end of the stream */
+	const Slot* current() {
+		if(error || nextBlock >= index.size()) {
+			return NULL;
+		}
+
+		Slot& slot = slots[nextBlock % slots.size()];
+
+		if(workers.empty()) {
+			if(!slot.ready || slot.block != nextBlock) {
+				slot.failed = !decode(nextBlock, slot.data, scratch);
+				slot.block = nextBlock;
+				slot.ready = true;
+			}
+		} else {
+			std::unique_lock<std::mutex> guard(lock);
+			while(!(slot.ready && slot.block == nextBlock)) {
+				filled.wait(guard);
+			}
+		}
+
+		if(slot.failed) {
+			error = true;
+			return NULL;
+		}
+
+		return &slot;
+	}
+
+	void advance() {
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			slots[nextBlock % slots.size()].ready = false;
+			nextBlock++;
+			position = 0;
+		}
+
+		space.notify_all();
+	}
+
+	int traceFD;
+	uint64_t length;
+	std::vector<ProsperoBlockIndexEntry> index;
+	std::vector<uint64_t> starts;
+
+	std::vector<Slot> slots;
+	std::vector<std::thread> workers;
+	std::vector<uint8_t> scratch;
+	std::mutex lock;
+	std::condition_variable space;
+	std::condition_variable filled;
+
+	uint64_t nextBlock;
+	uint64_t nextDecode;
+	uint64_t generation;
+	bool stopping;
+	size_t position;
+	bool error;
+
+	ProsperoBlockReader(const ProsperoBlockReader&); // do not implement
+	void operator=(const ProsperoBlockReader&); // do not implement
+
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,82 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+#include "prosblockreader.h"
+
+#include <cinttypes>
+#include <cstring>
+
+using namespace SST::Prospero;
+
+ProsperoBlockTraceReader::ProsperoBlockTraceReader( Component* owner, Params& params ) :
+	ProsperoTraceReader(owner, params) {
+
+	std::string traceFile = params.find<std::string>("file", "");
+	const unsigned int decodeThreads = params.find<unsigned int>("decode_threads", 2);
+	const size_t blocksAhead = params.find<size_t>("blocks_ahead", 8);
+
+	if(!traceInput.open(traceFile.c_str(), decodeThreads, blocksAhead)) {
+		fprintf(stderr, "Fatal: Trace file: %s could not be opened as a block compressed trace.\n",
+			traceFile.c_str());
+		exit(-1);
+	}
+
+	recordLength = sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t);
+
+	const uint64_t startRecord = params.find<uint64_t>("start_record", 0);
+	if(!traceInput.seek(startRecord * recordLength)) {
+		fprintf(stderr, "Fatal: start_record %" PRIu64 " is past the end of trace file: %s.\n",
+			startRecord, traceFile.c_str());
+		exit(-1);
+	}
+
+	const size_t ringSize = params.find<size_t>("ring_size", 64);
+	ring.resize(ringSize > 0 ? ringSize : 1);
+	ringNext = 0;
+};
+
+ProsperoBlockTraceReader::~ProsperoBlockTraceReader() {
+}
+
+ProsperoTraceEntry* ProsperoBlockTraceReader::readNextEntry() {
+	uint64_t reqAddress = 0;
+	uint64_t reqCycles  = 0;
+	char reqType = 'R';
+	uint32_t reqLength  = 0;
+	char record[sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t)];
+
+	if(recordLength != traceInput.read(record, recordLength)) {
+		if(traceInput.failed()) {
+			output->fatal(CALL_INFO, -1, "Block compressed trace is corrupt, unable to decode a block.\n");
+		}
+
+		output->verbose(CALL_INFO, 2, 0, "End of block compressed trace reached, returning empty request.\n");
+		return NULL;
+	}
+
+	memcpy(&reqCycles,  record, sizeof(uint64_t));
+	memcpy(&reqType,    record + sizeof(uint64_t), sizeof(char));
+	memcpy(&reqAddress, record + sizeof(uint64_t) + sizeof(char), sizeof(uint64_t));
+	memcpy(&reqLength,  record + sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t), sizeof(uint32_t));
+
+	ProsperoTraceEntry* entry = &ring[ringNext];
+	ringNext = (ringNext + 1 == ring.size()) ? 0 : ringNext + 1;
+
+	entry->set(reqCycles, reqAddress, reqLength,
+		(reqType == 'R' || reqType == 'r') ? READ : WRITE);
+	return entry;
+}
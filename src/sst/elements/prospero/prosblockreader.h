@@ -0,0 +1,73 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+
+#ifndef _H_SST_PROSPERO_BLOCK_READER
+#define _H_SST_PROSPERO_BLOCK_READER
+
+#include <vector>
+
+#include "prosreader.h"
+#include "prosblockformat.h"
+
+namespace SST {
+namespace Prospero {
+
+/*
+ * Reads binary records (as in the binary and compressed formats) out of a
+ * block compressed trace (see prosblockformat.h). Blocks are decoded ahead
+ * of the replay on decode_threads workers, and the index lets the replay
+ * start at any record without decoding the blocks before it. Entries come
+ * from a fixed ring as in the packed reader.
+ */
+class ProsperoBlockTraceReader : public ProsperoTraceReader {
+
+public:
+        ProsperoBlockTraceReader( Component* owner, Params& params );
+        ~ProsperoBlockTraceReader();
+        ProsperoTraceEntry* readNextEntry();
+        void releaseEntry(const ProsperoTraceEntry* entry) { }
+
+ 	SST_ELI_REGISTER_SUBCOMPONENT(
+        	ProsperoBlockTraceReader,
+        	"prospero",
+        	"ProsperoBlockTraceReader",
+        	SST_ELI_ELEMENT_VERSION(1,0,0),
+        	"Block Compressed Trace Reader",
+        	"SST::Prospero::ProsperoTraceReader"
+    	)
+
+	SST_ELI_DOCUMENT_PARAMS(
+		{ "file", "Sets the file for the trace reader to use, write one with the Ariel BlockTraceGenerator or sst-prospero-convert", "" },
+		{ "decode_threads", "Number of threads decoding blocks ahead of the replay, 0 decodes them on the simulation thread", "2" },
+		{ "blocks_ahead", "Number of decoded blocks held ahead of the replay", "8" },
+		{ "start_record", "Record of the trace to start the replay from", "0" },
+		{ "ring_size", "Number of entries the reader hands out before reusing one", "64" }
+	)
+
+private:
+	ProsperoBlockReader traceInput;
+	uint32_t recordLength;
+
+	std::vector<ProsperoTraceEntry> ring;
+	size_t ringNext;
+
+};
+
+}
+}
+
+#endif
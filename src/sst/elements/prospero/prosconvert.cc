@@ -0,0 +1,439 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cinttypes>
+
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+#include "prospackedformat.h"
+#ifdef HAVE_LIBZ
+#include "prosblockformat.h"
+#endif
+
+using namespace SST::Prospero;
+
+/*
+ * Converts text, binary and compressed binary Prospero traces (as written by
+ * sst-prospero-trace) into the packed format read by ProsperoPackedTraceReader,
+ * or into binary records in the block compressed container read by
+ * ProsperoBlockTraceReader. Any other text trace (such as a CramSim trace) can
+ * be copied into the container a line at a time with the raw format.
+ */
+
+#define PROSPERO_BINARY_RECORD (sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t))
+
+void printUsage() {
+	printf("sst-prospero-convert -i <file> -f <format> -o <file> [-t <format>] [-b <bytes>] [-c]\n");
+	printf("\n");
+	printf("Options:\n");
+	printf("  -i <file>     Trace to convert.\n");
+	printf("  -f <format>   Format of the input <format> = {text, binary, compressed, raw}\n");
+	printf("  -o <file>     Name of the trace to write.\n");
+	printf("  -t <format>   Format of the output <format> = {packed, block}, default is packed.\n");
+	printf("                A raw input is copied unchanged and can only be written as block.\n");
+	printf("  -b <bytes>    Uncompressed size of each block of a block trace, default is 1 MiB.\n");
+	printf("  -c            Read the converted trace back and check every record against the input.\n");
+	printf("\n");
+}
+
+/* Reads records in any of the existing trace formats */
+class TraceInput {
+public:
+	TraceInput(const char* format, const char* path) : textFile(NULL), binaryFile(NULL) {
+		if(0 == strcmp(format, "text")) {
+			textFile = fopen(path, "rt");
+		} else if(0 == strcmp(format, "binary")) {
+			binaryFile = fopen(path, "rb");
+#ifdef HAVE_LIBZ
+		} else if(0 == strcmp(format, "compressed")) {
+			compressedFile = gzopen(path, "rb");
+			if(Z_NULL == compressedFile) {
+				fprintf(stderr, "Error: unable to open %s\n", path);
+				exit(-1);
+			}
+			return;
+#endif
+		} else {
+			fprintf(stderr, "Error: unknown or unsupported input format: %s\n", format);
+			exit(-1);
+		}
+
+		if(NULL == textFile && NULL == binaryFile) {
+			fprintf(stderr, "Error: unable to open %s\n", path);
+			exit(-1);
+		}
+	}
+
+	~TraceInput() {
+		if(NULL != textFile) fclose(textFile);
+		if(NULL != binaryFile) fclose(binaryFile);
+#ifdef HAVE_LIBZ
+		if(NULL == textFile && NULL == binaryFile) gzclose(compressedFile);
+#endif
+	}
+
+	bool read(uint64_t& cycles, uint64_t& address, uint32_t& length, bool& isWrite) {
+		char type = 'R';
+
+		if(NULL != textFile) {
+			if(4 != fscanf(textFile, "%" PRIu64 " %c %" PRIu64 " %" PRIu32 "",
+				&cycles, &type, &address, &length)) {
+				return false;
+			}
+		} else {
+			char record[PROSPERO_BINARY_RECORD];
+
+			if(NULL != binaryFile) {
+				if(1 != fread(record, PROSPERO_BINARY_RECORD, 1, binaryFile)) {
+					return false;
+				}
+#ifdef HAVE_LIBZ
+			} else if(PROSPERO_BINARY_RECORD != (size_t) gzread(compressedFile, record, PROSPERO_BINARY_RECORD)) {
+				return false;
+#endif
+			}
+
+			memcpy(&cycles,  record, sizeof(uint64_t));
+			memcpy(&type,    record + sizeof(uint64_t), sizeof(char));
+			memcpy(&address, record + sizeof(uint64_t) + sizeof(char), sizeof(uint64_t));
+			memcpy(&length,  record + sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t), sizeof(uint32_t));
+		}
+
+		isWrite = !(type == 'R' || type == 'r');
+		return true;
+	}
+
+private:
+	FILE* textFile;
+	FILE* binaryFile;
+#ifdef HAVE_LIBZ
+	gzFile compressedFile;
+#endif
+};
+
+/* Decodes a packed trace and compares it record by record with the trace it was converted from */
+int checkPacked(const char* inputFormat, const char* inputPath, const char* packedPath) {
+	// Map the trace read-only as ProsperoPackedTraceReader does, it can be far larger than memory
+	const int packedFD = open(packedPath, O_RDONLY);
+	if(packedFD < 0) {
+		fprintf(stderr, "Error: unable to open %s\n", packedPath);
+		exit(-1);
+	}
+
+	struct stat packedStat;
+	if(0 != fstat(packedFD, &packedStat) || packedStat.st_size < PROSPERO_PACKED_MAGIC_LENGTH) {
+		fprintf(stderr, "Error: %s is not a packed trace\n", packedPath);
+		exit(-1);
+	}
+
+	const size_t mappingLength = (size_t) packedStat.st_size;
+	void* packedMap = mmap(NULL, mappingLength, PROT_READ, MAP_PRIVATE, packedFD, 0);
+	close(packedFD);
+
+	if(MAP_FAILED == packedMap) {
+		fprintf(stderr, "Error: unable to map %s\n", packedPath);
+		exit(-1);
+	}
+
+	const uint8_t* mapping = (const uint8_t*) packedMap;
+	madvise(packedMap, mappingLength, MADV_SEQUENTIAL);
+
+	if(0 != memcmp(mapping, PROSPERO_PACKED_MAGIC, PROSPERO_PACKED_MAGIC_LENGTH)) {
+		fprintf(stderr, "Error: %s is not a packed trace\n", packedPath);
+		exit(-1);
+	}
+
+	// Pages behind the check are dropped a window at a time so they do not stay resident
+	const size_t pageSize = (size_t) sysconf(_SC_PAGESIZE);
+	const size_t releaseWindow = ((64 * 1024 * 1024) / pageSize) * pageSize;
+	const uint8_t* released = mapping;
+
+	TraceInput input(inputFormat, inputPath);
+	ProsperoPackedState state;
+
+	const uint8_t* next = mapping + PROSPERO_PACKED_MAGIC_LENGTH;
+	const uint8_t* end  = mapping + mappingLength;
+
+	uint64_t cycles, address, packedCycles, packedAddress, records = 0;
+	uint32_t length, packedLength;
+	bool isWrite, packedWrite;
+
+	while(input.read(cycles, address, length, isWrite)) {
+		const size_t consumed = prosperoUnpackRecord(state, next, end,
+			packedCycles, packedAddress, packedLength, packedWrite);
+
+		if(0 == consumed || cycles != packedCycles || address != packedAddress ||
+			length != packedLength || isWrite != packedWrite) {
+			fprintf(stderr, "Error: record %" PRIu64 " of %s does not match the input\n", records, packedPath);
+			exit(-1);
+		}
+
+		next += consumed;
+		records++;
+
+		if((size_t) (next - released) >= 2 * releaseWindow) {
+			madvise((void*) released, releaseWindow, MADV_DONTNEED);
+			released += releaseWindow;
+		}
+	}
+
+	if(next != end) {
+		fprintf(stderr, "Error: %s holds more records than the input\n", packedPath);
+		exit(-1);
+	}
+
+	munmap(packedMap, mappingLength);
+
+	printf("Checked %" PRIu64 " records\n", records);
+	return 0;
+}
+
+#ifdef HAVE_LIBZ
+int convertToBlock(const char* inputFormat, const char* inputPath, const char* outputPath, const size_t blockSize) {
+	ProsperoBlockWriter writer;
+	uint64_t records = 0;
+
+	if(!writer.open(outputPath, (blockSize > 0) ? blockSize : PROSPERO_BLOCK_DEFAULT_SIZE)) {
+		fprintf(stderr, "Error: unable to open %s for writing\n", outputPath);
+		exit(-1);
+	}
+
+	if(0 == strcmp(inputFormat, "raw")) {
+		// Lines are appended whole so a block always starts at the beginning of a line
+		FILE* rawFile = fopen(inputPath, "rt");
+		if(NULL == rawFile) {
+			fprintf(stderr, "Error: unable to open %s\n", inputPath);
+			exit(-1);
+		}
+
+		char* line = NULL;
+		size_t lineCapacity = 0;
+		ssize_t lineLength = 0;
+
+		while((lineLength = getline(&line, &lineCapacity, rawFile)) > 0) {
+			writer.append(line, (size_t) lineLength);
+			records++;
+		}
+
+		free(line);
+		fclose(rawFile);
+	} else {
+		TraceInput input(inputFormat, inputPath);
+
+		uint64_t cycles, address;
+		uint32_t length;
+		bool isWrite;
+		char record[PROSPERO_BINARY_RECORD];
+
+		while(input.read(cycles, address, length, isWrite)) {
+			const char type = isWrite ? 'W' : 'R';
+
+			memcpy(record, &cycles, sizeof(uint64_t));
+			memcpy(record + sizeof(uint64_t), &type, sizeof(char));
+			memcpy(record + sizeof(uint64_t) + sizeof(char), &address, sizeof(uint64_t));
+			memcpy(record + sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t), &length, sizeof(uint32_t));
+
+			writer.append(record, PROSPERO_BINARY_RECORD);
+			records++;
+		}
+	}
+
+	if(!writer.close()) {
+		fprintf(stderr, "Error: failed writing to %s\n", outputPath);
+		exit(-1);
+	}
+
+	printf("Converted %" PRIu64 " records\n", records);
+	return 0;
+}
+
+/* Decodes a block trace on the calling thread and compares its stream with the trace it was converted from */
+int checkBlock(const char* inputFormat, const char* inputPath, const char* blockPath) {
+	ProsperoBlockReader reader;
+	if(!reader.open(blockPath, 0)) {
+		fprintf(stderr, "Error: %s is not a block compressed trace\n", blockPath);
+		exit(-1);
+	}
+
+	uint64_t records = 0;
+	char expected[64 * 1024];
+	char decoded[64 * 1024];
+
+	if(0 == strcmp(inputFormat, "raw")) {
+		FILE* rawFile = fopen(inputPath, "rb");
+		if(NULL == rawFile) {
+			fprintf(stderr, "Error: unable to open %s\n", inputPath);
+			exit(-1);
+		}
+
+		size_t expectedLength = 0;
+		while((expectedLength = fread(expected, 1, sizeof(expected), rawFile)) > 0) {
+			if(expectedLength != reader.read(decoded, expectedLength) ||
+				0 != memcmp(expected, decoded, expectedLength)) {
+				fprintf(stderr, "Error: byte %" PRIu64 " onwards of %s does not match the input\n", records, blockPath);
+				exit(-1);
+			}
+
+			records += expectedLength;
+		}
+
+		fclose(rawFile);
+	} else {
+		TraceInput input(inputFormat, inputPath);
+
+		uint64_t cycles, address;
+		uint32_t length;
+		bool isWrite;
+
+		while(input.read(cycles, address, length, isWrite)) {
+			const char type = isWrite ? 'W' : 'R';
+
+			memcpy(expected, &cycles, sizeof(uint64_t));
+			memcpy(expected + sizeof(uint64_t), &type, sizeof(char));
+			memcpy(expected + sizeof(uint64_t) + sizeof(char), &address, sizeof(uint64_t));
+			memcpy(expected + sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t), &length, sizeof(uint32_t));
+
+			if(PROSPERO_BINARY_RECORD != reader.read(decoded, PROSPERO_BINARY_RECORD) ||
+				0 != memcmp(expected, decoded, PROSPERO_BINARY_RECORD)) {
+				fprintf(stderr, "Error: record %" PRIu64 " of %s does not match the input\n", records, blockPath);
+				exit(-1);
+			}
+
+			records++;
+		}
+	}
+
+	if(0 != reader.read(decoded, 1) || reader.failed()) {
+		fprintf(stderr, "Error: %s holds more data than the input\n", blockPath);
+		exit(-1);
+	}
+
+	printf("Checked %" PRIu64 " %s\n", records, (0 == strcmp(inputFormat, "raw")) ? "bytes" : "records");
+	return 0;
+}
+#endif
+
+int main(int argc, char* argv[]) {
+	const char* inputPath = NULL;
+	const char* inputFormat = NULL;
+	const char* outputPath = NULL;
+	const char* outputFormat = "packed";
+	size_t blockSize = 0;
+	bool check = false;
+
+	for(int i = 1; i < argc; i++) {
+		if(0 == strcmp(argv[i], "-i") && i + 1 < argc) {
+			inputPath = argv[++i];
+		} else if(0 == strcmp(argv[i], "-f") && i + 1 < argc) {
+			inputFormat = argv[++i];
+		} else if(0 == strcmp(argv[i], "-o") && i + 1 < argc) {
+			outputPath = argv[++i];
+		} else if(0 == strcmp(argv[i], "-t") && i + 1 < argc) {
+			outputFormat = argv[++i];
+		} else if(0 == strcmp(argv[i], "-b") && i + 1 < argc) {
+			blockSize = (size_t) strtoull(argv[++i], NULL, 0);
+		} else if(0 == strcmp(argv[i], "-c")) {
+			check = true;
+		} else {
+			printUsage();
+			exit(0);
+		}
+	}
+
+	if(NULL == inputPath || NULL == inputFormat || NULL == outputPath) {
+		printUsage();
+		exit(-1);
+	}
+
+	if(0 == strcmp(outputFormat, "block")) {
+#ifdef HAVE_LIBZ
+		const int status = convertToBlock(inputFormat, inputPath, outputPath, blockSize);
+		if(0 == status && check) {
+			return checkBlock(inputFormat, inputPath, outputPath);
+		}
+		return status;
+#else
+		fprintf(stderr, "Error: block output requires zlib support.\n");
+		exit(-1);
+#endif
+	} else if(0 != strcmp(outputFormat, "packed")) {
+		fprintf(stderr, "Error: unknown output format: %s\n", outputFormat);
+		exit(-1);
+	}
+
+	TraceInput input(inputFormat, inputPath);
+
+	FILE* output = fopen(outputPath, "wb");
+	if(NULL == output) {
+		fprintf(stderr, "Error: unable to open %s for writing\n", outputPath);
+		exit(-1);
+	}
+
+	// Records are packed into a large buffer and written out in one go when it fills
+	const size_t bufferLength = 4 * 1024 * 1024;
+	std::vector<uint8_t> buffer(bufferLength);
+	size_t used = 0;
+
+	memcpy(&buffer[0], PROSPERO_PACKED_MAGIC, PROSPERO_PACKED_MAGIC_LENGTH);
+	used += PROSPERO_PACKED_MAGIC_LENGTH;
+
+	ProsperoPackedState state;
+	uint64_t cycles, address, records = 0, packedBytes = PROSPERO_PACKED_MAGIC_LENGTH;
+	uint32_t length;
+	bool isWrite;
+
+	while(input.read(cycles, address, length, isWrite)) {
+		if(used + PROSPERO_PACKED_MAX_RECORD > bufferLength) {
+			if(used != fwrite(&buffer[0], 1, used, output)) {
+				fprintf(stderr, "Error: failed writing to %s\n", outputPath);
+				exit(-1);
+			}
+			used = 0;
+		}
+
+		const size_t recordBytes = prosperoPackRecord(state, cycles, address, length, isWrite, &buffer[used]);
+		used += recordBytes;
+		packedBytes += recordBytes;
+		records++;
+	}
+
+	if(used != fwrite(&buffer[0], 1, used, output) || 0 != fclose(output)) {
+		fprintf(stderr, "Error: failed writing to %s\n", outputPath);
+		exit(-1);
+	}
+
+	printf("Converted %" PRIu64 " records, %" PRIu64 " bytes (%.2f bytes per record)\n",
+		records, packedBytes, records ? ((double) packedBytes / (double) records) : 0.0);
+
+	if(check) {
+		return checkPacked(inputFormat, inputPath, outputPath);
+	}
+
+	return 0;
+}
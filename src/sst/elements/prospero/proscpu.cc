@@ -310,6 +310,6 @@ void ProsperoComponent::issueRequest(const ProsperoTraceEntry* entry) {
 		currentOutstanding++;
 	}
 
-	// Delete this entry, we are done converting it into a request
-	delete entry;
+	// Hand this entry back to the reader, we are done converting it into a request
+	reader->releaseEntry(entry);
 }
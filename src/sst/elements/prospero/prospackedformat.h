@@ -0,0 +1,153 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_PROSPERO_PACKED_FORMAT
+#define _H_SST_PROSPERO_PACKED_FORMAT
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Packed trace format
+ *
+ * An 8 byte magic followed by one record per memory operation. The cycle and
+ * address of a record are stored as the difference from the previous record,
+ * so the common case of nearby addresses issued a few cycles apart takes 3-5
+ * bytes instead of the 21 bytes of the binary format:
+ *
+ *   flags    1 byte, bit 0 set for a write, bit 1 set if a length follows
+ *   cycles   zig-zag encoded difference from the previous record, as a varint
+ *   address  zig-zag encoded difference from the previous record, as a varint
+ *   length   varint, only present if it differs from the previous record
+ *
+ * Varints are little-endian base 128 (7 bits per byte, high bit set on all
+ * but the last byte). The previous record starts out as all zeros.
+ */
+
+#define PROSPERO_PACKED_MAGIC "PROSPK01"
+#define PROSPERO_PACKED_MAGIC_LENGTH 8
+
+/* Flags, cycles, address and length at their longest */
+#define PROSPERO_PACKED_MAX_RECORD (1 + 10 + 10 + 5)
+
+#define PROSPERO_PACKED_WRITE  0x1
+#define PROSPERO_PACKED_LENGTH 0x2
+
+namespace SST {
+namespace Prospero {
+
+/* The fields of the previous record, which the next one is encoded against */
+class ProsperoPackedState {
+public:
+	ProsperoPackedState() : cycles(0), address(0), length(0) {}
+
+	uint64_t cycles;
+	uint64_t address;
+	uint32_t length;
+};
+
+static inline uint64_t prosperoZigZag(const uint64_t current, const uint64_t previous) {
+	const int64_t delta = (int64_t) (current - previous);
+	return (((uint64_t) delta) << 1) ^ ((uint64_t) (delta >> 63));
+}
+
+static inline uint64_t prosperoUnZigZag(const uint64_t encoded, const uint64_t previous) {
+	return previous + ((encoded >> 1) ^ (~(encoded & 1) + 1));
+}
+
+static inline uint8_t* prosperoPutVarint(uint8_t* buffer, uint64_t value) {
+	while(value >= 0x80) {
+		*buffer++ = (uint8_t) (value | 0x80);
+		value >>= 7;
+	}
+	*buffer++ = (uint8_t) value;
+	return buffer;
+}
+
+/* Returns the position after the varint, or NULL if it runs past end */
+static inline const uint8_t* prosperoGetVarint(const uint8_t* buffer, const uint8_t* end, uint64_t& value) {
+	value = 0;
+	for(int shift = 0; buffer < end && shift < 64; shift += 7) {
+		const uint8_t byte = *buffer++;
+		value |= ((uint64_t) (byte & 0x7F)) << shift;
+
+		if(0 == (byte & 0x80)) {
+			return buffer;
+		}
+	}
+
+	return NULL;
+}
+
+/* Encodes a record into buffer, which must hold PROSPERO_PACKED_MAX_RECORD bytes. Returns the bytes used. */
+static inline size_t prosperoPackRecord(ProsperoPackedState& prev, const uint64_t cycles,
+	const uint64_t address, const uint32_t length, const bool isWrite, uint8_t* buffer) {
+
+	uint8_t* next = buffer + 1;
+	buffer[0] = isWrite ? PROSPERO_PACKED_WRITE : 0;
+
+	next = prosperoPutVarint(next, prosperoZigZag(cycles, prev.cycles));
+	next = prosperoPutVarint(next, prosperoZigZag(address, prev.address));
+
+	if(length != prev.length) {
+		buffer[0] |= PROSPERO_PACKED_LENGTH;
+		next = prosperoPutVarint(next, length);
+	}
+
+	prev.cycles = cycles;
+	prev.address = address;
+	prev.length = length;
+
+	return (size_t) (next - buffer);
+}
+
+/* Decodes the record at buffer. Returns the bytes consumed, or 0 if the record is cut short by end. */
+static inline size_t prosperoUnpackRecord(ProsperoPackedState& prev, const uint8_t* buffer,
+	const uint8_t* end, uint64_t& cycles, uint64_t& address, uint32_t& length, bool& isWrite) {
+
+	if(buffer >= end) {
+		return 0;
+	}
+
+	const uint8_t flags = buffer[0];
+	const uint8_t* next = buffer + 1;
+	uint64_t value = 0;
+
+	if(NULL == (next = prosperoGetVarint(next, end, value))) return 0;
+	cycles = prosperoUnZigZag(value, prev.cycles);
+
+	if(NULL == (next = prosperoGetVarint(next, end, value))) return 0;
+	address = prosperoUnZigZag(value, prev.address);
+
+	length = prev.length;
+	if(flags & PROSPERO_PACKED_LENGTH) {
+		if(NULL == (next = prosperoGetVarint(next, end, value))) return 0;
+		length = (uint32_t) value;
+	}
+
+	isWrite = (flags & PROSPERO_PACKED_WRITE) != 0;
+
+	prev.cycles = cycles;
+	prev.address = address;
+	prev.length = length;
+
+	return (size_t) (next - buffer);
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,113 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "prospackedreader.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <cstring>
+
+using namespace SST::Prospero;
+
+ProsperoPackedTraceReader::ProsperoPackedTraceReader( Component* owner, Params& params ) :
+	ProsperoTraceReader(owner, params) {
+
+	std::string traceFile = params.find<std::string>("file", "");
+	const int traceFD = open(traceFile.c_str(), O_RDONLY);
+
+	if(traceFD < 0) {
+		fprintf(stderr, "Fatal: Error opening trace file: %s in packed reader.\n",
+			traceFile.c_str());
+		exit(-1);
+	}
+
+	struct stat traceStat;
+	if(0 != fstat(traceFD, &traceStat) || traceStat.st_size < PROSPERO_PACKED_MAGIC_LENGTH) {
+		fprintf(stderr, "Fatal: Trace file: %s is not a packed trace.\n", traceFile.c_str());
+		exit(-1);
+	}
+
+	mappingLength = (size_t) traceStat.st_size;
+	void* traceMap = mmap(NULL, mappingLength, PROT_READ, MAP_PRIVATE, traceFD, 0);
+	close(traceFD);
+
+	if(MAP_FAILED == traceMap) {
+		fprintf(stderr, "Fatal: Unable to map trace file: %s in packed reader.\n", traceFile.c_str());
+		exit(-1);
+	}
+
+	mapping = (uint8_t*) traceMap;
+
+	// The trace is read front to back exactly once, let the kernel read well ahead of us
+	madvise(mapping, mappingLength, MADV_SEQUENTIAL);
+
+	if(0 != memcmp(mapping, PROSPERO_PACKED_MAGIC, PROSPERO_PACKED_MAGIC_LENGTH)) {
+		fprintf(stderr, "Fatal: Trace file: %s is not a packed trace.\n", traceFile.c_str());
+		exit(-1);
+	}
+
+	next = mapping + PROSPERO_PACKED_MAGIC_LENGTH;
+	end = mapping + mappingLength;
+	released = mapping;
+
+	// Keep the window a whole number of pages so the released part stays page aligned
+	const size_t pageSize = (size_t) sysconf(_SC_PAGESIZE);
+	releaseWindow = params.find<size_t>("release_window", 64 * 1024 * 1024);
+	releaseWindow = ((releaseWindow + pageSize - 1) / pageSize) * pageSize;
+
+	const size_t ringSize = params.find<size_t>("ring_size", 64);
+	ring.resize(ringSize > 0 ? ringSize : 1);
+	ringNext = 0;
+};
+
+ProsperoPackedTraceReader::~ProsperoPackedTraceReader() {
+	if(NULL != mapping) {
+		munmap(mapping, mappingLength);
+	}
+}
+
+ProsperoTraceEntry* ProsperoPackedTraceReader::readNextEntry() {
+	uint64_t reqAddress = 0;
+	uint64_t reqCycles  = 0;
+	uint32_t reqLength  = 0;
+	bool reqWrite = false;
+
+	const size_t consumed = prosperoUnpackRecord(state, next, end,
+		reqCycles, reqAddress, reqLength, reqWrite);
+
+	if(0 == consumed) {
+		if(next < end) {
+			output->verbose(CALL_INFO, 2, 0, "Packed trace ends with a partial record, returning empty request.\n");
+		}
+		return NULL;
+	}
+
+	next += consumed;
+
+	// Pages we have moved past are never read again, drop them rather than let a long trace fill memory
+	if(releaseWindow > 0 && (size_t) (next - released) >= 2 * releaseWindow) {
+		madvise((void*) released, releaseWindow, MADV_DONTNEED);
+		released += releaseWindow;
+	}
+
+	ProsperoTraceEntry* entry = &ring[ringNext];
+	ringNext = (ringNext + 1 == ring.size()) ? 0 : ringNext + 1;
+
+	entry->set(reqCycles, reqAddress, reqLength, reqWrite ? WRITE : READ);
+	return entry;
+}
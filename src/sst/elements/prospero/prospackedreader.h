@@ -0,0 +1,75 @@
+// Copyright 2009-2017 Sandia Corporation. Under the terms
+// of Contract DE-NA0003525 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2017, Sandia Corporation
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_PROSPERO_PACKED_READER
+#define _H_SST_PROSPERO_PACKED_READER
+
+#include <vector>
+
+#include "prosreader.h"
+#include "prospackedformat.h"
+
+namespace SST {
+namespace Prospero {
+
+/*
+ * Reads the packed format (see prospackedformat.h) straight out of a
+ * memory mapping of the trace, so there is no read call or parse per
+ * record and the kernel reads ahead of the replay. Entries come from a
+ * fixed ring rather than the heap, an entry stays valid until ring_size
+ * more entries have been read.
+ */
+class ProsperoPackedTraceReader : public ProsperoTraceReader {
+
+public:
+        ProsperoPackedTraceReader( Component* owner, Params& params );
+        ~ProsperoPackedTraceReader();
+        ProsperoTraceEntry* readNextEntry();
+        void releaseEntry(const ProsperoTraceEntry* entry) { }
+
+ 	SST_ELI_REGISTER_SUBCOMPONENT(
+        	ProsperoPackedTraceReader,
+        	"prospero",
+        	"ProsperoPackedTraceReader",
+        	SST_ELI_ELEMENT_VERSION(1,0,0),
+        	"Memory-mapped Packed Trace Reader",
+        	"SST::Prospero::ProsperoTraceReader"
+    	)
+
+	SST_ELI_DOCUMENT_PARAMS(
+		{ "file", "Sets the file for the trace reader to use, convert other traces with sst-prospero-convert", "" },
+		{ "ring_size", "Number of entries the reader hands out before reusing one", "64" },
+		{ "release_window", "Bytes of the mapping consumed before they are released back to the operating system", "67108864" }
+	)
+
+private:
+	uint8_t* mapping;
+	size_t mappingLength;
+	const uint8_t* next;
+	const uint8_t* end;
+	const uint8_t* released;
+	size_t releaseWindow;
+
+	ProsperoPackedState state;
+	std::vector<ProsperoTraceEntry> ring;
+	size_t ringNext;
+
+};
+
+}
+}
+
+#endif
@@ -33,6 +33,11 @@ typedef enum {
 
 class ProsperoTraceEntry {
 public:
+	ProsperoTraceEntry() :
+		cycles(0), address(0), length(0), op(READ) {
+
+		}
+
 	ProsperoTraceEntry(
 		const uint64_t eCyc,
 		const uint64_t eAddr,
@@ -48,11 +53,20 @@ public:
 	uint32_t getLength() const { return length; }
 	uint64_t getIssueAtCycle() const { return cycles; }
 	ProsperoTraceEntryOperation getOperationType() const { return op; }
+
+	/* Lets readers that keep a pool of entries reuse them */
+	void set(const uint64_t eCyc, const uint64_t eAddr,
+		const uint32_t eLen, const ProsperoTraceEntryOperation eOp) {
+		cycles = eCyc;
+		address = eAddr;
+		length = eLen;
+		op = eOp;
+	}
 private:
-	const uint64_t cycles;
-	const uint64_t address;
-	const uint32_t length;
-	const ProsperoTraceEntryOperation op;
+	uint64_t cycles;
+	uint64_t address;
+	uint32_t length;
+	ProsperoTraceEntryOperation op;
 };
 
 class ProsperoTraceReader : public SubComponent {
@@ -61,6 +75,8 @@ public:
 	ProsperoTraceReader( Component* owner, Params& params ) : SubComponent(owner) {};
 	~ProsperoTraceReader() { };
 	virtual ProsperoTraceEntry* readNextEntry() { return NULL; };
+	/* Called once the caller is done with an entry from readNextEntry, readers which own their entries override this */
+	virtual void releaseEntry(const ProsperoTraceEntry* entry) { delete entry; }
 	void setOutput(Output* out) { output = out; }
 
 protected:
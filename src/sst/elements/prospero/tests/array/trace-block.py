@@ -0,0 +1,63 @@
+# Automatically generated SST Python input
+import sst
+import os
+import sys,getopt
+import subprocess
+
+# Number of threads decoding the trace ahead of the CPU, 0 decodes on the simulation thread
+decodeThreads = "2"
+
+try:
+	opts, args = getopt.getopt(sys.argv[1:], "", ["DecodeThreads="])
+except getopt.GetoptError as err:
+	print str(err)
+	sys.exit(2)
+for o, a in opts:
+	if o == "--DecodeThreads":
+		decodeThreads = a
+
+# Copy the text trace into the block container, -c checks every record of it against the text trace
+devnull = open(os.devnull, "w")
+if subprocess.call(["sst-prospero-convert", "-i", "sstprospero-0-0.trace", "-f", "text",
+	"-o", "sstprospero-0-0.blk", "-t", "block", "-c"], stdout=devnull) != 0:
+	print "Unable to convert sstprospero-0-0.trace to a block trace"
+	sys.exit(1)
+devnull.close()
+
+# Define SST core options
+sst.setProgramOption("timebase", "1ps")
+sst.setProgramOption("stopAtCycle", "5s")
+
+# Define the simulation components
+comp_cpu = sst.Component("cpu", "prospero.prosperoCPU")
+comp_cpu.addParams({
+      	"verbose" : "0",
+	"reader" : "prospero.ProsperoBlockTraceReader",
+	"readerParams.file" : "sstprospero-0-0.blk",
+	"readerParams.decode_threads" : decodeThreads
+})
+comp_l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+comp_l1cache.addParams({
+      "access_latency_cycles" : "1",
+      "cache_frequency" : "2 Ghz",
+      "replacement_policy" : "lru",
+      "coherence_protocol" : "MESI",
+      "associativity" : "8",
+      "cache_line_size" : "64",
+      "L1" : "1",
+      "cache_size" : "64 KB"
+})
+comp_memory = sst.Component("memory", "memHierarchy.MemController")
+comp_memory.addParams({
+      "coherence_protocol" : "MESI",
+      "backend.access_time" : "100 ns",
+      "backend.mem_size" : "4096MiB",
+      "clock" : "1GHz"
+})
+
+# Define the simulation links
+link_cpu_cache_link = sst.Link("link_cpu_cache_link")
+link_cpu_cache_link.connect( (comp_cpu, "cache_link", "1000ps"), (comp_l1cache, "high_network_0", "1000ps") )
+link_mem_bus_link = sst.Link("link_mem_bus_link")
+link_mem_bus_link.connect( (comp_l1cache, "low_network_0", "50ps"), (comp_memory, "direct_link", "50ps") )
+# End of generated output.
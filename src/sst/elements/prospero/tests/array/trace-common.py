@@ -2,21 +2,34 @@
 import sst
 import os
 import sys,getopt
+import subprocess
 
 Tracetype = "Type Error"
 traceFile = "File Error" 
 memSize = "4096"
 useDramSim="no"
+decodeThreads = "2"
+
+def convertTrace(source, sourceFormat, target, targetFormat):
+    # -c reads the converted trace back and checks it against the source
+    devnull = open(os.devnull, "w")
+    status = subprocess.call(["sst-prospero-convert", "-i", source, "-f", sourceFormat,
+        "-o", target, "-t", targetFormat, "-c"], stdout=devnull)
+    devnull.close()
+    if status != 0:
+        print "Unable to convert", source, "to a", targetFormat, "trace"
+        sys.exit(1)
 
 def main():
     global Tracetype
     global traceFile
     global memSize
     global useDramSim
+    global decodeThreads
  
 
     try:
-        opts, args = getopt.getopt(sys.argv[1:], "", ["TraceType=","UseDramSim="])
+        opts, args = getopt.getopt(sys.argv[1:], "", ["TraceType=","UseDramSim=","DecodeThreads="])
     except getopt.GetopError as err:
         print str(err)
         sys.exit(2)
@@ -34,6 +47,14 @@ def main():
                 # print "args are ", o, "and", a
                 Tracetype = "CompressedBinary"
                 traceFile = "sstprospero-0-0-gz.trace"
+            elif a == "packed":
+                Tracetype = "Packed"
+                traceFile = "sstprospero-0-0.packed"
+                convertTrace("sstprospero-0-0.trace", "text", traceFile, "packed")
+            elif a == "block":
+                Tracetype = "Block"
+                traceFile = "sstprospero-0-0.blk"
+                convertTrace("sstprospero-0-0.trace", "text", traceFile, "block")
             else:
                 print "no match a= ", a
                 print  "Found nothing for o", o
@@ -41,6 +62,8 @@ def main():
             if a == "yes":
                 useDramSim = 'yes'
                 memSize = "512"
+        elif o in ("--DecodeThreads"):
+            decodeThreads = a
         else:
             print "no match for o", o
             assert False, "Unknown Options !"
@@ -58,6 +81,10 @@ comp_cpu.addParams({
        "reader" : "prospero.Prospero" + Tracetype + "TraceReader",
        "readerParams.file" : traceFile
 })
+if Tracetype == "Block":
+    comp_cpu.addParams({
+          "readerParams.decode_threads" : decodeThreads
+    })
 comp_l1cache = sst.Component("l1cache", "memHierarchy.Cache")
 comp_l1cache.addParams({
       "access_latency_cycles" : "1",
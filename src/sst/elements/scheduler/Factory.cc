@@ -350,6 +350,7 @@ Allocator* Factory::getAllocator(SST::Params& params, Machine* m, schedComponent
     } else {
         vector<string>* schedparams = parseparams(params.find<std::string>("allocator"));
         vector<string>* nearestparams = NULL;
+        int nearestThreads = params.find<int>("allocatorThreads", 1);
         switch (allocatorname(schedparams -> at(0)))
         {
             //Simple Allocator 
@@ -370,19 +371,19 @@ Allocator* Factory::getAllocator(SST::Params& params, Machine* m, schedComponent
             for (int x = 0; x < (int)schedparams -> size(); x++) {
                 nearestparams -> push_back(schedparams -> at(x));
             }
-            return new NearestAllocator(nearestparams, m);
+            return new NearestAllocator(nearestparams, m, nearestThreads);
             break;
         case GENALG:
             schedout.debug(CALL_INFO, 4, 0, "General Algorithm Nearest Allocator\n");
             nearestparams = new vector<string>;
             nearestparams -> push_back("genAlg");
-            return new NearestAllocator(nearestparams, m);
+            return new NearestAllocator(nearestparams, m, nearestThreads);
             break;
         case MM:
             schedout.debug(CALL_INFO, 4, 0, "MM Allocator\n");
             nearestparams = new vector<string>;
             nearestparams -> push_back("MM");
-            return new NearestAllocator(nearestparams, m);
+            return new NearestAllocator(nearestparams, m, nearestThreads);
             break;
         case ENERGY:
             schedout.debug(CALL_INFO, 4, 0, "Energy-Aware Allocator\n");
@@ -394,19 +395,19 @@ Allocator* Factory::getAllocator(SST::Params& params, Machine* m, schedComponent
             schedout.debug(CALL_INFO, 4, 0, "Hybrid Allocator\n");
             nearestparams = new vector<string>;
             nearestparams -> push_back("Hybrid");
-            return new NearestAllocator(nearestparams, m);
+            return new NearestAllocator(nearestparams, m, nearestThreads);
             break;
         case MC1X1:
             schedout.debug(CALL_INFO, 4, 0, "MC1x1 Allocator\n");
             nearestparams = new vector<string>;
             nearestparams -> push_back("MC1x1");
-            return new NearestAllocator(nearestparams, m);
+            return new NearestAllocator(nearestparams, m, nearestThreads);
             break;
         case OLDMC1X1:
             schedout.debug(CALL_INFO, 4, 0, "Old MC1x1 Allocator\n");
             nearestparams = new vector<string>;
             nearestparams -> push_back("OldMC1x1");
-            return new NearestAllocator(nearestparams, m);
+            return new NearestAllocator(nearestparams, m, nearestThreads);
             break;
 
             //MBS Allocators use a block-based approach
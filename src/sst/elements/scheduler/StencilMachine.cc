@@ -29,6 +29,7 @@ StencilMachine::StencilMachine(std::vector<int> inDims, int numLinks, int numCor
                          : Machine(constHelper(inDims), numCoresPerNode, D_matrix, numLinks),
                            dims(inDims)
 {
+    schedout.init("", 8, 0, Output::STDOUT);
 }
 
 std::string StencilMachine::getParamHelp()
@@ -147,7 +148,6 @@ AllocInfo* StencilMachine::getBaselineAllocation(Job* job) const
 
 MeshLocation::MeshLocation(std::vector<int> inDims)
 {
-    schedout.init("", 8, 0, Output::STDOUT);
     dims = inDims;
 }
 
@@ -163,12 +163,10 @@ MeshLocation::MeshLocation(int inpos, const StencilMachine & m)
         dims[i] = inpos / stepSize;
         inpos %= stepSize;
     }
-    schedout.init("", 8, 0, Output::STDOUT);
 }
 
 MeshLocation::MeshLocation(const MeshLocation & in)
 {
-    schedout.init("", 8, 0, Output::STDOUT);
     dims = in.dims;
     //copy constructor
 }
@@ -44,10 +44,114 @@
 #include <algorithm>  //for std::stable_sort
 
 #include "StencilMachine.h"
+#include "Torus3DMachine.h"
 
 using namespace std;
 using namespace SST::Scheduler;
 
+//Free node index:
+
+FreeNodeIndex::FreeNodeIndex(const StencilMachine & m) : machine(m)
+{
+    torus = (NULL != dynamic_cast<const Torus3DMachine*>(&m));
+    xdim = m.dims[0];
+    ydim = m.dims[1];
+    zdim = m.dims[2];
+    table.resize((xdim + 1) * (ydim + 1) * (zdim + 1), 0);
+}
+
+void FreeNodeIndex::rebuild()
+{
+    //node numbers run fastest in x, then y, then z (see MeshLocation)
+    const int sx = 1;
+    const int sy = xdim + 1;
+    const int sz = (xdim + 1) * (ydim + 1);
+    int node = 0;
+    for (int z = 0; z < zdim; z++) {
+        for (int y = 0; y < ydim; y++) {
+            for (int x = 0; x < xdim; x++) {
+                int i = (x + 1) * sx + (y + 1) * sy + (z + 1) * sz;
+                table[i] = (machine.isFree(node) ? 1 : 0)
+                           + table[i - sx] + table[i - sy] + table[i - sz]
+                           - table[i - sx - sy] - table[i - sx - sz] - table[i - sy - sz]
+                           + table[i - sx - sy - sz];
+                node++;
+            }
+        }
+    }
+}
+
+long FreeNodeIndex::boxCount(int x0, int x1, int y0, int y1, int z0, int z1) const
+{
+    const int sy = xdim + 1;
+    const int sz = (xdim + 1) * (ydim + 1);
+    x1++;
+    y1++;
+    z1++;
+    return table[x1 + y1 * sy + z1 * sz]
+           - table[x0 + y1 * sy + z1 * sz] - table[x1 + y0 * sy + z1 * sz] - table[x1 + y1 * sy + z0 * sz]
+           + table[x0 + y0 * sy + z1 * sz] + table[x0 + y1 * sy + z0 * sz] + table[x1 + y0 * sy + z0 * sz]
+           - table[x0 + y0 * sy + z0 * sz];
+}
+
+int FreeNodeIndex::range(int c, int dim, int dist, int* lo, int* hi) const
+{
+    if (!torus) {
+        lo[0] = std::max(c - dist, 0);
+        hi[0] = std::min(c + dist, dim - 1);
+        return 1;
+    }
+    //same offsets as Torus3DMachine: back at most (dim-1)/2, forward at most dim/2
+    int l = c - std::min(dist, (dim - 1) / 2);
+    int h = c + std::min(dist, dim / 2);
+    if (l < 0) {
+        lo[0] = l + dim; hi[0] = dim - 1;
+        lo[1] = 0;       hi[1] = h;
+        return 2;
+    }
+    if (h >= dim) {
+        lo[0] = l; hi[0] = dim - 1;
+        lo[1] = 0; hi[1] = h - dim;
+        return 2;
+    }
+    lo[0] = l;
+    hi[0] = h;
+    return 1;
+}
+
+long FreeNodeIndex::freeWithin(const MeshLocation & center, int dist) const
+{
+    int xlo[2], xhi[2], ylo[2], yhi[2], zlo[2], zhi[2];
+    int nx = range(center.dims[0], xdim, dist, xlo, xhi);
+    int ny = range(center.dims[1], ydim, dist, ylo, yhi);
+    int nz = range(center.dims[2], zdim, dist, zlo, zhi);
+
+    long count = 0;
+    for (int i = 0; i < nx; i++) {
+        for (int j = 0; j < ny; j++) {
+            for (int k = 0; k < nz; k++) {
+                count += boxCount(xlo[i], xhi[i], ylo[j], yhi[j], zlo[k], zhi[k]);
+            }
+        }
+    }
+    return count;
+}
+
+long FreeNodeIndex::nearestLInfSum(const MeshLocation & center, int count) const
+{
+    const int maxDist = std::max(xdim, std::max(ydim, zdim));
+    long sum = 0;
+    long prev = freeWithin(center, 0);
+    for (int dist = 1; count > 0 && dist <= maxDist; dist++) {
+        long within = freeWithin(center, dist);
+        long taken = std::min(within - prev, (long) count);
+        sum += taken * dist;
+        count -= taken;
+        prev = within;
+    }
+    return sum;
+}
+
 //Center Generators: 
 
 vector<MeshLocation*>* FreeCenterGenerator::getCenters(vector<MeshLocation*>* available) 
@@ -161,10 +265,26 @@ vector<MeshLocation*>* L1PointCollector::getNearest(MeshLocation* center, int nu
     //get sufficient nodes
     int found = 1;
     int dist = 1;
+    long foundFree = 0;
+    long centerFree = (NULL == index) ? 0 : index -> freeWithin(*center, 0);
     std::list<int>* nodeList = new std::list<int>();
     while(found < num && dist <= (mach.dims[0] + mach.dims[1] + mach.dims[2])){
+        if (NULL != index) {
+            //an L1 shell lies inside the LInf box of the same radius; if
+            //that box holds no free nodes beyond those already found, the
+            //shell is empty
+            long within = index -> freeWithin(*center, dist) - centerFree;
+            if (within == foundFree) {
+                if (foundFree == index -> numFree() - centerFree) {
+                    break;
+                }
+                dist++;
+                continue;
+            }
+        }
         std::list<int>* tempList = mach.getFreeAtDistance(center->toInt(mach), dist);
         found += tempList->size();
+        foundFree += tempList->size();
         nodeList->insert(nodeList->end(), tempList->begin(), tempList->end());
         delete tempList;
         dist++;
@@ -199,8 +319,23 @@ vector<MeshLocation*>* LInfPointCollector::getNearest(MeshLocation* center, int
     //get sufficient nodes
     int found = 1;
     int dist = 1;
+    //the torus shell walk does not match the index's boxes exactly, so only skip on meshes
+    const FreeNodeIndex* meshIndex = (NULL != index && !index -> isTorus()) ? index : NULL;
+    long prevWithin = (NULL == meshIndex) ? 0 : meshIndex -> freeWithin(*center, 0);
     std::list<int>* nodeList = new std::list<int>();
     while(found < num && dist <= (mach.dims[0] + mach.dims[1] + mach.dims[2])){
+        if (NULL != meshIndex) {
+            long within = meshIndex -> freeWithin(*center, dist);
+            bool empty = (within == prevWithin);
+            prevWithin = within;
+            if (empty) {
+                if (within == meshIndex -> numFree()) {
+                    break;
+                }
+                dist++;
+                continue;
+            }
+        }
         std::list<int>* tempList = mach.getFreeAtLInfDistance(center->toInt(mach), dist);
         found += tempList->size();
         nodeList->insert(nodeList->end(), tempList->begin(), tempList->end());
@@ -247,10 +382,19 @@ string PairwiseL1DistScorer::getSetupInfo(bool comment)
 
 std::pair<long,long>* PairwiseL1DistScorer::valueOf(MeshLocation* center, std::vector<MeshLocation*>* procs, StencilMachine* mach) 
 {
+    //L1 distance is separable, so sum each dimension on its own: with the
+    //coordinates sorted, the k-th is subtracted by the k before it and
+    //subtracts the n-k-1 after it
     long retVal = 0;
-    for (unsigned int i = 0; i < procs->size(); i++) {
-        for (unsigned int j = i + 1; j < procs->size(); j++) {
-            retVal += procs->at(i)->L1DistanceTo(*(procs->at(j)));
+    const long n = procs->size();
+    std::vector<int> coords(n);
+    for (unsigned int dim = 0; n > 0 && dim < procs->at(0)->dims.size(); dim++) {
+        for (long i = 0; i < n; i++) {
+            coords[i] = procs->at(i)->dims[dim];
+        }
+        std::sort(coords.begin(), coords.end());
+        for (long k = 0; k < n; k++) {
+            retVal += coords[k] * (2 * k - n + 1);
         }
     }
     return new std::pair<long,long>(retVal,0);
@@ -391,11 +535,24 @@ pair<long,long>* LInfDistFromCenterScorer::valueOf(MeshLocation* center, vector<
     for (unsigned int i = 0; i < procs->size(); i++) 
         retVal += center -> LInfDistanceTo(*((*procs)[i]));
 
-    long tiebreak = tiebreaker -> getTiebreak(center,procs, mach);
+    long tiebreak;
+    {
+        std::lock_guard<std::mutex> lock(tiebreakLock);
+        tiebreak = tiebreaker -> getTiebreak(center,procs, mach);
+    }
 
     return new pair<long,long>(retVal,tiebreak);
 }
 
+long LInfDistFromCenterScorer::lowerBound(MeshLocation* center, int num, const FreeNodeIndex & index)
+{
+    //the collected points other than center are num-1 distinct free nodes
+    if (index.isTorus()) {
+        return 0;
+    }
+    return index.nearestLInfSum(*center, num - 1);
+}
+
 LInfDistFromCenterScorer::LInfDistFromCenterScorer(Tiebreaker* tb)
 {
     tiebreaker = tb;
@@ -424,3 +581,12 @@ pair<long,long>* L1DistFromCenterScorer::valueOf(MeshLocation* center, vector<Me
     return new pair<long,long>(retVal,0);
 }
 
+long L1DistFromCenterScorer::lowerBound(MeshLocation* center, int num, const FreeNodeIndex & index)
+{
+    //L1 distance is never below LInf distance
+    if (index.isTorus()) {
+        return 0;
+    }
+    return index.nearestLInfSum(*center, num - 1);
+}
+
@@ -40,6 +40,7 @@
 #include <string>
 #include <sstream>
 #include <vector>
+#include <mutex>
 
 #include "StencilMachine.h"
 
@@ -50,6 +51,42 @@ namespace SST {
         class PointCollector;
         class Scorer;
 
+        //Free node index:
+
+        class FreeNodeIndex {
+            //counts the free nodes in any box of the machine in constant
+            //time using a summed-area table; rebuilt from the machine at
+            //the start of each allocation, which costs one pass over the
+            //nodes instead of one per candidate center
+
+            private:
+                const StencilMachine & machine;
+                bool torus;
+                int xdim, ydim, zdim;
+                std::vector<long> table;  //free nodes in [0,x) x [0,y) x [0,z)
+
+                long boxCount(int x0, int x1, int y0, int y1, int z0, int z1) const;
+                //splits the LInf range around c into at most two in-bounds intervals
+                int range(int c, int dim, int dist, int* lo, int* hi) const;
+
+            public:
+                FreeNodeIndex(const StencilMachine & m);
+
+                void rebuild();
+
+                bool isTorus() const { return torus; }
+
+                long numFree() const { return table.back(); }
+
+                //number of free nodes within LInf distance dist of center,
+                //measured the way the machine's getFreeAtDistance() does
+                long freeWithin(const MeshLocation & center, int dist) const;
+
+                //sum of the LInf distances of the count free nodes nearest
+                //center, not counting center itself
+                long nearestLInfSum(const MeshLocation & center, int count) const;
+        };
+
         //Comparators:
 
         class LInfComparator : public std::binary_function<MeshLocation*, MeshLocation*, bool> {
@@ -160,7 +197,14 @@ namespace SST {
         class PointCollector {
             //a way to gather nearest free processors to a given center
 
+            protected:
+                const FreeNodeIndex* index;  //optional, lets collectors skip empty shells
+
             public:
+                PointCollector() : index(NULL) { }
+
+                void setIndex(const FreeNodeIndex* idx) { index = idx; }
+
                 virtual std::vector<MeshLocation*>* getNearest(MeshLocation* center, int num, const StencilMachine & mach) = 0;
                 virtual std::string getSetupInfo(bool comment) = 0;
                 //returns num nearest locations to center from available
@@ -196,6 +240,11 @@ namespace SST {
                 //returns score associated with first num members of procs
                 //center is the center point used to select these
 
+                //returns a value valueOf() cannot be below for the num
+                //points collected around center, so the center can be
+                //skipped if that is worse than the best score found
+                virtual long lowerBound(MeshLocation* center, int num, const FreeNodeIndex & index) { return 0; }
+
         };
 
         class PairwiseL1DistScorer : public Scorer {
@@ -252,10 +301,13 @@ namespace SST {
 
             private:
                 Tiebreaker* tiebreaker;
+                std::mutex tiebreakLock;  //the tiebreaker keeps state, centers may be scored in parallel
 
             public:
                 std::pair<long,long>* valueOf(MeshLocation* center, std::vector<MeshLocation*>* procs, StencilMachine* mach) ;
 
+                long lowerBound(MeshLocation* center, int num, const FreeNodeIndex & index);
+
                 LInfDistFromCenterScorer(Tiebreaker* tb);
 
                 std::string getLastTieInfo()
@@ -274,6 +326,8 @@ namespace SST {
 
                 std::pair<long,long>* valueOf(MeshLocation* center, std::vector<MeshLocation*>* procs, StencilMachine* mach);
 
+                long lowerBound(MeshLocation* center, int num, const FreeNodeIndex & index);
+
                 std::string getSetupInfo(bool comment)
                 {
                     std::string com;
@@ -41,6 +41,7 @@
 #include <vector>
 #include <string>
 #include <iostream>
+#include <thread>
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -56,13 +57,18 @@
 using namespace SST::Scheduler;
 using namespace std;
 
-NearestAllocator::NearestAllocator(std::vector<std::string>* params, Machine* mach) : Allocator(*mach)
+NearestAllocator::NearestAllocator(std::vector<std::string>* params, Machine* mach, int threads) : Allocator(*mach)
 {
     schedout.init("", 8, 0, Output::STDOUT);
     mMachine = (StencilMachine*) mach;
     if (NULL == mMachine || mMachine->numDims() != 3) {
         schedout.fatal(CALL_INFO, 1, "Nearest allocators require a 3D mesh or torus machine");
     }
+    freeIndex = new FreeNodeIndex(*mMachine);
+    numThreads = std::max(threads, 1);
+    centerGenerator = NULL;
+    pointCollector = NULL;
+    scorer = NULL;
 
     if (params -> at(0) == "MM") {
         MMAllocator(mMachine);
@@ -161,10 +167,19 @@ NearestAllocator::NearestAllocator(std::vector<std::string>* params, Machine* ma
     if(params -> at(0) != "Hybrid" && (NULL == centerGenerator || NULL == pointCollector || NULL == scorer)) {
         schedout.fatal(CALL_INFO, 1, "Nearest input not correctly parsed");
     }
+    pointCollector -> setIndex(freeIndex);
     delete params;
     params = NULL;
 }
 
+NearestAllocator::~NearestAllocator()
+{
+    delete centerGenerator;
+    delete pointCollector;
+    delete scorer;
+    delete freeIndex;
+}
+
 std::string NearestAllocator::getParamHelp()
 {
     std::stringstream ret;
@@ -224,14 +239,6 @@ AllocInfo* NearestAllocator::allocate(Job* job, std::vector<MeshLocation*>* avai
         return retVal;
     }
 
-    //score of best value found so far with it tie-break score:
-    std::pair<long,long>* bestVal = new std::pair<long,long>(LONG_MAX,LONG_MAX);
-
-    bool recordingTies = false; //Statistics.recordingTies();
-
-    //stores allocations w/ best score (no tiebreaking) if ties being recorded:
-    //(actual best value w/ tiebreaking stored in retVal.processors)
-    std::vector<std::vector<MeshLocation*>*>* bestAllocs = new std::vector<std::vector<MeshLocation*> *>(); 
     std::vector<MeshLocation*>* possCenters;
 
     if ("Hybrid" == configName) {
@@ -254,44 +261,88 @@ AllocInfo* NearestAllocator::allocate(Job* job, std::vector<MeshLocation*>* avai
         possCenters = centerGenerator -> getCenters(available);
     }
     delete available;
-    
-    std::vector<MeshLocation*>* nearest = NULL;
-    std::vector<MeshLocation*>* alloc = new std::vector<MeshLocation*>();
-    for (std::vector<MeshLocation*>::iterator center = possCenters -> begin(); center != possCenters -> end(); ++center) {        
-        nearest = pointCollector -> getNearest(*center, nodesNeeded, *mMachine);        
-        std::pair<long,long>* val = scorer -> valueOf(*center, nearest, mMachine); 
-        if (val -> first < bestVal -> first || 
-            (val -> first == bestVal -> first && val -> second < bestVal -> second) ) {
-            delete bestVal;
-            bestVal = val;
-            for (int i = 0; i < nodesNeeded; i++) {
-                retVal -> nodeIndices[i] = (*nearest)[i] -> toInt(*mMachine);
-            }
-            if (recordingTies) {
-                bestAllocs -> clear();
-            }
+
+    freeIndex -> rebuild();
+
+    //score the centers, each thread taking every numThreads-th one; the
+    //best is the lowest score, then tiebreak, then earliest center, which
+    //is what a single thread scanning in order would keep
+    std::atomic<long> bound(LONG_MAX);
+    int threads = std::min((unsigned long) numThreads, (unsigned long) possCenters -> size());
+    std::vector<CenterScore> best(std::max(threads, 1));
+    if (threads <= 1) {
+        evaluateCenters(possCenters, 0, 1, nodesNeeded, &bound, &best[0]);
+    } else {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++) {
+            workers.push_back(std::thread(&NearestAllocator::evaluateCenters, this, possCenters,
+                                          (unsigned long) t, (unsigned long) threads, nodesNeeded, &bound, &best[t]));
         }
-        delete *center;
-        *center = NULL;
-
-        if (recordingTies && val -> first == bestVal -> first) {
-            delete alloc;
-            alloc = new std::vector<MeshLocation*>();
-            for (int i = 0; i < nodesNeeded; i++)
-                alloc -> push_back((*nearest)[i]);
-            bestAllocs -> push_back(alloc);
+        for (int t = 0; t < threads; t++) {
+            workers[t].join();
+        }
+    }
+
+    CenterScore* bestVal = &best[0];
+    for (unsigned int t = 1; t < best.size(); t++) {
+        if (best[t].value < bestVal -> value ||
+            (best[t].value == bestVal -> value && (best[t].tiebreak < bestVal -> tiebreak ||
+              (best[t].tiebreak == bestVal -> tiebreak && best[t].center < bestVal -> center)))) {
+            bestVal = &best[t];
         }
-        delete nearest;
     }
+    for (int i = 0; i < nodesNeeded && i < (int) bestVal -> nodes.size(); i++) {
+        retVal -> nodeIndices[i] = bestVal -> nodes[i];
+    }
+
     //clear memory
-    delete alloc;
-    delete bestAllocs;
+    for (unsigned int i = 0; i < possCenters -> size(); i++) {
+        delete possCenters -> at(i);
+    }
     delete possCenters;
-    delete bestVal;
     
     return retVal;
 }
 
+void NearestAllocator::evaluateCenters(std::vector<MeshLocation*>* centers, unsigned long first, unsigned long stride,
+                                       int nodesNeeded, std::atomic<long>* bound, CenterScore* best)
+{
+    best -> value = LONG_MAX;
+    best -> tiebreak = LONG_MAX;
+    best -> center = centers -> size();
+
+    for (unsigned long c = first; c < centers -> size(); c += stride) {
+        MeshLocation* center = centers -> at(c);
+
+        //a center that cannot beat a score some thread already has cannot win
+        if (scorer -> lowerBound(center, nodesNeeded, *freeIndex) > bound -> load()) {
+            continue;
+        }
+
+        std::vector<MeshLocation*>* nearest = pointCollector -> getNearest(center, nodesNeeded, *mMachine);
+        std::pair<long,long>* val = scorer -> valueOf(center, nearest, mMachine);
+        if (val -> first < best -> value ||
+            (val -> first == best -> value && val -> second < best -> tiebreak) ) {
+            best -> value = val -> first;
+            best -> tiebreak = val -> second;
+            best -> center = c;
+            best -> nodes.resize(nodesNeeded);
+            for (int i = 0; i < nodesNeeded; i++) {
+                best -> nodes[i] = (*nearest)[i] -> toInt(*mMachine);
+            }
+            long current = bound -> load();
+            while (val -> first < current && !bound -> compare_exchange_weak(current, val -> first)) { }
+        }
+        delete val;
+
+        //the first point is the center itself, owned by centers
+        for (unsigned int i = 1; i < nearest -> size(); i++) {
+            delete nearest -> at(i);
+        }
+        delete nearest;
+    }
+}
+
 void NearestAllocator::genAlgAllocator(StencilMachine* m) {
     configName = "genAlg";
     mMachine = m;
@@ -35,6 +35,7 @@
 #ifndef SST_SCHEDULER_NEARESTALLOCATOR_H__
 #define SST_SCHEDULER_NEARESTALLOCATOR_H__
 
+#include <atomic>
 #include <vector>
 #include <string>
 
@@ -45,6 +46,7 @@ namespace SST {
         class Job;
         class Machine;
         class CenterGenerator;
+        class FreeNodeIndex;
         class PointCollector;
         class Scorer;
         class StencilMachine;
@@ -65,9 +67,29 @@ namespace SST {
 
                 StencilMachine *mMachine;
 
+                //free node counts used to skip empty shells and prune centers
+                FreeNodeIndex* freeIndex;
+
+                //threads evaluating candidate centers
+                int numThreads;
+
+                //best allocation found among a subset of the centers
+                struct CenterScore {
+                    long value;
+                    long tiebreak;
+                    unsigned long center;  //index into the centers, breaks remaining ties
+                    std::vector<int> nodes;
+                };
+
+                //scores centers first, first + stride, ... into best
+                void evaluateCenters(std::vector<MeshLocation*>* centers, unsigned long first, unsigned long stride,
+                                     int nodesNeeded, std::atomic<long>* bound, CenterScore* best);
+
             public:
 
-                NearestAllocator(std::vector<std::string>* params, Machine* mach);
+                NearestAllocator(std::vector<std::string>* params, Machine* mach, int threads = 1);
+
+                ~NearestAllocator();
 
                 std::string getParamHelp();
 
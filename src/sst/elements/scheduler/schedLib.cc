@@ -130,6 +130,10 @@ static const SST::ElementInfoParam sched_params[] = {
       "Assigns available nodes to each job",
       "Simple allocator"
     },
+    { "allocatorThreads",
+      "Number of threads the nearest allocators use to score candidate centers",
+      "1"
+    },
     { "taskMapper",
         "Assigns job tasks to allocated nodes",
         "Simple task mapper"
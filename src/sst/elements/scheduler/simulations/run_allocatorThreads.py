@@ -0,0 +1,50 @@
+#!/usr/bin/env python
+'''
+Description : Runs test_scheduler_nearest.py with one and with several allocator
+              threads and checks that the nearest allocator makes the same
+              choices. Run from within scheduler/simulations/:
+              python ./run_allocatorThreads.py [THREADS]
+'''
+
+import os, sys, shutil, subprocess
+
+threads = "4"
+if len(sys.argv) > 1:
+    threads = sys.argv[1]
+
+# Runs the simulation with its logs in outDir and returns stdout and the logs, without comment lines
+def run_sim(allocatorThreads, outDir):
+    if os.path.exists(outDir):
+        shutil.rmtree(outDir)
+    os.makedirs(outDir)
+
+    cmd = "SIMOUTPUT=" + outDir + "/ sst test_scheduler_nearest.py --model-options=\"allocatorThreads=" + allocatorThreads + "\""
+    print(cmd)
+    p = subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE, shell=True)
+    output, err = p.communicate()
+    if p.returncode != 0:
+        print("SST failed: " + str(err))
+        sys.exit(1)
+
+    result = {"stdout" : output.split("\n")}
+    for name in sorted(os.listdir(outDir)):
+        logLines = list()
+        for line in open(os.path.join(outDir, name)):
+            if not line.startswith("#"):
+                logLines.append(line)
+        result[name] = logLines
+    return result
+
+single = run_sim("1", "allocatorThreads_1")
+multi = run_sim(threads, "allocatorThreads_" + threads)
+
+failed = False
+for name in sorted(set(single.keys()) | set(multi.keys())):
+    if single.get(name) == multi.get(name):
+        print("[v] " + name + " matches with allocatorThreads=1 and " + threads)
+    else:
+        print("[x] " + name + " differs with allocatorThreads=1 and " + threads)
+        failed = True
+
+if failed:
+    sys.exit(1)
@@ -0,0 +1,34 @@
+# scheduler simulation input file for the nearest allocator
+# The number of allocator threads can be given as --model-options="allocatorThreads=N"
+import sst
+import sys
+
+allocatorThreads = "1"
+for arg in sys.argv[1:]:
+    if arg.startswith("allocatorThreads="):
+        allocatorThreads = arg[len("allocatorThreads="):]
+
+# Define SST core options
+sst.setProgramOption("run-mode", "both")
+
+# Define the simulation components
+scheduler = sst.Component("myScheduler",             "scheduler.schedComponent")
+scheduler.addParams({
+      "traceName" : "test_scheduler_Atlas.sim",
+      "machine" : "mesh[5,4,4]",
+      "coresPerNode" : "4",
+      "scheduler" : "easy",
+      "allocator" : "nearest",
+      "allocatorThreads" : allocatorThreads,
+      "timeperdistance" : ".001865[.1569,0.0129]",
+      "dMatrixFile" : "none"
+})
+
+# nodes and links
+for i in range(80):
+    node = sst.Component("n%d"%i, "scheduler.nodeComponent")
+    node.addParams({
+          "nodeNum" : "%d"%i,
+    })
+    link = sst.Link("l%d"%i)
+    link.connect( (scheduler, "nodeLink%d"%i, "0 ns"), (node, "Scheduler", "0 ns") )